@@ -0,0 +1,1314 @@
+// Auto-generated by tools/atlas_packer from:
+//   assets/wizard.sprite
+//   assets/wizard2.sprite
+//   assets/skeleton_alpha.sprite
+// Atlas: 64x160, 3 frames
+// Format: RGB565 plane + Alpha8 plane (3 bytes per pixel)
+
+#ifndef ATLAS_CHARACTERS_H
+#define ATLAS_CHARACTERS_H
+
+#include <stdint.h>
+#include "framebuffer.h"  // For Sprite_atlas_planes definition
+
+inline constexpr uint16_t characters_frame_wizard = 0;
+inline constexpr uint16_t characters_frame_wizard2 = 1;
+inline constexpr uint16_t characters_frame_skeleton_alpha = 2;
+inline constexpr uint16_t characters_frame_count = 3;
+
+inline constexpr uint16_t characters_color[10240] = {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x41CC,0x2847,0x0845,0x0845,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x41CC,0x41CC,0x290A,0x41CC,0x41CC,0x0845,
+    0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x41CC,0x290A,0x41CC,0x41CC,0x18A7,0x18A7,
+    0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x290A,0x41CC,0x41CC,0x41CC,0x18A7,0x18A7,0x18A7,
+    0x1087,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x41CC,0x41CC,0x41CC,0x41CC,0x18A7,0x18A7,0x18A7,0x1087,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x41CC,0x290A,0x41CC,0x18A7,0x18A7,0x18A7,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x41CC,0x290A,0x41CC,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x41CC,0x41CC,0x290A,0x290A,0x290A,0x18A7,0x0845,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x41CC,0x41CC,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,
+    0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x41CC,0x290A,0x41CC,0x41CC,0x290A,0x290A,0x18A7,0x18A7,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0845,0x0845,0x0845,0x0845,0x41CC,0x41CC,0x41CC,0x41CC,0x41CC,0x41CC,0x41CC,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0845,0x0845,0x61C2,0x61C2,0x61C2,0x61C2,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0845,
+    0x0845,0x41CC,0x41CC,0x290A,0x41CC,0x41CC,0x290A,0x41CC,0x41CC,0x41CC,0x290A,0x41CC,0x290A,0x290A,0x290A,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0845,0x0845,0x61C2,0x61C2,0x0845,0x0845,0x61C2,0x61C2,0x0845,0x0000,0x0000,0x0845,0x0845,0x41CC,
+    0x290A,0x290A,0x41CC,0x41CC,0x41CC,0x41CC,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0845,0x0845,0x61C2,0x61C2,0x0845,0x0845,0x0845,0x0845,0x61C2,0x0845,0x0845,0x0000,0x0845,0x290A,0x41CC,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x1064,0x1064,0x1064,0x1064,0x1064,0x1064,0x1064,0x1064,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0845,0x61C2,0x61C2,0x0845,0x0845,0x61C2,0x61C2,0x0845,0x61C2,0x61C2,0x0845,0x0000,0x0845,0x0845,0x0845,
+    0x0845,0x0000,0x0000,0x0000,0x0000,0x0845,0x1064,0xDED0,0xDED0,0x1064,0x1064,0x1064,0xDED0,0xDED0,0x1064,0x18A7,
+    0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0845,0x61C2,0x61C2,0x0845,0x61C2,0x61C2,0x0845,0x0845,0x0845,0x0845,0x61C2,0x0845,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x1064,0x1064,0x1064,0x1064,0x41AB,0x1064,0x1064,0x1064,0x1064,0x18A7,
+    0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0845,0x61C2,0x0845,0x0845,0x61C2,0x61C2,0x0845,0x61C2,0x61C2,0x0845,0x0845,0x61C2,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x1064,0x1064,0x41AB,0x41AB,0x41AB,0x41AB,0x41AB,0x41AB,0x1064,0x18A7,
+    0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0845,0x61C2,0x61C2,0x0845,0x0845,0x0845,0x0845,0x61C2,0x61C2,0x0845,0x61C2,0x61C2,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41AB,0x41AB,0x963A,0xD7BF,0x963A,0x41AB,0x41AB,0x6C31,0x41AB,0x18A7,
+    0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0845,0x0845,0x61C2,0x61C2,0x0845,0x61C2,0x61C2,0x61C2,0x0845,0x0845,0x61C2,0x0845,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41AB,0x6C31,0x963A,0xD7BF,0x963A,0xD7BF,0xD7BF,0x6C31,0xD7BF,0x326A,
+    0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0845,0x0845,0x61C2,0x0845,0x0845,0x61C2,0x0845,0x0845,0x61C2,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0xD7BF,0x6C31,0xD7BF,0x1064,0x1064,0xD7BF,0xD7BF,0xD7BF,0xD7BF,0x326A,
+    0x18A7,0x18A7,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0845,0x0845,0x61C2,0x0845,0x0845,0x0845,0x61C2,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0xD7BF,0xD7BF,0xD7BF,0x1064,0x1064,0x1064,0xD7BF,0xD7BF,0xD7BF,0x326A,
+    0x1064,0x18A7,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0845,0x61C2,0x61C2,0x61C2,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0xD7BF,0x963A,0x6493,0xD7BF,0xD7BF,0x6493,0xD7BF,0x963A,0xD7BF,0xD7BF,
+    0x1064,0x18A7,0x18A7,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0845,0x0845,0x61C2,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x963A,0x963A,0xD7BF,0xD7BF,0xD7BF,0x6493,0xD7BF,0x963A,0x6C31,0x963A,
+    0x1064,0x18A7,0x1066,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0845,0x290A,0x290A,0x963A,0x963A,0x6493,0xD7BF,0x963A,0x6493,0xD7BF,0x963A,0x6C31,0xD7BF,
+    0x1064,0x0845,0x0845,0x0845,0x290A,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0845,0x0845,0x0845,0x0845,0x963A,0xD7BF,0xD7BF,0x6C31,0x963A,0xD7BF,0xD7BF,0x963A,0x6C31,0xD7BF,
+    0x1064,0x0845,0x0845,0x290A,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x963A,0xD7BF,0xD7BF,0x6C31,0x963A,0x6C31,0xD7BF,0xD7BF,0x6C31,0x1066,
+    0x1066,0x0845,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0845,0x0845,0x0845,0x2045,0x18A7,0x1066,0xD7BF,0x6C31,0xD7BF,0xD7BF,0x6C31,0x6C31,0xD7BF,0xD7BF,0x0845,
+    0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x290A,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x6C31,0xD7BF,0x963A,0x6C31,0x6C31,0xD7BF,0xD7BF,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0845,0x0845,0x0845,0xA346,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0845,0x0845,0x290A,0x0845,0x0845,0x0845,0x0845,0x0845,0x6C31,0xD7BF,0x963A,0x6C31,0xD7BF,0x963A,0x290A,0x290A,
+    0x1066,0x1066,0x1066,0x1066,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0845,0xA346,0xA346,0xA346,0x0845,0xA346,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0845,0x0845,
+    0x0845,0x0845,0x18A7,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0xD7BF,0x6C31,0xD7BF,0x963A,0x0845,0x0845,
+    0x290A,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x290A,0x290A,0x18A7,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0845,0x0845,0xA346,0xA346,0xA346,0x0845,0xA346,0x0845,0x290A,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x41CC,0x41CC,0x290A,0x41CC,0x0845,0x0845,0x0845,0x41CC,0x0845,0x41CC,0x0845,0x6C31,0x41CC,0x41CC,0x290A,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x290A,0x290A,0x18A7,0x290A,0x290A,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0845,0xA346,0xA346,0xA346,0xA346,0xA346,0xA346,0x0845,0x41CC,0x41CC,0x290A,0x0845,0x0845,0x0845,0x41CC,
+    0x41CC,0x18A7,0x290A,0x18A7,0x0845,0x0845,0x0845,0x290A,0x0845,0x18A7,0x0845,0x6C31,0x41CC,0x18A7,0x290A,0x0845,
+    0x0845,0x0845,0x290A,0x18A7,0x290A,0x41CC,0x290A,0x290A,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0845,0x0845,0xA346,0xA346,0xA346,0xA346,0x0845,0x0845,0x41CC,0x290A,0x290A,0x41CC,0x290A,0x41CC,0x41CC,
+    0x41CC,0x18A7,0x290A,0x18A7,0x0845,0x0845,0x0845,0x290A,0x0845,0x18A7,0x0845,0x41CC,0x41CC,0x18A7,0x290A,0x0845,
+    0x290A,0x0845,0x290A,0x18A7,0x0845,0x290A,0x18A7,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0845,0xA346,0xA346,0x0845,0x0845,0x0845,0x0845,0x0845,0x290A,0x41CC,0x41CC,0x41CC,0x41CC,0x18A7,
+    0x290A,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x290A,0x0845,0x18A7,0x0845,0x18A7,0x290A,0x18A7,0x290A,0x0845,
+    0x290A,0x0845,0x290A,0x0845,0x290A,0x18A7,0x18A7,0x290A,0x290A,0x0845,0x0845,0x18A7,0x0845,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x41CC,0x41CC,0x290A,0x41CC,0x290A,0x18A7,
+    0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x290A,0x0845,0x290A,0x0845,0x18A7,0x0845,0x18A7,0x41CC,0x18A7,0x290A,0x0845,
+    0x290A,0x0845,0x290A,0x0845,0x18A7,0x18A7,0x290A,0x290A,0x18A7,0x0845,0x0845,0x18A7,0x0845,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,0x0845,0x0845,0x41CC,0x41CC,0x290A,0x18A7,0x290A,0x18A7,
+    0x18A7,0x18A7,0x0845,0x0845,0x0845,0x41CC,0x0845,0x18A7,0x0845,0x18A7,0x0845,0x18A7,0x290A,0x290A,0x290A,0x0845,
+    0x290A,0x0845,0x290A,0x0845,0x290A,0x18A7,0x18A7,0x18A7,0x290A,0x0845,0x0845,0x0845,0x18A7,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,0x0845,0x0845,0x290A,0x18A7,0x290A,0x18A7,0x18A7,0x18A7,
+    0x18A7,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x290A,0x290A,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,0x0845,0x0845,0x290A,0x18A7,0x290A,0x18A7,0x18A7,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x290A,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x290A,0x18A7,0x18A7,0x18A7,0x18A7,
+    0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x41CC,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,0x0845,0x0845,0x290A,0x18A7,0x290A,0x18A7,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0000,0x0845,0x290A,0x290A,0x18A7,0x18A7,0x18A7,0x290A,0x290A,0x18A7,0x18A7,0x18A7,0x18A7,
+    0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0845,0xA346,0xA346,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,0x0845,0x0845,0x18A7,0x18A7,0x290A,0x18A7,0x0845,0x0845,
+    0x0845,0x0845,0x0000,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0xA346,0xA346,0xA346,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x0845,
+    0x0845,0x0000,0x0000,0x0845,0x41CC,0x290A,0x0845,0x290A,0x18A7,0x18A7,0x0845,0x290A,0x18A7,0x18A7,0x18A7,0x0845,
+    0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x0845,0xA346,0xA346,0xA346,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,
+    0x0000,0x0000,0x0000,0x0845,0x18A7,0x290A,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,
+    0x18A7,0x0845,0x18A7,0x18A7,0x1065,0x0845,0x0845,0xA346,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,0x0845,0x0845,0x18A7,0x0845,0x18A7,0x0845,0x0845,0x0000,
+    0x0000,0x0000,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,
+    0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x1066,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,0x0845,0x0845,0x18A7,0x0845,0x0845,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0845,0x41CC,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x0845,
+    0x0845,0x18A7,0x0845,0x0845,0x18A7,0x1065,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0845,0x41CC,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x0845,
+    0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x1065,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x18A7,
+    0x0845,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x1065,0x1046,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0845,0x41CC,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x18A7,
+    0x0845,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x1065,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0845,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x0845,
+    0x18A7,0x0845,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0845,0x41CC,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,
+    0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,
+    0x290A,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,
+    0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x1066,0x1066,0x0845,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,
+    0x290A,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x18A7,0x290A,0x18A7,0x18A7,0x18A7,0x0845,
+    0x0845,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x290A,
+    0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x290A,0x290A,0x18A7,0x18A7,0x18A7,
+    0x0845,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x290A,0x18A7,
+    0x18A7,0x18A7,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x290A,0x18A7,0x18A7,0x18A7,
+    0x0845,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0845,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x290A,0x18A7,
+    0x18A7,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,
+    0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x0845,
+    0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x18A7,0x18A7,
+    0x0845,0x18A7,0x0845,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,
+    0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x18A7,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x41CC,0x2847,
+    0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0xD79E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x41CC,0x41CC,0x290A,0x41CC,
+    0x41CC,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x41CC,0x290A,0x41CC,0x41CC,
+    0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0xD79E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x290A,0x41CC,0x41CC,0x41CC,0x18A7,
+    0x18A7,0x18A7,0x1087,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0xD79E,0x0000,0x0000,0x0000,0x0000,0xD79E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x41CC,0x41CC,0x41CC,0x41CC,0x18A7,0x18A7,
+    0x18A7,0x1087,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xBF5E,0x0000,0x0000,0x0000,0x0000,0xD79E,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x41CC,0x290A,0x41CC,0x18A7,0x18A7,0x18A7,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0xD79E,0x0000,0x0000,0x0000,0x0000,0xD79E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x41CC,0x290A,0x41CC,0x18A7,0x18A7,0x18A7,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0xD79E,0x0000,0x0000,0x0000,0x0000,0xD79E,0x0000,0x0000,0xD79E,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x41CC,0x41CC,0x290A,0x290A,0x290A,0x18A7,0x0845,
+    0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0xD79E,0x0000,0x0000,0x0000,0xBF5E,0x0000,0x0000,0xD79E,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x41CC,0x41CC,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,
+    0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0xD79E,0xD79E,0x0000,0x0000,0xBF5E,0x0000,0xD79E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x41CC,0x290A,0x41CC,0x41CC,0x290A,0x290A,0x18A7,0x18A7,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0xAD78,0xAD78,0xCF5D,0xAD78,0xAD78,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0845,0x0845,0x0845,0x0845,0x41CC,0x41CC,0x41CC,0x41CC,0x41CC,0x41CC,0x41CC,0x18A7,0x18A7,0x18A7,
+    0x18A7,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0xAD78,0xAD78,0xCF5D,0xCF5D,0xCF5D,0xD79E,0xBF5E,0xAD78,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0845,0x0845,0x41CC,0x41CC,0x290A,0x41CC,0x41CC,0x290A,0x41CC,0x41CC,0x41CC,0x290A,0x41CC,0x290A,0x290A,
+    0x290A,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0xAD78,0xBF5E,0xD79E,0xCF5D,0xCF5D,0xCF5D,0xD79E,0xAD78,0xAD78,0x0000,0x0000,0x0000,0x0845,
+    0x0845,0x41CC,0x290A,0x290A,0x41CC,0x41CC,0x41CC,0x41CC,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0xAD78,0xAD78,0xBF5E,0xCF5D,0xCF5D,0xD79E,0xCF5D,0xBF5E,0xAD78,0xAD78,0xAD78,0x0000,0x0000,0x0845,
+    0x290A,0x41CC,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x1064,0x1064,0x1064,0x1064,0x1064,0x1064,0x1064,
+    0x1064,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x7B91,0xAD78,0xD79E,0xBF5E,0xCF5D,0xD79E,0xBF5E,0xBF5E,0xAD78,0xBF5E,0x7B91,0x0000,0x0000,0x0845,
+    0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0845,0x1064,0xDED0,0xDED0,0x1064,0x1064,0x1064,0xDED0,0xDED0,
+    0x1064,0x18A7,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x7B91,0xAD78,0xAD78,0xD79E,0xCF5D,0xBF5E,0xD79E,0xAD78,0xAD78,0x7B91,0x7B91,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x1064,0x1064,0x1064,0x1064,0x41AB,0x1064,0x1064,0x1064,
+    0x1064,0x18A7,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x7B91,0x7B91,0xAD78,0xAD78,0xD79E,0xCF5D,0xAD78,0xAD78,0xAD78,0x7B91,0xAD78,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x1064,0x1064,0x41AB,0x41AB,0x41AB,0x41AB,0x41AB,0x41AB,
+    0x1064,0x18A7,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0xAD78,0x7B91,0x7B91,0x7B91,0xAD78,0xAD78,0xAD78,0x7B91,0x7B91,0x7B91,0xAD78,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41AB,0x41AB,0x963A,0xD7BF,0x963A,0x41AB,0x41AB,0x6C31,
+    0x41AB,0x18A7,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0xAD78,0x7B91,0x7B91,0x7B91,0x7B91,0x7B91,0x7B91,0xAD78,0xAD78,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41AB,0x6C31,0x963A,0xD7BF,0x963A,0xD7BF,0xD7BF,0x6C31,
+    0xD7BF,0x326A,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0xAD78,0xAD78,0x0845,0x0845,0x0845,0xAD78,0xAD78,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0xD7BF,0x6C31,0xD7BF,0x1064,0x1064,0xD7BF,0xD7BF,0xD7BF,
+    0xD7BF,0x326A,0x18A7,0x18A7,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x2901,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0xD7BF,0xD7BF,0xD7BF,0x1064,0x1064,0x1064,0xD7BF,0xD7BF,
+    0xD7BF,0x326A,0x1064,0x18A7,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x2901,0x2901,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0xD7BF,0x963A,0x6493,0xD7BF,0xD7BF,0x6493,0xD7BF,0x963A,
+    0xD7BF,0xD7BF,0x1064,0x18A7,0x18A7,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x2901,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x963A,0x963A,0xD7BF,0xD7BF,0xD7BF,0x6493,0xD7BF,0x963A,
+    0x6C31,0x963A,0x1064,0x18A7,0x1066,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x290A,0x290A,0x963A,0x963A,0x6493,0xD7BF,0x963A,0x6493,0xD7BF,0x963A,
+    0x6C31,0xD7BF,0x1064,0x0845,0x0845,0x0845,0x290A,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0845,0x963A,0xD7BF,0xD7BF,0x6C31,0x963A,0xD7BF,0xD7BF,0x963A,
+    0x6C31,0xD7BF,0x1064,0x0845,0x0845,0x290A,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x963A,0xD7BF,0xD7BF,0x6C31,0x963A,0x6C31,0xD7BF,0xD7BF,
+    0x6C31,0x1066,0x1066,0x0845,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x2045,0x18A7,0x1066,0xD7BF,0x6C31,0xD7BF,0xD7BF,0x6C31,0x6C31,0xD7BF,
+    0xD7BF,0x0845,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x290A,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x6C31,0xD7BF,0x963A,0x6C31,0x6C31,0xD7BF,
+    0xD7BF,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0xA346,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0845,0x0845,0x290A,0x0845,0x0845,0x0845,0x0845,0x0845,0x6C31,0xD7BF,0x963A,0x6C31,0xD7BF,0x963A,
+    0x290A,0x290A,0x1066,0x1066,0x1066,0x1066,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0xA346,0xA346,0xA346,0x0845,0x7A64,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,
+    0x0845,0x0845,0x0845,0x0845,0x18A7,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0xD7BF,0x6C31,0xD7BF,0x963A,
+    0x0845,0x0845,0x290A,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x290A,0x290A,0x18A7,0x0845,0x0845,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0845,0x0845,0xA346,0xA346,0xA346,0x0845,0x7A64,0x0845,0x290A,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x41CC,0x41CC,0x290A,0x41CC,0x0845,0x0845,0x0845,0x41CC,0x0845,0x41CC,0x0845,0x6C31,0x41CC,0x41CC,
+    0x290A,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x290A,0x290A,0x18A7,0x290A,0x290A,0x0845,0x0845,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0845,0xA346,0xA346,0xA346,0xA346,0xA346,0x7A64,0x0845,0x41CC,0x41CC,0x290A,0x0845,0x0845,
+    0x0845,0x41CC,0x41CC,0x18A7,0x290A,0x18A7,0x0845,0x0845,0x0845,0x290A,0x0845,0x18A7,0x0845,0x6C31,0x41CC,0x18A7,
+    0x290A,0x0845,0x0845,0x0845,0x290A,0x18A7,0x290A,0x41CC,0x290A,0x290A,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0845,0x0845,0xA346,0x7A64,0x7A64,0x7A64,0x0845,0x0845,0x41CC,0x290A,0x290A,0x41CC,0x290A,
+    0x41CC,0x41CC,0x41CC,0x18A7,0x290A,0x18A7,0x0845,0x0845,0x0845,0x290A,0x0845,0x18A7,0x0845,0x41CC,0x41CC,0x18A7,
+    0x290A,0x0845,0x290A,0x0845,0x290A,0x18A7,0x0845,0x290A,0x18A7,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x0845,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x7A64,0x7A64,0x0845,0x0845,0x0845,0x0845,0x0845,0x290A,0x41CC,0x41CC,0x41CC,
+    0x41CC,0x18A7,0x290A,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x290A,0x0845,0x18A7,0x0845,0x18A7,0x290A,0x18A7,
+    0x290A,0x0845,0x290A,0x0845,0x290A,0x0845,0x290A,0x18A7,0x18A7,0x290A,0x290A,0x0845,0x0845,0x18A7,0x0845,0x0845,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x41CC,0x41CC,0x290A,0x41CC,
+    0x290A,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x290A,0x0845,0x290A,0x0845,0x18A7,0x0845,0x18A7,0x41CC,0x18A7,
+    0x290A,0x0845,0x290A,0x0845,0x290A,0x0845,0x18A7,0x18A7,0x290A,0x290A,0x18A7,0x0845,0x0845,0x18A7,0x0845,0x0845,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0845,0x0845,0x0845,0x41CC,0x41CC,0x290A,0x18A7,
+    0x290A,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x41CC,0x0845,0x18A7,0x0845,0x18A7,0x0845,0x18A7,0x290A,0x290A,
+    0x290A,0x0845,0x290A,0x0845,0x290A,0x0845,0x290A,0x18A7,0x18A7,0x18A7,0x290A,0x0845,0x0845,0x0845,0x18A7,0x0845,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0845,0x0845,0x0845,0x290A,0x18A7,0x290A,0x18A7,
+    0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x290A,0x290A,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0845,0x0845,0x0845,0x290A,0x18A7,0x290A,0x18A7,
+    0x18A7,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x41CC,0x41CC,0x41CC,0x41CC,0x41CC,0x18A7,0x290A,0x290A,0x290A,
+    0x290A,0x290A,0x290A,0x18A7,0x0845,0x0845,0x0845,0x41CC,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0845,0x0845,0x0845,0x290A,0x18A7,0x290A,0x18A7,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0845,0x41CC,0x290A,0x18A7,0x290A,0x290A,0x290A,0x290A,0x290A,0x18A7,
+    0x290A,0x290A,0x18A7,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0xA346,0x7A64,0x0845,0x0845,0x0845,0x0845,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0845,0x0845,0x0845,0x18A7,0x18A7,0x290A,0x18A7,
+    0x0845,0x0845,0x0845,0x0845,0x0000,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0xA346,0xA346,0x7A64,0x0845,0x0845,0x0845,0x0845,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0845,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x18A7,
+    0x0845,0x0845,0x0845,0x0000,0x0000,0x0845,0x41CC,0x290A,0x0845,0x41CC,0x0845,0x41CC,0x0845,0x290A,0x290A,0x0845,
+    0x290A,0x0845,0x1086,0x0845,0x1086,0x0845,0x0845,0x0845,0xA346,0xA346,0x7A64,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0845,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x0845,
+    0x0845,0x0845,0x0000,0x0000,0x0000,0x0845,0x41CC,0x290A,0x0845,0x41CC,0x0845,0x290A,0x0845,0x290A,0x290A,0x0845,
+    0x290A,0x0845,0x1086,0x0845,0x1086,0x0845,0x1065,0x0845,0x0845,0x7A64,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0845,0x0845,0x0845,0x18A7,0x0845,0x18A7,0x0845,
+    0x0845,0x0000,0x0000,0x0000,0x0845,0x0845,0x41CC,0x290A,0x0845,0x290A,0x0845,0x290A,0x0845,0x290A,0x290A,0x0845,
+    0x18A7,0x0845,0x1086,0x0845,0x18A7,0x1086,0x0845,0x1066,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0845,0x0845,0x0845,0x18A7,0x0845,0x0845,0x0845,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x290A,0x290A,0x0845,0x290A,0x0845,0x290A,0x0845,0x290A,0x18A7,0x0845,
+    0x18A7,0x0845,0x1086,0x0845,0x18A7,0x1086,0x0845,0x1065,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x290A,0x290A,0x0845,0x290A,0x0845,0x290A,0x0845,0x18A7,0x18A7,0x0845,
+    0x18A7,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x1086,0x0845,0x1065,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0845,0x0845,0x290A,0x290A,0x0845,0x0845,0x18A7,0x0845,0x18A7,0x0845,0x18A7,0x18A7,0x0845,
+    0x18A7,0x0845,0x1086,0x1086,0x0845,0x18A7,0x18A7,0x0845,0x1065,0x1046,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0845,0x41CC,0x290A,0x18A7,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x0845,0x18A7,0x18A7,0x0845,
+    0x18A7,0x0845,0x0845,0x1086,0x0845,0x0845,0x18A7,0x1086,0x0845,0x1065,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0845,0x0845,0x290A,0x18A7,0x0845,0x0845,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,
+    0x0845,0x1086,0x0845,0x0845,0x1086,0x0845,0x0845,0x18A7,0x1086,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0845,0x41CC,0x290A,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x1086,
+    0x0845,0x0845,0x1086,0x0845,0x0845,0x1086,0x0845,0x0845,0x0845,0x1086,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0845,0x290A,0x290A,0x18A7,0x0845,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x1086,
+    0x1086,0x0845,0x18A7,0x1086,0x0845,0x0845,0x1086,0x0845,0x0845,0x0845,0x1086,0x1066,0x1066,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0845,0x290A,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x1086,
+    0x1086,0x0845,0x0845,0x18A7,0x1086,0x0845,0x0845,0x18A7,0x1086,0x0845,0x0845,0x1086,0x1086,0x0845,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0845,0x290A,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x1086,0x1086,
+    0x1086,0x1086,0x0845,0x0845,0x18A7,0x1086,0x0845,0x0845,0x1086,0x1086,0x0845,0x0845,0x1086,0x0845,0x0845,0x0845,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,
+    0x290A,0x18A7,0x18A7,0x18A7,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x1086,0x1086,
+    0x1086,0x1086,0x1086,0x0845,0x0845,0x18A7,0x1086,0x0845,0x0845,0x18A7,0x1086,0x0845,0x0845,0x1086,0x0845,0x0845,
+    0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,
+    0x290A,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x1086,0x1086,
+    0x1086,0x1086,0x1086,0x1086,0x0845,0x0845,0x18A7,0x1086,0x0845,0x0845,0x18A7,0x1086,0x0845,0x0845,0x1086,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x2901,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,
+    0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x1086,0x1086,0x1086,
+    0x1086,0x1086,0x1086,0x1086,0x1086,0x0845,0x0845,0x18A7,0x1086,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4229,0x5249,0x5249,0x49E8,0x4986,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4A4D,0x4A6A,0x5269,0x4A28,0x41E7,0x4186,0x39C7,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4209,0x4229,0x4A29,0x49E8,0x41C7,0x3945,0x3945,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4A08,0x41E7,0x3186,0x39A6,0x3966,0x3945,0x3924,0x4145,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3186,0x39A7,0x3165,0x39A6,0x3165,0x3145,0x3124,0x3124,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x31A6,0x39A7,0x39E7,0x3965,0x39A7,0x2924,0x28E3,0x10A2,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x4A49,0x39C7,0x4A08,0x41A6,0x3924,0x3965,0x3165,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x4A69,0x4A49,0x41C7,0x3986,0x3965,0x3945,0x4165,0x4986,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x4B6D,0x426A,0x4A28,0x3966,0x3965,0x3945,0x3945,0x3924,0x3145,0x3124,0x4986,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x3A28,0x39E8,0x39A7,0x3124,0x3124,0x3945,0x3104,0x3145,0x2904,0x3104,0x3965,0x41A6,
+    0x3000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x39E8,0x39E8,0x41C7,0x3924,0x3945,0x3965,0x0000,0x2124,0x0000,0x2924,0x3144,0x3965,
+    0x3965,0x3186,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x8410,0x4208,0x4208,0x41C7,0x3965,0x3124,0x3924,0x3944,0x0000,0x0000,0x0000,0x3124,0x2945,
+    0x3145,0x52AA,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x4A28,0x41E8,0x41C7,0x39A6,0x3965,0x3124,0x3104,0x3123,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x3186,0x5229,0x4A49,0x39E8,0x39A6,0x3145,0x3124,0x2904,0x28E3,0x4208,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x4A49,0x4A29,0x41E7,0x2124,0x39E8,0x41E8,0x3986,0x3104,0x28E3,0x38E3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x39A6,0x41E7,0x3186,0x0000,0x4228,0x39A7,0x39E7,0x4186,0x28E3,0x3124,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x3165,0x3145,0x4104,0x0000,0x4208,0x4229,0x39E7,0x3165,0x2904,0x3945,0x3924,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x41A6,0x3965,0x3145,0x0000,0x3186,0x31A6,0x41E7,0x3986,0x2904,0x3145,0x3144,0x2104,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x3165,0x3124,0x4208,0x0000,0x2104,0x3186,0x3144,0x3144,0x31A6,0x3965,0x3924,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x3966,0x3124,0x3124,0x0000,0x0000,0x2000,0x2904,0x3145,0x3986,0x39C7,0x3945,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x4208,0x3986,0x3124,0x3904,0x4200,0x0000,0x41E7,0x39C7,0x3986,0x3986,0x3104,0x3000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x2945,0x3145,0x3124,0x3924,0x2965,0x4228,0x41E8,0x39C7,0x3166,0x3945,0x3145,0x2124,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x2965,0x20E3,0x2904,0x2924,0x41E8,0x41C7,0x41C7,0x3986,0x2965,0x2124,0x3165,0x4186,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x18E7,0x39E7,0x4208,0x41E7,0x41E7,0x3166,0x0000,0x0000,0x0000,0x41C7,0x41C7,0x4165,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x4208,0x4208,0x4A28,0x41E8,0x3986,0x3104,0x0000,0x0000,0x0000,0x0000,0x39E8,0x41E7,0x4186,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x3124,0x526A,0x4A29,0x41E7,0x39A6,0x2104,0x0000,0x0000,0x0000,0x0000,0x0000,0x39A7,0x39A6,0x3945,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x4ACB,0x4A29,0x41A7,0x3965,0x3924,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2945,0x2945,0x2903,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x2104,0x3145,0x3104,0x3124,0x3104,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2924,0x2924,0x20A2,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x1041,0x2904,0x20E3,0x0000,0x0000,0x0000,0x0000,0x0000,0x2925,0x3124,0x1082,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0820,0x1882,0x0000,0x0000,0x0000,0x0000,0x0000,0x2924,0x3145,0x18A2,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0800,0x0000,0x0000,0x0000,0x0000,0x0000,0x2945,0x3124,0x2904,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3124,0x3104,0x3124,0x2082,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x10A2,0x4208,0x3145,0x4186,0x3945,0x3965,
+    0x4186,0x3124,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3124,0x4208,0x41A7,0x41A6,0x3965,0x3965,
+    0x41A6,0x3124,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2104,0x3165,0x1882,0x1082,0x2945,0x3986,
+    0x3125,0x20C3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0841,0x0841,
+    0x0820,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+};
+
+inline constexpr uint8_t characters_alpha[10240] = {
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,
+    255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,
+    255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,  0,
+      0,  0,  0,  0,  0,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,255,255,255,255,255,255,255,255,255,  0,  0,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,255,255,255,255,255,255,255,255,255,255,255,  0,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,255,255,255,255,255,255,255,255,255,255,255,  0,255,255,255,
+    255,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,
+      0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,255,255,255,255,255,255,255,255,255,  0,  0,  0,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,  0,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,
+      0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,  0,
+      0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,  0,  0,
+      0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,
+      0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,
+      0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,  0,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,  0,  0,  0,  0,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,
+    255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,198,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,
+    255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,
+    255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,198,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    198,  0,  0,  0,  0,198,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,198,  0,  0,  0,  0,198,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,198,  0,  0,  0,  0,198,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,198,  0,  0,  0,  0,198,  0,  0,198,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,
+    255,255,  0,  0,  0,  0,  0,255,255,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,198,  0,  0,  0,198,  0,  0,198,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,
+    255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,198,198,  0,  0,198,  0,198,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,255,255,198,255,255,  0,  0,  0,  0,  0,  0,
+      0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,255,255,198,198,198,198,198,255,  0,  0,  0,  0,  0,
+      0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,255,198,198,198,198,198,198,255,255,  0,  0,  0,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,255,255,198,198,198,198,198,198,255,255,255,  0,  0,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,255,255,198,198,198,198,198,198,255,198,255,  0,  0,255,
+    255,255,255,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,255,255,255,198,198,198,198,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,255,255,255,255,198,198,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,255,255,255,255,255,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,255,255,255,255,255,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,255,255,255,255,255,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,255,255,  0,  0,  0,  0,  0,
+      0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,
+      0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,  0,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,  0,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,
+    255,255,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,
+    255,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,
+      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,
+      0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,  0,
+      0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,  0,
+      0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,  0,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,  0,  0,  0,  0,  0,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,  0,  0,  0,  0,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  1,  1,  0,  1,  0,  1, 26,106,142, 80, 10,  1,  0,
+      0,  0,  0,  1,  1,  0,  0,  1,  0,  0,  1,  1,  0,  0,  1,  0,
+      0,  0,  1,  0,  0,  1,  0,  1,  0,  1,  1,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  1,  1,  1,  0,  0,  1,  1,  7,169,249,255,239,128,  9,  0,
+      1,  0,  1,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  1,  1,
+      1,  0,  0,  1,  0,  0,  0,  0,  1,  0,  1,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  1,  1,  1,  1,  1,  0, 24,211,255,255,255,217, 30,  1,
+      1,  0,  0,  1,  0,  0,  1,  1,  1,  0,  1,  1,  0,  1,  0,  0,
+      1,  1,  1,  0,  0,  1,  2,  0,  0,  0,  0,  1,  1,  1,  1,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  1,  1,  0, 28,120,227,255,255,255,211, 24,  0,
+      0,  0,  2,  0,  0,  0,  0,  1,  0,  2,  1,  1,  1,  1,  0,  1,
+      1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  1,  1,  1,  1,  0, 15,185,251,247,233,251,245, 92,  2,  0,
+      0,  1,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+      0,  1,  0,  0,  1,  1,  0,  0,  0,  0,  0,  1,  1,  0,  1,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      1,  0,  0,  0,  0,  1, 64,239,237,211,144,145,151, 25,  0,  1,
+      0,  1,  1,  0,  0,  1,  0,  0,  2,  1,  1,  1,  0,  1,  1,  0,
+      0,  0,  0,  0,  1,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      1,  1,  1,  0,  0,  7,138,251,219,185,193, 28,  3,  1,  1,  0,
+      1,  1,  0,  1,  1,  1,  1,  0,  0,  1,  0,  0,  1,  0,  2,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0,  0,  1,  0,
+      1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      1,  2,  0,  1,  1, 62,225,249,231,233,229, 70, 10,  3,  1,  0,
+      1,  0,  1,  0,  0,  0,  1,  0,  1,  1,  1,  1,  1,  1,  1,  0,
+      0,  1,  0,  1,  0,  1,  0,  0,  0,  1,  1,  1,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  2,  3,  1,  7,140,249,235,233,237,241,136,140, 61, 10,  2,
+      2,  1,  1,  0,  1,  1,  1,  0,  2,  1,  1,  1,  1,  0,  0,  1,
+      1,  0,  1,  0,  1,  0,  1,  0,  0,  0,  0,  0,  1,  0,  1,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      1,  2,  1,  1, 22,213,255,211,169,229,223, 37, 54,154,137, 44,
+      5,  1,  1,  0,  1,  0,  1,  1,  2,  2,  1,  1,  0,  1,  1,  0,
+      0,  0,  2,  0,  1,  1,  0,  1,  0,  1,  1,  0,  0,  1,  1,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      2,  1,  1,  0, 30,221,253,211,151,221,  0, 14,  1, 34,154,163,
+     83,  5,  1,  1,  1,  1,  1,  1,  0,  1,  1,  2,  0,  0,  2,  1,
+      1,  0,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  1,  1,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  1,  1,  2, 48,221,255,241,231,233, 96,  1,  1,  1, 35, 51,
+     36,  3,  1,  1,  0,  1,  1,  1,  1,  1,  1,  1,  1,  0,  1,  1,
+      0,  1,  1,  0,  1,  0,  0,  0,  0,  1,  0,  1,  0,  1,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      1,  0,  2, 48,112,235,255,255,251,175, 21,  1,  1,  2,  0,  0,
+      1,  1,  2,  1,  3,  0,  1,  1,  0,  1,  2,  1,  2,  1,  2,  1,
+      0,  1,  1,  0,  1,  0,  1,  0,  0,  2,  0,  0,  1,  0,  0,  1,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      2, 10, 75, 78, 38,218,249,255,223, 58,  4,  2,  1,  1,  1,  2,
+      1,  1,  1,  1,  1,  2,  1,  1,  1,  1,  1,  1,  0,  1,  1,  0,
+      0,  1,  1,  1,  1,  1,  0,  2,  1,  1,  1,  0,  0,  0,  1,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     31,139, 99,  7, 34,227,251,241,157, 17,  2,  1,  3,  1,  1,  1,
+      1,  1,  0,  1,  1,  1,  0,  1,  2,  2,  1,  1,  1,  1,  1,  1,
+      1,  1,  0,  0,  1,  1,  1,  1,  1,  1,  1,  0,  1,  0,  0,  1,
+      1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    108,141, 21,  1, 22,203,247,172,155, 77,  1,  1,  1,  1,  2,  1,
+      2,  1,  2,  0,  2,  1,  0,  1,  1,  1,  0,  1,  2,  0,  1,  1,
+      1,  1,  1,  1,  0,  1,  1,  0,  0,  1,  1,  0,  0,  0,  1,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     70,142,  8,  2, 16,192,247,198, 66,176, 27,  1,  1,  0,  1,  0,
+      1,  0,  1,  1,  0,  2,  1,  1,  1,  1,  1,  0,  1,  1,  2,  1,
+      1,  0,  0,  1,  1,  1,  1,  2,  1,  0,  2,  1,  1,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     23,141, 32,  2, 10,134,234,134, 24,178,120,  8,  1,  1,  1,  1,
+      1,  1,  2,  2,  1,  1,  2,  1,  2,  2,  1,  1,  2,  2,  1,  0,
+      1,  1,  1,  1,  0,  0,  1,  0,  1,  1,  1,  1,  1,  0,  0,  1,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      4, 87, 85,  4,  3, 15,119,196,103,118,213, 50,  1,  2,  2,  2,
+      2,  1,  2,  2,  2,  2,  2,  1,  1,  0,  2,  1,  1,  1,  1,  1,
+      1,  1,  1,  1,  0,  0,  1,  1,  0,  1,  0,  0,  1,  1,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      2, 35,135, 21,  3,  2,  7, 44,168,189,231,136,  2,  2,  1,  2,
+      1,  1,  2,  2,  1,  2,  2,  2,  3,  2,  1,  2,  1,  0,  2,  1,
+      0,  1,  1,  0,  0,  1,  1,  2,  1,  1,  2,  0,  1,  1,  2,  0,
+      1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      1, 40,192,111, 36,  4,  1, 30,138,223,237,109,  5,  3,  2,  1,
+      1,  2,  2,  1,  0,  4,  1,  1,  2,  1,  2,  2,  1,  1,  1,  3,
+      3,  1,  2,  1,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,
+      1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      2, 43,143,122, 40, 11, 52,140,181,158,156, 83,  7,  3,  1,  1,
+      2,  2,  2,  2,  3,  2,  2,  1,  2,  1,  3,  1,  8,  4,  4,  6,
+      6,  4,  6,  3,  0,  1,  1,  3,  1,  0,  1,  0,  0,  0,  0,  0,
+      1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      1, 23, 73,108, 34, 66,176,159, 65, 11, 28,152, 75,  4,  2,  3,
+      2,  4,  2,  3,  3,  2,  1,  1,  3,  2,  4,  6,  7,  5, 12, 12,
+     16, 11, 12, 10, 16,  6,  6,  3,  3,  3,  5,  1,  2,  0,  0,  0,
+      1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      3,  3,  9, 29,116,196,125, 23,  3,  3,  5, 84,203, 28,  2,  3,
+      3,  1,  2,  1,  2,  2,  1,  4,  3,  8,  5, 14, 16, 17, 11, 21,
+     16, 13, 19, 19, 19,  8, 13, 10, 14,  9,  7,  9,  5,  5,  3,  2,
+      2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      3,  4, 20,140,210,109, 15,  3,  4,  5,  3, 82,241,109,  3,  4,
+      3,  4,  3,  3,  4,  3,  2,  5,  8,  7, 12, 16, 14, 18, 24, 30,
+     26, 20, 33, 26, 26, 15, 23, 20, 13, 15, 10, 12, 12,  9,  6,  6,
+      4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     14,118,164,233,108,  8,  8,  5,  2,  5,  5,105,239,112,  5,  3,
+      3,  3,  4,  1,  5,  4,  3,  8, 10, 21, 10, 28, 30, 30, 35, 44,
+     40, 41, 45, 40, 37, 37, 30, 23, 29, 25, 29, 18,  9, 15,  6,  9,
+     11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     20,179,215,223, 52,  4,  6,  5,  5,  4,  8, 81,225, 72,  5,  9,
+      3,  7, 13, 27, 19, 15, 17, 24, 25, 41, 38, 41, 46, 54, 49, 51,
+     54, 62, 59, 50, 52, 57, 36, 44, 36, 29, 25, 22, 20, 14, 15,  8,
+      6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      8, 19, 36,123, 98, 11,  8,  7,  9, 13,  7, 78,207, 45, 21, 28,
+     32, 53, 43, 53, 52, 66, 60, 53, 55, 52, 61, 66, 67, 56, 76, 72,
+     79, 76, 65, 59, 57, 59, 58, 54, 41, 34, 31, 26, 21, 12, 11, 16,
+     16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      8,  8,  7, 30,130, 97, 47, 47, 51, 49, 66,100,212, 62, 52, 46,
+     54, 56, 70, 71, 86, 73, 66, 64, 59, 74, 65, 77, 67, 78, 82, 88,
+     67, 70, 89, 75, 65, 64, 74, 55, 46, 44, 27, 20, 12, 12, 16, 13,
+     10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      6, 10, 16, 24, 79,137,114,100, 78, 59, 61, 97,195, 49, 31, 17,
+     35, 35, 44, 43, 54, 63, 79, 77, 72, 78, 80, 98, 89, 97, 95, 84,
+     73, 84, 94, 74, 74, 63, 66, 51, 42, 27, 27, 27, 18, 15, 19, 14,
+     12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      4, 10, 11, 12, 20, 27, 22, 27, 23, 16,  8, 61,196, 24, 11,  7,
+      6, 10, 12, 25, 33, 48, 58, 58, 84, 84, 85, 94,106, 86, 86, 80,
+     91, 79, 73, 77, 71, 60, 56, 43, 37, 41, 25, 14, 15, 17, 18,  8,
+      8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      6,  8,  8, 12, 11,  8,  7,  5,  7,  9,  7, 59,204, 46, 14,  6,
+      7,  5, 11, 23, 28, 54, 50, 73, 83, 80, 68, 82, 84, 67, 84, 57,
+     69, 61, 56, 59, 50, 53, 40, 42, 38, 37, 25, 22, 16, 16, 19,  8,
+     13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      7,  6,  8,  9,  9,  5,  9,  8,  7,  8, 12, 84,221,200,139, 81,
+     35, 14, 10, 15, 39, 52, 67, 71, 75, 72, 80, 74, 64, 67, 57, 44,
+     53, 44, 37, 45, 43, 43, 44, 27, 27, 26, 26, 19,  9, 17,  6,  9,
+      4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      3,  5,  3,  4,  7,  5,  4,  6,  4,  7, 20,176,226,238,212,205,
+    199,129, 57, 84, 69, 84, 77, 72, 56, 56, 60, 44, 47, 42, 42, 42,
+     39, 30, 30, 25, 27, 21, 17, 20, 21, 13, 10, 12,  7,  7,  4,  3,
+      5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      4,  4,  4,  5,  5,  6,  5,  4,  8,  7, 15, 80,145,172,170,204,
+    191,129, 75, 61, 54, 63, 59, 58, 48, 30, 18, 32, 33, 20, 26, 30,
+     16, 30, 18, 20, 20, 11,  8,  2, 10,  4,  1,  4,  3,  1,  3,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      3,  4,  3,  3,  3,  2,  5,  5,  4,  5,  9, 12, 46, 48, 51, 66,
+     72, 46, 33, 27, 30, 27, 27, 35, 15, 19, 10, 15, 14, 15, 16, 17,
+     20,  9, 15,  9,  5,  3,  7,  2,  1,  2,  2,  2,  1,  1,  0,  1,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      3,  4,  3,  2,  5,  2,  3,  5,  4,  4,  3,  7, 10, 10,  9,  9,
+      9, 15, 18, 13, 24, 13, 10,  9, 14, 14, 13, 12, 14,  9,  8, 10,
+      7,  5,  5,  3,  1,  3,  2,  1,  1,  1,  1,  1,  1,  1,  1,  0,
+      1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      3,  2,  3,  2,  2,  5,  2,  3,  4,  4,  6,  4,  5,  4,  5,  9,
+      8, 11, 11,  9, 19, 20, 21,  5, 14, 14, 11,  8,  1,  2,  3,  9,
+      3,  1,  1,  1,  2,  1,  1,  1,  1,  0,  1,  0,  1,  1,  1,  1,
+      1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+// x, y, width, height, offset_x, offset_y, source_width, source_height
+inline constexpr Atlas_frame characters_frames[3] = {
+    {0, 0, 51, 57, 8, 2, 64, 64},  // wizard
+    {0, 58, 53, 57, 6, 2, 64, 64},  // wizard2
+    {0, 116, 49, 38, 8, 2, 59, 43},  // skeleton_alpha
+};
+
+inline constexpr Sprite_atlas_planes characters_atlas = {64, 160, characters_color, characters_alpha, characters_frames, characters_frame_count};
+
+#endif // ATLAS_CHARACTERS_H
@@ -1,652 +1,340 @@
 // Auto-generated from assets/skeleton_alpha.sprite
 // Sprite dimensions: 59x43
-// Format: RGB565 + Alpha8 (3 bytes per pixel)
+// Format: RGB565 plane + Alpha8 plane (3 bytes per pixel)
 
 #ifndef SPRITE_SKELETON_ALPHA_H
 #define SPRITE_SKELETON_ALPHA_H
 
 #include <stdint.h>
-#include "framebuffer.h"  // For SpritePixel definition
+#include "framebuffer.h"  // For Sprite_planes definition
 
-const uint16_t skeleton_alpha_width = 59;
-const uint16_t skeleton_alpha_height = 43;
+inline constexpr uint16_t skeleton_alpha_width = 59;
+inline constexpr uint16_t skeleton_alpha_height = 43;
 
-const SpritePixel skeleton_alpha_data[2537] = {
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   2}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x52AA,   3}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x4229,  26},
-    {0x5249, 106}, {0x5249, 142}, {0x49E8,  80}, {0x4986,  10},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x4A4D,   7}, {0x4A6A, 169}, {0x5269, 249},
-    {0x4A28, 255}, {0x41E7, 239}, {0x4186, 128}, {0x39C7,   9},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x4209,  24}, {0x4229, 211}, {0x4A29, 255}, {0x49E8, 255},
-    {0x41C7, 255}, {0x3945, 217}, {0x3945,  30}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   2}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x4A08,  28}, {0x41E7, 120},
-    {0x3186, 227}, {0x39A6, 255}, {0x3966, 255}, {0x3945, 255},
-    {0x3924, 211}, {0x4145,  24}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   2}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x3186,  15}, {0x39A7, 185}, {0x3165, 251}, {0x39A6, 247},
-    {0x3165, 233}, {0x3145, 251}, {0x3124, 245}, {0x3124,  92},
-    {0x0000,   2}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x31A6,  64},
-    {0x39A7, 239}, {0x39E7, 237}, {0x3965, 211}, {0x39A7, 144},
-    {0x2924, 145}, {0x28E3, 151}, {0x10A2,  25}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   2}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x4A49,   7}, {0x39C7, 138}, {0x4A08, 251},
-    {0x41A6, 219}, {0x3924, 185}, {0x3965, 193}, {0x3165,  28},
-    {0x0000,   3}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   2}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x4A69,  62}, {0x4A49, 225}, {0x41C7, 249}, {0x3986, 231},
-    {0x3965, 233}, {0x3945, 229}, {0x4165,  70}, {0x4986,  10},
-    {0x0000,   3}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   0}, {0x0000,   0}, {0x0000,   2},
-    {0x0000,   3}, {0x0000,   1}, {0x4B6D,   7}, {0x426A, 140},
-    {0x4A28, 249}, {0x3966, 235}, {0x3965, 233}, {0x3945, 237},
-    {0x3945, 241}, {0x3924, 136}, {0x3145, 140}, {0x3124,  61},
-    {0x4986,  10}, {0x0000,   2}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   1}, {0x3A28,  22}, {0x39E8, 213}, {0x39A7, 255},
-    {0x3124, 211}, {0x3124, 169}, {0x3945, 229}, {0x3104, 223},
-    {0x3145,  37}, {0x2904,  54}, {0x3104, 154}, {0x3965, 137},
-    {0x41A6,  44}, {0x3000,   5}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   2}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   2},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x39E8,  30}, {0x39E8, 221}, {0x41C7, 253}, {0x3924, 211},
-    {0x3945, 151}, {0x3965, 221}, {0x0000,   0}, {0x2124,  14},
-    {0x0000,   1}, {0x2924,  34}, {0x3144, 154}, {0x3965, 163},
-    {0x3965,  83}, {0x3186,   5}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   2},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x8410,   2}, {0x4208,  48},
-    {0x4208, 221}, {0x41C7, 255}, {0x3965, 241}, {0x3124, 231},
-    {0x3924, 233}, {0x3944,  96}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x3124,  35}, {0x2945,  51}, {0x3145,  36},
-    {0x52AA,   3}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   2}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   2}, {0x4A28,  48}, {0x41E8, 112}, {0x41C7, 235},
-    {0x39A6, 255}, {0x3965, 255}, {0x3124, 251}, {0x3104, 175},
-    {0x3123,  21}, {0x0000,   1}, {0x0000,   1}, {0x0000,   2},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   3}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   2},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   2}, {0x0000,   1}, {0x0000,   2},
-    {0x0000,   0}, {0x0000,   2}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   2}, {0x3186,  10}, {0x5229,  75},
-    {0x4A49,  78}, {0x39E8,  38}, {0x39A6, 218}, {0x3145, 249},
-    {0x3124, 255}, {0x2904, 223}, {0x28E3,  58}, {0x4208,   4},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   2},
-    {0x4A49,  31}, {0x4A29, 139}, {0x41E7,  99}, {0x2124,   7},
-    {0x39E8,  34}, {0x41E8, 227}, {0x3986, 251}, {0x3104, 241},
-    {0x28E3, 157}, {0x38E3,  17}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   3}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   2}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x52AA,   3}, {0x39A6, 108},
-    {0x41E7, 141}, {0x3186,  21}, {0x0000,   1}, {0x4228,  22},
-    {0x39A7, 203}, {0x39E7, 247}, {0x4186, 172}, {0x28E3, 155},
-    {0x3124,  77}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   2}, {0x0000,   1}, {0x0000,   2},
-    {0x0000,   1}, {0x0000,   2}, {0x0000,   0}, {0x0000,   2},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   2},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x3165,  70}, {0x3145, 142},
-    {0x4104,   8}, {0x0000,   2}, {0x4208,  16}, {0x4229, 192},
-    {0x39E7, 247}, {0x3165, 198}, {0x2904,  66}, {0x3945, 176},
-    {0x3924,  27}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   2},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   2}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   2}, {0x0000,   0}, {0x0000,   2},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x41A6,  23}, {0x3965, 141}, {0x3145,  32},
-    {0x0000,   2}, {0x3186,  10}, {0x31A6, 134}, {0x41E7, 234},
-    {0x3986, 134}, {0x2904,  24}, {0x3145, 178}, {0x3144, 120},
-    {0x2104,   8}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   2},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   1}, {0x0000,   2},
-    {0x0000,   1}, {0x0000,   2}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   2}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   3}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   2}, {0x0000,   0},
-    {0x0000,   4}, {0x3165,  87}, {0x3124,  85}, {0x4208,   4},
-    {0x0000,   3}, {0x2104,  15}, {0x3186, 119}, {0x3144, 196},
-    {0x3144, 103}, {0x31A6, 118}, {0x3965, 213}, {0x3924,  50},
-    {0x0000,   1}, {0x0000,   2}, {0x0000,   2}, {0x0000,   2},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   2}, {0x0000,   2},
-    {0x0000,   2}, {0x0000,   2}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   3}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   2}, {0x0000,   2}, {0x0000,   2},
-    {0x3966,  35}, {0x3124, 135}, {0x3124,  21}, {0x0000,   3},
-    {0x0000,   2}, {0x2000,   7}, {0x2904,  44}, {0x3145, 168},
-    {0x3986, 189}, {0x39C7, 231}, {0x3945, 136}, {0x0000,   2},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   2}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   2}, {0x0000,   2}, {0x0000,   3},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   2}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   2}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   2}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   2}, {0x0000,   2},
-    {0x0000,   0}, {0x0000,   2}, {0x0000,   2}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   2}, {0x0000,   1}, {0x4208,  40},
-    {0x3986, 192}, {0x3124, 111}, {0x3904,  36}, {0x4200,   4},
-    {0x0000,   1}, {0x41E7,  30}, {0x39C7, 138}, {0x3986, 223},
-    {0x3986, 237}, {0x3104, 109}, {0x3000,   5}, {0x0000,   3},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   1}, {0x0000,   2},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   0}, {0x0000,   4},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   2}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   3}, {0x0000,   3}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   3},
-    {0x0000,   2}, {0x0000,   2}, {0x0000,   4}, {0x0000,   3},
-    {0x0000,   2}, {0x0000,   2}, {0x2945,  43}, {0x3145, 143},
-    {0x3124, 122}, {0x3924,  40}, {0x2965,  11}, {0x4228,  52},
-    {0x41E8, 140}, {0x39C7, 181}, {0x3166, 158}, {0x3945, 156},
-    {0x3145,  83}, {0x2124,   7}, {0x0000,   3}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   2}, {0x0000,   2}, {0x0000,   2},
-    {0x0000,   2}, {0x0000,   3}, {0x0000,   2}, {0x0000,   2},
-    {0x0000,   1}, {0x0000,   2}, {0x0000,   1}, {0x0000,   3},
-    {0x0000,   1}, {0x0000,   8}, {0x0000,   4}, {0x0000,   4},
-    {0x0000,   6}, {0x0000,   6}, {0x0000,   4}, {0x0000,   6},
-    {0x0000,   3}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   3}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   2}, {0x0000,   2}, {0x0000,   2},
-    {0x0000,   1}, {0x2965,  23}, {0x20E3,  73}, {0x2904, 108},
-    {0x2924,  34}, {0x41E8,  66}, {0x41C7, 176}, {0x41C7, 159},
-    {0x3986,  65}, {0x2965,  11}, {0x2124,  28}, {0x3165, 152},
-    {0x4186,  75}, {0x0000,   4}, {0x0000,   2}, {0x0000,   3},
-    {0x0000,   2}, {0x0000,   4}, {0x0000,   2}, {0x0000,   3},
-    {0x0000,   3}, {0x0000,   2}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   3}, {0x0000,   2}, {0x0000,   4}, {0x0000,   6},
-    {0x0000,   7}, {0x0000,   5}, {0x0000,  12}, {0x0000,  12},
-    {0x0000,  16}, {0x0000,  11}, {0x0000,  12}, {0x0000,  10},
-    {0x0000,  16}, {0x0000,   6}, {0x0000,   6}, {0x0000,   3},
-    {0x0000,   3}, {0x0000,   3}, {0x0000,   5}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   2},
-    {0x0000,   3}, {0x0000,   2}, {0x0000,   4}, {0x0000,   4},
-    {0x0000,   3}, {0x0000,   4}, {0x0000,   1}, {0x0000,   3},
-    {0x0000,   3}, {0x18E7,   9}, {0x39E7,  29}, {0x4208, 116},
-    {0x41E7, 196}, {0x41E7, 125}, {0x3166,  23}, {0x0000,   3},
-    {0x0000,   3}, {0x0000,   5}, {0x41C7,  84}, {0x41C7, 203},
-    {0x4165,  28}, {0x0000,   2}, {0x0000,   3}, {0x0000,   3},
-    {0x0000,   1}, {0x0000,   2}, {0x0000,   1}, {0x0000,   2},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   4}, {0x0000,   3},
-    {0x0000,   8}, {0x0000,   5}, {0x0000,  14}, {0x0000,  16},
-    {0x0000,  17}, {0x0000,  11}, {0x0000,  21}, {0x0000,  16},
-    {0x0000,  13}, {0x0000,  19}, {0x0000,  19}, {0x0000,  19},
-    {0x0000,   8}, {0x0000,  13}, {0x0000,  10}, {0x0000,  14},
-    {0x0000,   9}, {0x0000,   7}, {0x0000,   9}, {0x0000,   5},
-    {0x0000,   5}, {0x0000,   3}, {0x0000,   2}, {0x0000,   2},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   2}, {0x0000,   4}, {0x0000,   2},
-    {0x0000,   1}, {0x0000,   4}, {0x0000,   3}, {0x4208,   4},
-    {0x4208,  20}, {0x4A28, 140}, {0x41E8, 210}, {0x3986, 109},
-    {0x3104,  15}, {0x0000,   3}, {0x0000,   4}, {0x0000,   5},
-    {0x0000,   3}, {0x39E8,  82}, {0x41E7, 241}, {0x4186, 109},
-    {0x0000,   3}, {0x0000,   4}, {0x0000,   3}, {0x0000,   4},
-    {0x0000,   3}, {0x0000,   3}, {0x0000,   4}, {0x0000,   3},
-    {0x0000,   2}, {0x0000,   5}, {0x0000,   8}, {0x0000,   7},
-    {0x0000,  12}, {0x0000,  16}, {0x0000,  14}, {0x0000,  18},
-    {0x0000,  24}, {0x0000,  30}, {0x0000,  26}, {0x0000,  20},
-    {0x0000,  33}, {0x0000,  26}, {0x0000,  26}, {0x0000,  15},
-    {0x0000,  23}, {0x0000,  20}, {0x0000,  13}, {0x0000,  15},
-    {0x0000,  10}, {0x0000,  12}, {0x0000,  12}, {0x0000,   9},
-    {0x0000,   6}, {0x0000,   6}, {0x0000,   4}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   2}, {0x0000,   2},
-    {0x0000,   1}, {0x0000,   2}, {0x0000,   2}, {0x0000,   4},
-    {0x0000,   4}, {0x3124,  14}, {0x526A, 118}, {0x4A29, 164},
-    {0x41E7, 233}, {0x39A6, 108}, {0x2104,   8}, {0x0000,   8},
-    {0x0000,   5}, {0x0000,   2}, {0x0000,   5}, {0x0000,   5},
-    {0x39A7, 105}, {0x39A6, 239}, {0x3945, 112}, {0x0000,   5},
-    {0x0000,   3}, {0x0000,   3}, {0x0000,   3}, {0x0000,   4},
-    {0x0000,   1}, {0x0000,   5}, {0x0000,   4}, {0x0000,   3},
-    {0x0000,   8}, {0x0000,  10}, {0x0000,  21}, {0x0000,  10},
-    {0x0000,  28}, {0x0000,  30}, {0x0000,  30}, {0x0000,  35},
-    {0x0000,  44}, {0x0000,  40}, {0x0000,  41}, {0x0000,  45},
-    {0x0000,  40}, {0x0000,  37}, {0x0000,  37}, {0x0000,  30},
-    {0x0000,  23}, {0x0000,  29}, {0x0000,  25}, {0x0000,  29},
-    {0x0000,  18}, {0x0000,   9}, {0x0000,  15}, {0x0000,   6},
-    {0x0000,   9}, {0x0000,  11}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   2}, {0x0000,   2}, {0x0000,   3}, {0x0000,   4},
-    {0x0000,   3}, {0x0000,   3}, {0x0000,   3}, {0x0000,   3},
-    {0x4ACB,  20}, {0x4A29, 179}, {0x41A7, 215}, {0x3965, 223},
-    {0x3924,  52}, {0x0000,   4}, {0x0000,   6}, {0x0000,   5},
-    {0x0000,   5}, {0x0000,   4}, {0x0000,   8}, {0x2945,  81},
-    {0x2945, 225}, {0x2903,  72}, {0x0000,   5}, {0x0000,   9},
-    {0x0000,   3}, {0x0000,   7}, {0x0000,  13}, {0x0000,  27},
-    {0x0000,  19}, {0x0000,  15}, {0x0000,  17}, {0x0000,  24},
-    {0x0000,  25}, {0x0000,  41}, {0x0000,  38}, {0x0000,  41},
-    {0x0000,  46}, {0x0000,  54}, {0x0000,  49}, {0x0000,  51},
-    {0x0000,  54}, {0x0000,  62}, {0x0000,  59}, {0x0000,  50},
-    {0x0000,  52}, {0x0000,  57}, {0x0000,  36}, {0x0000,  44},
-    {0x0000,  36}, {0x0000,  29}, {0x0000,  25}, {0x0000,  22},
-    {0x0000,  20}, {0x0000,  14}, {0x0000,  15}, {0x0000,   8},
-    {0x0000,   6}, {0x0000,   0}, {0x0000,   0}, {0x0000,   2},
-    {0x0000,   2}, {0x0000,   4}, {0x0000,   1}, {0x0000,   3},
-    {0x0000,   2}, {0x0000,   3}, {0x0000,   4}, {0x2104,   8},
-    {0x3145,  19}, {0x3104,  36}, {0x3124, 123}, {0x3104,  98},
-    {0x0000,  11}, {0x0000,   8}, {0x0000,   7}, {0x0000,   9},
-    {0x0000,  13}, {0x0000,   7}, {0x2924,  78}, {0x2924, 207},
-    {0x20A2,  45}, {0x0000,  21}, {0x0000,  28}, {0x0000,  32},
-    {0x0000,  53}, {0x0000,  43}, {0x0000,  53}, {0x0000,  52},
-    {0x0000,  66}, {0x0000,  60}, {0x0000,  53}, {0x0000,  55},
-    {0x0000,  52}, {0x0000,  61}, {0x0000,  66}, {0x0000,  67},
-    {0x0000,  56}, {0x0000,  76}, {0x0000,  72}, {0x0000,  79},
-    {0x0000,  76}, {0x0000,  65}, {0x0000,  59}, {0x0000,  57},
-    {0x0000,  59}, {0x0000,  58}, {0x0000,  54}, {0x0000,  41},
-    {0x0000,  34}, {0x0000,  31}, {0x0000,  26}, {0x0000,  21},
-    {0x0000,  12}, {0x0000,  11}, {0x0000,  16}, {0x0000,  16},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   3}, {0x0000,   2}, {0x0000,   4}, {0x0000,   4},
-    {0x0000,   4}, {0x0000,   4}, {0x0000,   8}, {0x0000,   8},
-    {0x0000,   7}, {0x1041,  30}, {0x2904, 130}, {0x20E3,  97},
-    {0x0000,  47}, {0x0000,  47}, {0x0000,  51}, {0x0000,  49},
-    {0x0000,  66}, {0x2925, 100}, {0x3124, 212}, {0x1082,  62},
-    {0x0000,  52}, {0x0000,  46}, {0x0000,  54}, {0x0000,  56},
-    {0x0000,  70}, {0x0000,  71}, {0x0000,  86}, {0x0000,  73},
-    {0x0000,  66}, {0x0000,  64}, {0x0000,  59}, {0x0000,  74},
-    {0x0000,  65}, {0x0000,  77}, {0x0000,  67}, {0x0000,  78},
-    {0x0000,  82}, {0x0000,  88}, {0x0000,  67}, {0x0000,  70},
-    {0x0000,  89}, {0x0000,  75}, {0x0000,  65}, {0x0000,  64},
-    {0x0000,  74}, {0x0000,  55}, {0x0000,  46}, {0x0000,  44},
-    {0x0000,  27}, {0x0000,  20}, {0x0000,  12}, {0x0000,  12},
-    {0x0000,  16}, {0x0000,  13}, {0x0000,  10}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   3}, {0x0000,   3}, {0x0000,   3},
-    {0x0000,   2}, {0x0000,   3}, {0x0000,   4}, {0x0000,   6},
-    {0x0000,   7}, {0x0000,   6}, {0x0000,  10}, {0x0000,  16},
-    {0x0000,  24}, {0x0820,  79}, {0x1882, 137}, {0x0000, 114},
-    {0x0000, 100}, {0x0000,  78}, {0x0000,  59}, {0x0000,  61},
-    {0x2924,  97}, {0x3145, 195}, {0x18A2,  49}, {0x0000,  31},
-    {0x0000,  17}, {0x0000,  35}, {0x0000,  35}, {0x0000,  44},
-    {0x0000,  43}, {0x0000,  54}, {0x0000,  63}, {0x0000,  79},
-    {0x0000,  77}, {0x0000,  72}, {0x0000,  78}, {0x0000,  80},
-    {0x0000,  98}, {0x0000,  89}, {0x0000,  97}, {0x0000,  95},
-    {0x0000,  84}, {0x0000,  73}, {0x0000,  84}, {0x0000,  94},
-    {0x0000,  74}, {0x0000,  74}, {0x0000,  63}, {0x0000,  66},
-    {0x0000,  51}, {0x0000,  42}, {0x0000,  27}, {0x0000,  27},
-    {0x0000,  27}, {0x0000,  18}, {0x0000,  15}, {0x0000,  19},
-    {0x0000,  14}, {0x0000,  12}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   2}, {0x0000,   2}, {0x0000,   2}, {0x0000,   2},
-    {0x0000,   1}, {0x0000,   3}, {0x0000,   3}, {0x0000,   7},
-    {0x0000,   4}, {0x0000,  10}, {0x0000,  11}, {0x0000,  12},
-    {0x0000,  20}, {0x0800,  27}, {0x0000,  22}, {0x0000,  27},
-    {0x0000,  23}, {0x0000,  16}, {0x0000,   8}, {0x2945,  61},
-    {0x3124, 196}, {0x2904,  24}, {0x0000,  11}, {0x0000,   7},
-    {0x0000,   6}, {0x0000,  10}, {0x0000,  12}, {0x0000,  25},
-    {0x0000,  33}, {0x0000,  48}, {0x0000,  58}, {0x0000,  58},
-    {0x0000,  84}, {0x0000,  84}, {0x0000,  85}, {0x0000,  94},
-    {0x0000, 106}, {0x0000,  86}, {0x0000,  86}, {0x0000,  80},
-    {0x0000,  91}, {0x0000,  79}, {0x0000,  73}, {0x0000,  77},
-    {0x0000,  71}, {0x0000,  60}, {0x0000,  56}, {0x0000,  43},
-    {0x0000,  37}, {0x0000,  41}, {0x0000,  25}, {0x0000,  14},
-    {0x0000,  15}, {0x0000,  17}, {0x0000,  18}, {0x0000,   8},
-    {0x0000,   8}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   3}, {0x0000,   1}, {0x0000,   3}, {0x0000,   1},
-    {0x0000,   4}, {0x0000,   4}, {0x0000,   4}, {0x0000,   6},
-    {0x0000,   8}, {0x0000,   8}, {0x0000,  12}, {0x0000,  11},
-    {0x0000,   8}, {0x0000,   7}, {0x0000,   5}, {0x0000,   7},
-    {0x0000,   9}, {0x0000,   7}, {0x3124,  59}, {0x3104, 204},
-    {0x3124,  46}, {0x2082,  14}, {0x0000,   6}, {0x0000,   7},
-    {0x0000,   5}, {0x0000,  11}, {0x0000,  23}, {0x0000,  28},
-    {0x0000,  54}, {0x0000,  50}, {0x0000,  73}, {0x0000,  83},
-    {0x0000,  80}, {0x0000,  68}, {0x0000,  82}, {0x0000,  84},
-    {0x0000,  67}, {0x0000,  84}, {0x0000,  57}, {0x0000,  69},
-    {0x0000,  61}, {0x0000,  56}, {0x0000,  59}, {0x0000,  50},
-    {0x0000,  53}, {0x0000,  40}, {0x0000,  42}, {0x0000,  38},
-    {0x0000,  37}, {0x0000,  25}, {0x0000,  22}, {0x0000,  16},
-    {0x0000,  16}, {0x0000,  19}, {0x0000,   8}, {0x0000,  13},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   2}, {0x0000,   2},
-    {0x0000,   2}, {0x0000,   3}, {0x0000,   4}, {0x0000,   2},
-    {0x0000,   3}, {0x0000,   5}, {0x0000,   7}, {0x0000,   6},
-    {0x0000,   8}, {0x0000,   9}, {0x0000,   9}, {0x0000,   5},
-    {0x0000,   9}, {0x0000,   8}, {0x0000,   7}, {0x0000,   8},
-    {0x10A2,  12}, {0x4208,  84}, {0x3145, 221}, {0x4186, 200},
-    {0x3945, 139}, {0x3965,  81}, {0x4186,  35}, {0x3124,  14},
-    {0x0000,  10}, {0x0000,  15}, {0x0000,  39}, {0x0000,  52},
-    {0x0000,  67}, {0x0000,  71}, {0x0000,  75}, {0x0000,  72},
-    {0x0000,  80}, {0x0000,  74}, {0x0000,  64}, {0x0000,  67},
-    {0x0000,  57}, {0x0000,  44}, {0x0000,  53}, {0x0000,  44},
-    {0x0000,  37}, {0x0000,  45}, {0x0000,  43}, {0x0000,  43},
-    {0x0000,  44}, {0x0000,  27}, {0x0000,  27}, {0x0000,  26},
-    {0x0000,  26}, {0x0000,  19}, {0x0000,   9}, {0x0000,  17},
-    {0x0000,   6}, {0x0000,   9}, {0x0000,   4}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   3}, {0x0000,   1}, {0x0000,   2},
-    {0x0000,   2}, {0x0000,   2}, {0x0000,   4}, {0x0000,   4},
-    {0x0000,   3}, {0x0000,   3}, {0x0000,   5}, {0x0000,   3},
-    {0x0000,   4}, {0x0000,   7}, {0x0000,   5}, {0x0000,   4},
-    {0x0000,   6}, {0x0000,   4}, {0x0000,   7}, {0x3124,  20},
-    {0x4208, 176}, {0x41A7, 226}, {0x41A6, 238}, {0x3965, 212},
-    {0x3965, 205}, {0x41A6, 199}, {0x3124, 129}, {0x0000,  57},
-    {0x0000,  84}, {0x0000,  69}, {0x0000,  84}, {0x0000,  77},
-    {0x0000,  72}, {0x0000,  56}, {0x0000,  56}, {0x0000,  60},
-    {0x0000,  44}, {0x0000,  47}, {0x0000,  42}, {0x0000,  42},
-    {0x0000,  42}, {0x0000,  39}, {0x0000,  30}, {0x0000,  30},
-    {0x0000,  25}, {0x0000,  27}, {0x0000,  21}, {0x0000,  17},
-    {0x0000,  20}, {0x0000,  21}, {0x0000,  13}, {0x0000,  10},
-    {0x0000,  12}, {0x0000,   7}, {0x0000,   7}, {0x0000,   4},
-    {0x0000,   3}, {0x0000,   5}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   2}, {0x0000,   0}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   3}, {0x0000,   1}, {0x0000,   2}, {0x0000,   5},
-    {0x0000,   4}, {0x0000,   4}, {0x0000,   4}, {0x0000,   5},
-    {0x0000,   5}, {0x0000,   6}, {0x0000,   5}, {0x0000,   4},
-    {0x0000,   8}, {0x0000,   7}, {0x2104,  15}, {0x3165,  80},
-    {0x1882, 145}, {0x1082, 172}, {0x2945, 170}, {0x3986, 204},
-    {0x3125, 191}, {0x20C3, 129}, {0x0000,  75}, {0x0000,  61},
-    {0x0000,  54}, {0x0000,  63}, {0x0000,  59}, {0x0000,  58},
-    {0x0000,  48}, {0x0000,  30}, {0x0000,  18}, {0x0000,  32},
-    {0x0000,  33}, {0x0000,  20}, {0x0000,  26}, {0x0000,  30},
-    {0x0000,  16}, {0x0000,  30}, {0x0000,  18}, {0x0000,  20},
-    {0x0000,  20}, {0x0000,  11}, {0x0000,   8}, {0x0000,   2},
-    {0x0000,  10}, {0x0000,   4}, {0x0000,   1}, {0x0000,   4},
-    {0x0000,   3}, {0x0000,   1}, {0x0000,   3}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   3}, {0x0000,   2}, {0x0000,   3}, {0x0000,   3},
-    {0x0000,   3}, {0x0000,   3}, {0x0000,   4}, {0x0000,   3},
-    {0x0000,   4}, {0x0000,   3}, {0x0000,   3}, {0x0000,   3},
-    {0x0000,   2}, {0x0000,   5}, {0x0000,   5}, {0x0000,   4},
-    {0x0000,   5}, {0x0000,   9}, {0x0000,  12}, {0x0000,  46},
-    {0x0000,  48}, {0x0841,  51}, {0x0841,  66}, {0x0820,  72},
-    {0x0000,  46}, {0x0000,  33}, {0x0000,  27}, {0x0000,  30},
-    {0x0000,  27}, {0x0000,  27}, {0x0000,  35}, {0x0000,  15},
-    {0x0000,  19}, {0x0000,  10}, {0x0000,  15}, {0x0000,  14},
-    {0x0000,  15}, {0x0000,  16}, {0x0000,  17}, {0x0000,  20},
-    {0x0000,   9}, {0x0000,  15}, {0x0000,   9}, {0x0000,   5},
-    {0x0000,   3}, {0x0000,   7}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   2}, {0x0000,   2}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   4}, {0x0000,   3},
-    {0x0000,   2}, {0x0000,   2}, {0x0000,   3}, {0x0000,   4},
-    {0x0000,   3}, {0x0000,   2}, {0x0000,   5}, {0x0000,   2},
-    {0x0000,   3}, {0x0000,   5}, {0x0000,   4}, {0x0000,   4},
-    {0x0000,   3}, {0x0000,   7}, {0x0000,  10}, {0x0000,  10},
-    {0x0000,   9}, {0x0000,   9}, {0x0000,   9}, {0x0000,  15},
-    {0x0000,  18}, {0x0000,  13}, {0x0000,  24}, {0x0000,  13},
-    {0x0000,  10}, {0x0000,   9}, {0x0000,  14}, {0x0000,  14},
-    {0x0000,  13}, {0x0000,  12}, {0x0000,  14}, {0x0000,   9},
-    {0x0000,   8}, {0x0000,  10}, {0x0000,   7}, {0x0000,   5},
-    {0x0000,   5}, {0x0000,   3}, {0x0000,   1}, {0x0000,   3},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   2}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   2}, {0x0000,   3}, {0x0000,   1},
-    {0x0000,   2}, {0x0000,   3}, {0x0000,   2}, {0x0000,   3},
-    {0x0000,   2}, {0x0000,   2}, {0x0000,   5}, {0x0000,   2},
-    {0x0000,   3}, {0x0000,   4}, {0x0000,   4}, {0x0000,   6},
-    {0x0000,   4}, {0x0000,   5}, {0x0000,   4}, {0x0000,   5},
-    {0x0000,   9}, {0x0000,   8}, {0x0000,  11}, {0x0000,  11},
-    {0x0000,   9}, {0x0000,  19}, {0x0000,  20}, {0x0000,  21},
-    {0x0000,   5}, {0x0000,  14}, {0x0000,  14}, {0x0000,  11},
-    {0x0000,   8}, {0x0000,   1}, {0x0000,   2}, {0x0000,   3},
-    {0x0000,   9}, {0x0000,   3}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   2}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   1},
-    {0x0000,   0}, {0x0000,   1}, {0x0000,   1}, {0x0000,   1},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   2},
-    {0x0000,   0}, {0x0000,   2}, {0x0000,   2}, {0x0000,   2},
-    {0x0000,   1}, {0x0000,   4}, {0x0000,   1}, {0x0000,   5},
-    {0x0000,   2}, {0x0000,   4}, {0x0000,   3}, {0x0000,   3},
-    {0x0000,   2}, {0x0000,   6}, {0x0000,   4}, {0x0000,   2},
-    {0x0000,   6}, {0x0000,   4}, {0x0000,   4}, {0x0000,   5},
-    {0x0000,   2}, {0x0000,   3}, {0x0000,   4}, {0x0000,   5},
-    {0x0000,   5}, {0x0000,   6}, {0x0000,   4}, {0x0000,   6},
-    {0x0000,   4}, {0x0000,   4}, {0x0000,   4}, {0x0000,   1},
-    {0x0000,   4}, {0x0000,   1}, {0x0000,   2}, {0x0000,   3},
-    {0x0000,   0}, {0x0000,   2}, {0x0000,   2}, {0x0000,   2},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   1}, {0x0000,   1}, {0x0000,   1}, {0x0000,   0},
-    {0x0000,   2}, {0x0000,   1}, {0x0000,   0}, {0x0000,   2},
-    {0x0000,   1}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0},
+inline constexpr uint16_t skeleton_alpha_color[2537] = {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x52AA,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4229,0x5249,0x5249,0x49E8,0x4986,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x4A4D,0x4A6A,0x5269,0x4A28,0x41E7,0x4186,0x39C7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4209,0x4229,0x4A29,0x49E8,
+    0x41C7,0x3945,0x3945,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4A08,0x41E7,0x3186,0x39A6,0x3966,0x3945,0x3924,0x4145,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x3186,0x39A7,0x3165,0x39A6,0x3165,0x3145,0x3124,0x3124,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x31A6,0x39A7,0x39E7,0x3965,0x39A7,
+    0x2924,0x28E3,0x10A2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x4A49,0x39C7,0x4A08,0x41A6,0x3924,0x3965,0x3165,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x4A69,0x4A49,0x41C7,0x3986,0x3965,0x3945,0x4165,0x4986,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4B6D,0x426A,0x4A28,0x3966,0x3965,0x3945,
+    0x3945,0x3924,0x3145,0x3124,0x4986,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x3A28,0x39E8,0x39A7,0x3124,0x3124,0x3945,0x3104,0x3145,0x2904,0x3104,0x3965,
+    0x41A6,0x3000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x39E8,0x39E8,0x41C7,0x3924,0x3945,0x3965,0x0000,0x2124,0x0000,0x2924,0x3144,0x3965,0x3965,0x3186,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8410,0x4208,0x4208,0x41C7,0x3965,0x3124,
+    0x3924,0x3944,0x0000,0x0000,0x0000,0x3124,0x2945,0x3145,0x52AA,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x4A28,0x41E8,0x41C7,0x39A6,0x3965,0x3124,0x3104,0x3123,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3186,0x5229,
+    0x4A49,0x39E8,0x39A6,0x3145,0x3124,0x2904,0x28E3,0x4208,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4A49,0x4A29,0x41E7,0x2124,0x39E8,0x41E8,0x3986,0x3104,
+    0x28E3,0x38E3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x52AA,0x39A6,0x41E7,0x3186,0x0000,0x4228,0x39A7,0x39E7,0x4186,0x28E3,0x3124,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3165,0x3145,
+    0x4104,0x0000,0x4208,0x4229,0x39E7,0x3165,0x2904,0x3945,0x3924,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x41A6,0x3965,0x3145,0x0000,0x3186,0x31A6,0x41E7,
+    0x3986,0x2904,0x3145,0x3144,0x2104,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x3165,0x3124,0x4208,0x0000,0x2104,0x3186,0x3144,0x3144,0x31A6,0x3965,0x3924,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x3966,0x3124,0x3124,0x0000,0x0000,0x2000,0x2904,0x3145,0x3986,0x39C7,0x3945,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4208,0x3986,0x3124,0x3904,0x4200,
+    0x0000,0x41E7,0x39C7,0x3986,0x3986,0x3104,0x3000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2945,0x3145,0x3124,0x3924,0x2965,0x4228,0x41E8,0x39C7,0x3166,0x3945,
+    0x3145,0x2124,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x2965,0x20E3,0x2904,0x2924,0x41E8,0x41C7,0x41C7,0x3986,0x2965,0x2124,0x3165,0x4186,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x18E7,0x39E7,0x4208,
+    0x41E7,0x41E7,0x3166,0x0000,0x0000,0x0000,0x41C7,0x41C7,0x4165,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4208,0x4208,0x4A28,0x41E8,0x3986,0x3104,0x0000,0x0000,0x0000,
+    0x0000,0x39E8,0x41E7,0x4186,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x3124,0x526A,0x4A29,0x41E7,0x39A6,0x2104,0x0000,0x0000,0x0000,0x0000,0x0000,0x39A7,0x39A6,0x3945,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4ACB,0x4A29,0x41A7,0x3965,
+    0x3924,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2945,0x2945,0x2903,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2104,0x3145,0x3104,0x3124,0x3104,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x2924,0x2924,0x20A2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x1041,0x2904,0x20E3,0x0000,0x0000,0x0000,0x0000,0x0000,0x2925,0x3124,0x1082,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0820,0x1882,0x0000,0x0000,0x0000,0x0000,0x0000,0x2924,0x3145,0x18A2,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0800,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x2945,0x3124,0x2904,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3124,0x3104,
+    0x3124,0x2082,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x10A2,0x4208,0x3145,0x4186,0x3945,0x3965,0x4186,0x3124,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x3124,0x4208,0x41A7,0x41A6,0x3965,0x3965,0x41A6,0x3124,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2104,0x3165,
+    0x1882,0x1082,0x2945,0x3986,0x3125,0x20C3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0841,0x0841,0x0820,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
 };
 
+inline constexpr uint8_t skeleton_alpha_alpha[2537] = {
+      1,  0,  1,  1,  0,  0,  1,  0,  1,  0,  0,  1,  0,  0,  0,  1,
+      1,  0,  1,  1,  1,  2,  1,  1,  0,  0,  1,  1,  1,  0,  0,  0,
+      1,  1,  0,  1,  1,  0,  0,  0,  1,  0,  1,  0,  0,  1,  0,  1,
+      0,  0,  1,  1,  0,  1,  0,  0,  0,  0,  0,  1,  1,  1,  1,  0,
+      1,  0,  1,  1,  1,  0,  0,  1,  0,  0,  1,  1,  1,  1,  3,  1,
+      0,  1,  1,  0,  1,  1,  1,  0,  0,  1,  1,  1,  0,  0,  1,  0,
+      1,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+      0,  1,  1,  0,  0,  0,  1,  1,  0,  0,  1,  1,  1,  1,  0,  0,
+      0,  1,  1,  0,  1,  0,  1, 26,106,142, 80, 10,  1,  0,  0,  0,
+      0,  1,  1,  0,  0,  1,  0,  0,  1,  1,  0,  0,  1,  0,  0,  0,
+      1,  0,  0,  1,  0,  1,  0,  1,  1,  0,  0,  0,  0,  0,  0,  0,
+      0,  1,  0,  1,  1,  1,  0,  1,  1,  0,  1,  1,  1,  0,  0,  1,
+      1,  7,169,249,255,239,128,  9,  0,  1,  0,  1,  0,  0,  0,  0,
+      0,  0,  1,  0,  0,  0,  0,  1,  1,  1,  0,  0,  1,  0,  0,  0,
+      0,  1,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,
+      0,  1,  1,  0,  0,  0,  1,  1,  1,  1,  1,  0, 24,211,255,255,
+    255,217, 30,  1,  1,  0,  0,  1,  0,  0,  1,  1,  1,  0,  1,  1,
+      0,  1,  0,  0,  1,  1,  1,  0,  0,  1,  2,  0,  0,  0,  0,  1,
+      1,  1,  1,  0,  0,  0,  0,  1,  1,  0,  1,  1,  0,  1,  1,  0,
+      0,  0,  0,  1,  1,  0, 28,120,227,255,255,255,211, 24,  0,  0,
+      0,  2,  0,  0,  0,  0,  1,  0,  2,  1,  1,  1,  1,  0,  1,  1,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,
+      0,  0,  1,  1,  1,  0,  1,  1,  1,  1,  0,  1,  1,  1,  1,  0,
+     15,185,251,247,233,251,245, 92,  2,  0,  0,  1,  0,  0,  0,  0,
+      0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  1,  1,
+      0,  0,  0,  0,  0,  1,  1,  0,  1,  0,  0,  0,  0,  0,  1,  1,
+      0,  1,  1,  1,  0,  1,  0,  0,  0,  0,  1, 64,239,237,211,144,
+    145,151, 25,  0,  1,  0,  1,  1,  0,  0,  1,  0,  0,  2,  1,  1,
+      1,  0,  1,  1,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  1,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  1,  1,  0,  0,  1,
+      1,  1,  1,  0,  0,  7,138,251,219,185,193, 28,  3,  1,  1,  0,
+      1,  1,  0,  1,  1,  1,  1,  0,  0,  1,  0,  0,  1,  0,  2,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0,  0,  1,  0,
+      1,  0,  0,  1,  1,  1,  0,  1,  1,  1,  0,  1,  2,  0,  1,  1,
+     62,225,249,231,233,229, 70, 10,  3,  1,  0,  1,  0,  1,  0,  0,
+      0,  1,  0,  1,  1,  1,  1,  1,  1,  1,  0,  0,  1,  0,  1,  0,
+      1,  0,  0,  0,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+      0,  0,  1,  1,  2,  0,  0,  2,  3,  1,  7,140,249,235,233,237,
+    241,136,140, 61, 10,  2,  2,  1,  1,  0,  1,  1,  1,  0,  2,  1,
+      1,  1,  1,  0,  0,  1,  1,  0,  1,  0,  1,  0,  1,  0,  0,  0,
+      0,  0,  1,  0,  1,  0,  0,  0,  0,  1,  1,  1,  0,  1,  1,  0,
+      1,  1,  2,  1,  1, 22,213,255,211,169,229,223, 37, 54,154,137,
+     44,  5,  1,  1,  0,  1,  0,  1,  1,  2,  2,  1,  1,  0,  1,  1,
+      0,  0,  0,  2,  0,  1,  1,  0,  1,  0,  1,  1,  0,  0,  1,  1,
+      0,  0,  0,  0,  0,  1,  0,  0,  1,  0,  0,  0,  2,  1,  1,  0,
+     30,221,253,211,151,221,  0, 14,  1, 34,154,163, 83,  5,  1,  1,
+      1,  1,  1,  1,  0,  1,  1,  2,  0,  0,  2,  1,  1,  0,  1,  1,
+      1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  1,
+      0,  1,  0,  1,  1,  1,  1,  0,  1,  1,  2, 48,221,255,241,231,
+    233, 96,  1,  1,  1, 35, 51, 36,  3,  1,  1,  0,  1,  1,  1,  1,
+      1,  1,  1,  1,  0,  1,  1,  0,  1,  1,  0,  1,  0,  0,  0,  0,
+      1,  0,  1,  0,  1,  0,  0,  0,  0,  0,  1,  0,  1,  2,  1,  0,
+      2,  1,  1,  0,  2, 48,112,235,255,255,251,175, 21,  1,  1,  2,
+      0,  0,  1,  1,  2,  1,  3,  0,  1,  1,  0,  1,  2,  1,  2,  1,
+      2,  1,  0,  1,  1,  0,  1,  0,  1,  0,  0,  2,  0,  0,  1,  0,
+      0,  1,  0,  0,  0,  2,  1,  2,  0,  2,  1,  1,  1,  2, 10, 75,
+     78, 38,218,249,255,223, 58,  4,  2,  1,  1,  1,  2,  1,  1,  1,
+      1,  1,  2,  1,  1,  1,  1,  1,  1,  0,  1,  1,  0,  0,  1,  1,
+      1,  1,  1,  0,  2,  1,  1,  1,  0,  0,  0,  1,  0,  0,  0,  0,
+      1,  1,  0,  0,  0,  0,  1,  2, 31,139, 99,  7, 34,227,251,241,
+    157, 17,  2,  1,  3,  1,  1,  1,  1,  1,  0,  1,  1,  1,  0,  1,
+      2,  2,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  1,  1,  1,  1,
+      1,  1,  1,  0,  1,  0,  0,  1,  1,  0,  0,  1,  2,  0,  0,  1,
+      1,  1,  3,108,141, 21,  1, 22,203,247,172,155, 77,  1,  1,  1,
+      1,  2,  1,  2,  1,  2,  0,  2,  1,  0,  1,  1,  1,  0,  1,  2,
+      0,  1,  1,  1,  1,  1,  1,  0,  1,  1,  0,  0,  1,  1,  0,  0,
+      0,  1,  0,  0,  0,  0,  0,  1,  2,  1,  1,  1,  1,  1, 70,142,
+      8,  2, 16,192,247,198, 66,176, 27,  1,  1,  0,  1,  0,  1,  0,
+      1,  1,  0,  2,  1,  1,  1,  1,  1,  0,  1,  1,  2,  1,  1,  0,
+      0,  1,  1,  1,  1,  2,  1,  0,  2,  1,  1,  0,  0,  0,  0,  0,
+      0,  2,  0,  2,  1,  1,  1,  1,  1, 23,141, 32,  2, 10,134,234,
+    134, 24,178,120,  8,  1,  1,  1,  1,  1,  1,  2,  2,  1,  1,  2,
+      1,  2,  2,  1,  1,  2,  2,  1,  0,  1,  1,  1,  1,  0,  0,  1,
+      0,  1,  1,  1,  1,  1,  0,  0,  1,  0,  0,  0,  1,  3,  1,  1,
+      1,  1,  2,  0,  4, 87, 85,  4,  3, 15,119,196,103,118,213, 50,
+      1,  2,  2,  2,  2,  1,  2,  2,  2,  2,  2,  1,  1,  0,  2,  1,
+      1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  1,  1,  0,  1,  0,  0,
+      1,  1,  0,  0,  0,  0,  0,  1,  0,  3,  0,  1,  2,  2,  2,  2,
+     35,135, 21,  3,  2,  7, 44,168,189,231,136,  2,  2,  1,  2,  1,
+      1,  2,  2,  1,  2,  2,  2,  3,  2,  1,  2,  1,  0,  2,  1,  0,
+      1,  1,  0,  0,  1,  1,  2,  1,  1,  2,  0,  1,  1,  2,  0,  1,
+      0,  0,  2,  2,  0,  2,  2,  0,  1,  2,  1, 40,192,111, 36,  4,
+      1, 30,138,223,237,109,  5,  3,  2,  1,  1,  2,  2,  1,  0,  4,
+      1,  1,  2,  1,  2,  2,  1,  1,  1,  3,  3,  1,  2,  1,  0,  0,
+      0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  0,  0,  1,  1,  3,
+      2,  2,  4,  3,  2,  2, 43,143,122, 40, 11, 52,140,181,158,156,
+     83,  7,  3,  1,  1,  2,  2,  2,  2,  3,  2,  2,  1,  2,  1,  3,
+      1,  8,  4,  4,  6,  6,  4,  6,  3,  0,  1,  1,  3,  1,  0,  1,
+      0,  0,  0,  0,  0,  1,  0,  0,  1,  1,  1,  1,  2,  2,  2,  2,
+      1, 23, 73,108, 34, 66,176,159, 65, 11, 28,152, 75,  4,  2,  3,
+      2,  4,  2,  3,  3,  2,  1,  1,  3,  2,  4,  6,  7,  5, 12, 12,
+     16, 11, 12, 10, 16,  6,  6,  3,  3,  3,  5,  1,  2,  0,  0,  0,
+      1,  0,  0,  2,  3,  2,  4,  4,  3,  4,  1,  3,  3,  9, 29,116,
+    196,125, 23,  3,  3,  5, 84,203, 28,  2,  3,  3,  1,  2,  1,  2,
+      2,  1,  4,  3,  8,  5, 14, 16, 17, 11, 21, 16, 13, 19, 19, 19,
+      8, 13, 10, 14,  9,  7,  9,  5,  5,  3,  2,  2,  0,  0,  1,  1,
+      2,  2,  4,  2,  1,  4,  3,  4, 20,140,210,109, 15,  3,  4,  5,
+      3, 82,241,109,  3,  4,  3,  4,  3,  3,  4,  3,  2,  5,  8,  7,
+     12, 16, 14, 18, 24, 30, 26, 20, 33, 26, 26, 15, 23, 20, 13, 15,
+     10, 12, 12,  9,  6,  6,  4,  0,  0,  1,  2,  2,  1,  2,  2,  4,
+      4, 14,118,164,233,108,  8,  8,  5,  2,  5,  5,105,239,112,  5,
+      3,  3,  3,  4,  1,  5,  4,  3,  8, 10, 21, 10, 28, 30, 30, 35,
+     44, 40, 41, 45, 40, 37, 37, 30, 23, 29, 25, 29, 18,  9, 15,  6,
+      9, 11,  0,  0,  2,  2,  3,  4,  3,  3,  3,  3, 20,179,215,223,
+     52,  4,  6,  5,  5,  4,  8, 81,225, 72,  5,  9,  3,  7, 13, 27,
+     19, 15, 17, 24, 25, 41, 38, 41, 46, 54, 49, 51, 54, 62, 59, 50,
+     52, 57, 36, 44, 36, 29, 25, 22, 20, 14, 15,  8,  6,  0,  0,  2,
+      2,  4,  1,  3,  2,  3,  4,  8, 19, 36,123, 98, 11,  8,  7,  9,
+     13,  7, 78,207, 45, 21, 28, 32, 53, 43, 53, 52, 66, 60, 53, 55,
+     52, 61, 66, 67, 56, 76, 72, 79, 76, 65, 59, 57, 59, 58, 54, 41,
+     34, 31, 26, 21, 12, 11, 16, 16,  0,  0,  2,  1,  3,  2,  4,  4,
+      4,  4,  8,  8,  7, 30,130, 97, 47, 47, 51, 49, 66,100,212, 62,
+     52, 46, 54, 56, 70, 71, 86, 73, 66, 64, 59, 74, 65, 77, 67, 78,
+     82, 88, 67, 70, 89, 75, 65, 64, 74, 55, 46, 44, 27, 20, 12, 12,
+     16, 13, 10,  0,  0,  3,  3,  3,  2,  3,  4,  6,  7,  6, 10, 16,
+     24, 79,137,114,100, 78, 59, 61, 97,195, 49, 31, 17, 35, 35, 44,
+     43, 54, 63, 79, 77, 72, 78, 80, 98, 89, 97, 95, 84, 73, 84, 94,
+     74, 74, 63, 66, 51, 42, 27, 27, 27, 18, 15, 19, 14, 12,  0,  0,
+      2,  2,  2,  2,  1,  3,  3,  7,  4, 10, 11, 12, 20, 27, 22, 27,
+     23, 16,  8, 61,196, 24, 11,  7,  6, 10, 12, 25, 33, 48, 58, 58,
+     84, 84, 85, 94,106, 86, 86, 80, 91, 79, 73, 77, 71, 60, 56, 43,
+     37, 41, 25, 14, 15, 17, 18,  8,  8,  0,  0,  1,  3,  1,  3,  1,
+      4,  4,  4,  6,  8,  8, 12, 11,  8,  7,  5,  7,  9,  7, 59,204,
+     46, 14,  6,  7,  5, 11, 23, 28, 54, 50, 73, 83, 80, 68, 82, 84,
+     67, 84, 57, 69, 61, 56, 59, 50, 53, 40, 42, 38, 37, 25, 22, 16,
+     16, 19,  8, 13,  0,  0,  2,  2,  2,  3,  4,  2,  3,  5,  7,  6,
+      8,  9,  9,  5,  9,  8,  7,  8, 12, 84,221,200,139, 81, 35, 14,
+     10, 15, 39, 52, 67, 71, 75, 72, 80, 74, 64, 67, 57, 44, 53, 44,
+     37, 45, 43, 43, 44, 27, 27, 26, 26, 19,  9, 17,  6,  9,  4,  0,
+      0,  3,  1,  2,  2,  2,  4,  4,  3,  3,  5,  3,  4,  7,  5,  4,
+      6,  4,  7, 20,176,226,238,212,205,199,129, 57, 84, 69, 84, 77,
+     72, 56, 56, 60, 44, 47, 42, 42, 42, 39, 30, 30, 25, 27, 21, 17,
+     20, 21, 13, 10, 12,  7,  7,  4,  3,  5,  0,  0,  2,  0,  2,  1,
+      3,  1,  2,  5,  4,  4,  4,  5,  5,  6,  5,  4,  8,  7, 15, 80,
+    145,172,170,204,191,129, 75, 61, 54, 63, 59, 58, 48, 30, 18, 32,
+     33, 20, 26, 30, 16, 30, 18, 20, 20, 11,  8,  2, 10,  4,  1,  4,
+      3,  1,  3,  0,  0,  0,  0,  1,  3,  2,  3,  3,  3,  3,  4,  3,
+      4,  3,  3,  3,  2,  5,  5,  4,  5,  9, 12, 46, 48, 51, 66, 72,
+     46, 33, 27, 30, 27, 27, 35, 15, 19, 10, 15, 14, 15, 16, 17, 20,
+      9, 15,  9,  5,  3,  7,  2,  1,  2,  2,  2,  1,  1,  0,  1,  0,
+      0,  0,  1,  1,  2,  1,  4,  3,  2,  2,  3,  4,  3,  2,  5,  2,
+      3,  5,  4,  4,  3,  7, 10, 10,  9,  9,  9, 15, 18, 13, 24, 13,
+     10,  9, 14, 14, 13, 12, 14,  9,  8, 10,  7,  5,  5,  3,  1,  3,
+      2,  1,  1,  1,  1,  1,  1,  1,  1,  0,  1,  0,  0,  2,  1,  1,
+      1,  2,  3,  1,  2,  3,  2,  3,  2,  2,  5,  2,  3,  4,  4,  6,
+      4,  5,  4,  5,  9,  8, 11, 11,  9, 19, 20, 21,  5, 14, 14, 11,
+      8,  1,  2,  3,  9,  3,  1,  1,  1,  2,  1,  1,  1,  1,  0,  1,
+      0,  1,  1,  1,  1,  1,  0,  0,  1,  1,  1,  2,  0,  2,  2,  2,
+      1,  4,  1,  5,  2,  4,  3,  3,  2,  6,  4,  2,  6,  4,  4,  5,
+      2,  3,  4,  5,  5,  6,  4,  6,  4,  4,  4,  1,  4,  1,  2,  3,
+      0,  2,  2,  2,  1,  1,  1,  0,  1,  1,  1,  0,  2,  1,  0,  2,
+      1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+inline constexpr Sprite_planes skeleton_alpha_sprite = {skeleton_alpha_width, skeleton_alpha_height, skeleton_alpha_color, skeleton_alpha_alpha};
+
 #endif // SPRITE_SKELETON_ALPHA_H
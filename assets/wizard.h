@@ -1,1041 +1,534 @@
 // Auto-generated from assets/wizard.sprite
 // Sprite dimensions: 64x64
-// Format: RGB565 + Alpha8 (3 bytes per pixel)
+// Format: RGB565 plane + Alpha8 plane (3 bytes per pixel)
 
 #ifndef SPRITE_WIZARD_H
 #define SPRITE_WIZARD_H
 
 #include <stdint.h>
-#include "framebuffer.h"  // For SpritePixel definition
+#include "framebuffer.h"  // For Sprite_planes definition
 
-const uint16_t wizard_width = 64;
-const uint16_t wizard_height = 64;
+inline constexpr uint16_t wizard_width = 64;
+inline constexpr uint16_t wizard_height = 64;
 
-const SpritePixel wizard_data[4096] = {
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0845, 255}, {0x41CC, 255},
-    {0x41CC, 255}, {0x2847, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x0845, 255}, {0x41CC, 255}, {0x41CC, 255},
-    {0x290A, 255}, {0x41CC, 255}, {0x41CC, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x41CC, 255}, {0x41CC, 255}, {0x290A, 255},
-    {0x41CC, 255}, {0x41CC, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0845, 255},
-    {0x41CC, 255}, {0x290A, 255}, {0x41CC, 255}, {0x41CC, 255},
-    {0x41CC, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x1087, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0845, 255}, {0x0845, 255},
-    {0x41CC, 255}, {0x41CC, 255}, {0x41CC, 255}, {0x41CC, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x1087, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0845, 255}, {0x41CC, 255},
-    {0x41CC, 255}, {0x290A, 255}, {0x41CC, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x0845, 255}, {0x41CC, 255},
-    {0x290A, 255}, {0x41CC, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x41CC, 255}, {0x41CC, 255},
-    {0x41CC, 255}, {0x290A, 255}, {0x290A, 255}, {0x290A, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x41CC, 255}, {0x41CC, 255},
-    {0x41CC, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x41CC, 255}, {0x290A, 255},
-    {0x41CC, 255}, {0x41CC, 255}, {0x290A, 255}, {0x290A, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x41CC, 255}, {0x41CC, 255}, {0x41CC, 255}, {0x41CC, 255},
-    {0x41CC, 255}, {0x41CC, 255}, {0x41CC, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0845, 255},
-    {0x0845, 255}, {0x61C2, 255}, {0x61C2, 255}, {0x61C2, 255},
-    {0x61C2, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0845, 255},
-    {0x0845, 255}, {0x41CC, 255}, {0x41CC, 255}, {0x290A, 255},
-    {0x41CC, 255}, {0x41CC, 255}, {0x290A, 255}, {0x41CC, 255},
-    {0x41CC, 255}, {0x41CC, 255}, {0x290A, 255}, {0x41CC, 255},
-    {0x290A, 255}, {0x290A, 255}, {0x290A, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0845, 255}, {0x0845, 255},
-    {0x61C2, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x61C2, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x0845, 255}, {0x41CC, 255},
-    {0x290A, 255}, {0x290A, 255}, {0x41CC, 255}, {0x41CC, 255},
-    {0x41CC, 255}, {0x41CC, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x0845, 255}, {0x61C2, 255},
-    {0x61C2, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0000,   0}, {0x0845, 255}, {0x290A, 255}, {0x41CC, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x1064, 255},
-    {0x1064, 255}, {0x1064, 255}, {0x1064, 255}, {0x1064, 255},
-    {0x1064, 255}, {0x1064, 255}, {0x1064, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x61C2, 255}, {0x61C2, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x61C2, 255}, {0x61C2, 255},
-    {0x0845, 255}, {0x61C2, 255}, {0x61C2, 255}, {0x0845, 255},
-    {0x0000,   0}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x1064, 255}, {0xDED0, 255},
-    {0xDED0, 255}, {0x1064, 255}, {0x1064, 255}, {0x1064, 255},
-    {0xDED0, 255}, {0xDED0, 255}, {0x1064, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x61C2, 255}, {0x0845, 255},
-    {0x61C2, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x61C2, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x1064, 255}, {0x1064, 255},
-    {0x1064, 255}, {0x1064, 255}, {0x41AB, 255}, {0x1064, 255},
-    {0x1064, 255}, {0x1064, 255}, {0x1064, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x61C2, 255}, {0x61C2, 255}, {0x0845, 255}, {0x61C2, 255},
-    {0x61C2, 255}, {0x0845, 255}, {0x0845, 255}, {0x61C2, 255},
-    {0x0845, 255}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x1064, 255}, {0x1064, 255},
-    {0x41AB, 255}, {0x41AB, 255}, {0x41AB, 255}, {0x41AB, 255},
-    {0x41AB, 255}, {0x41AB, 255}, {0x1064, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x61C2, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x61C2, 255},
-    {0x61C2, 255}, {0x0845, 255}, {0x61C2, 255}, {0x61C2, 255},
-    {0x0845, 255}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x41AB, 255}, {0x41AB, 255},
-    {0x963A, 255}, {0xD7BF, 255}, {0x963A, 255}, {0x41AB, 255},
-    {0x41AB, 255}, {0x6C31, 255}, {0x41AB, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x0845, 255}, {0x61C2, 255}, {0x61C2, 255},
-    {0x0845, 255}, {0x61C2, 255}, {0x61C2, 255}, {0x61C2, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x61C2, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x41AB, 255}, {0x6C31, 255},
-    {0x963A, 255}, {0xD7BF, 255}, {0x963A, 255}, {0xD7BF, 255},
-    {0xD7BF, 255}, {0x6C31, 255}, {0xD7BF, 255}, {0x326A, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x0845, 255}, {0x61C2, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x61C2, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0xD7BF, 255}, {0x6C31, 255},
-    {0xD7BF, 255}, {0x1064, 255}, {0x1064, 255}, {0xD7BF, 255},
-    {0xD7BF, 255}, {0xD7BF, 255}, {0xD7BF, 255}, {0x326A, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0845, 255}, {0x0845, 255},
-    {0x61C2, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x61C2, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0xD7BF, 255}, {0xD7BF, 255},
-    {0xD7BF, 255}, {0x1064, 255}, {0x1064, 255}, {0x1064, 255},
-    {0xD7BF, 255}, {0xD7BF, 255}, {0xD7BF, 255}, {0x326A, 255},
-    {0x1064, 255}, {0x18A7, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0845, 255},
-    {0x61C2, 255}, {0x61C2, 255}, {0x61C2, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x0845, 255}, {0xD7BF, 255}, {0x963A, 255},
-    {0x6493, 255}, {0xD7BF, 255}, {0xD7BF, 255}, {0x6493, 255},
-    {0xD7BF, 255}, {0x963A, 255}, {0xD7BF, 255}, {0xD7BF, 255},
-    {0x1064, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0845, 255},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x963A, 255}, {0x963A, 255},
-    {0xD7BF, 255}, {0xD7BF, 255}, {0xD7BF, 255}, {0x6493, 255},
-    {0xD7BF, 255}, {0x963A, 255}, {0x6C31, 255}, {0x963A, 255},
-    {0x1064, 255}, {0x18A7, 255}, {0x1066, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0845, 255},
-    {0x290A, 255}, {0x290A, 255}, {0x963A, 255}, {0x963A, 255},
-    {0x6493, 255}, {0xD7BF, 255}, {0x963A, 255}, {0x6493, 255},
-    {0xD7BF, 255}, {0x963A, 255}, {0x6C31, 255}, {0xD7BF, 255},
-    {0x1064, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x290A, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x963A, 255}, {0xD7BF, 255},
-    {0xD7BF, 255}, {0x6C31, 255}, {0x963A, 255}, {0xD7BF, 255},
-    {0xD7BF, 255}, {0x963A, 255}, {0x6C31, 255}, {0xD7BF, 255},
-    {0x1064, 255}, {0x0845, 255}, {0x0845, 255}, {0x290A, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x963A, 255}, {0xD7BF, 255},
-    {0xD7BF, 255}, {0x6C31, 255}, {0x963A, 255}, {0x6C31, 255},
-    {0xD7BF, 255}, {0xD7BF, 255}, {0x6C31, 255}, {0x1066, 255},
-    {0x1066, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x2045, 255}, {0x18A7, 255}, {0x1066, 255}, {0xD7BF, 255},
-    {0x6C31, 255}, {0xD7BF, 255}, {0xD7BF, 255}, {0x6C31, 255},
-    {0x6C31, 255}, {0xD7BF, 255}, {0xD7BF, 255}, {0x0845, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x290A, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x6C31, 255}, {0xD7BF, 255}, {0x963A, 255}, {0x6C31, 255},
-    {0x6C31, 255}, {0xD7BF, 255}, {0xD7BF, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0xA346, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x0845, 255}, {0x290A, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x6C31, 255}, {0xD7BF, 255}, {0x963A, 255}, {0x6C31, 255},
-    {0xD7BF, 255}, {0x963A, 255}, {0x290A, 255}, {0x290A, 255},
-    {0x1066, 255}, {0x1066, 255}, {0x1066, 255}, {0x1066, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0845, 255}, {0xA346, 255},
-    {0xA346, 255}, {0xA346, 255}, {0x0845, 255}, {0xA346, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0xD7BF, 255}, {0x6C31, 255},
-    {0xD7BF, 255}, {0x963A, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x290A, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x290A, 255},
-    {0x290A, 255}, {0x18A7, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x0845, 255}, {0xA346, 255},
-    {0xA346, 255}, {0xA346, 255}, {0x0845, 255}, {0xA346, 255},
-    {0x0845, 255}, {0x290A, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x41CC, 255}, {0x41CC, 255}, {0x290A, 255}, {0x41CC, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x41CC, 255},
-    {0x0845, 255}, {0x41CC, 255}, {0x0845, 255}, {0x6C31, 255},
-    {0x41CC, 255}, {0x41CC, 255}, {0x290A, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x290A, 255}, {0x290A, 255}, {0x18A7, 255},
-    {0x290A, 255}, {0x290A, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0xA346, 255}, {0xA346, 255},
-    {0xA346, 255}, {0xA346, 255}, {0xA346, 255}, {0xA346, 255},
-    {0x0845, 255}, {0x41CC, 255}, {0x41CC, 255}, {0x290A, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x41CC, 255},
-    {0x41CC, 255}, {0x18A7, 255}, {0x290A, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x290A, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x0845, 255}, {0x6C31, 255},
-    {0x41CC, 255}, {0x18A7, 255}, {0x290A, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x290A, 255}, {0x18A7, 255},
-    {0x290A, 255}, {0x41CC, 255}, {0x290A, 255}, {0x290A, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x0845, 255}, {0xA346, 255},
-    {0xA346, 255}, {0xA346, 255}, {0xA346, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x41CC, 255}, {0x290A, 255}, {0x290A, 255},
-    {0x41CC, 255}, {0x290A, 255}, {0x41CC, 255}, {0x41CC, 255},
-    {0x41CC, 255}, {0x18A7, 255}, {0x290A, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x290A, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x0845, 255}, {0x41CC, 255},
-    {0x41CC, 255}, {0x18A7, 255}, {0x290A, 255}, {0x0845, 255},
-    {0x290A, 255}, {0x0845, 255}, {0x290A, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x290A, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0845, 255}, {0xA346, 255},
-    {0xA346, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x290A, 255}, {0x41CC, 255},
-    {0x41CC, 255}, {0x41CC, 255}, {0x41CC, 255}, {0x18A7, 255},
-    {0x290A, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x290A, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x290A, 255}, {0x18A7, 255}, {0x290A, 255}, {0x0845, 255},
-    {0x290A, 255}, {0x0845, 255}, {0x290A, 255}, {0x0845, 255},
-    {0x290A, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x290A, 255},
-    {0x290A, 255}, {0x0845, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x41CC, 255}, {0x41CC, 255},
-    {0x290A, 255}, {0x41CC, 255}, {0x290A, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x290A, 255}, {0x0845, 255}, {0x290A, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x41CC, 255}, {0x18A7, 255}, {0x290A, 255}, {0x0845, 255},
-    {0x290A, 255}, {0x0845, 255}, {0x290A, 255}, {0x0845, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x290A, 255}, {0x290A, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x41CC, 255}, {0x41CC, 255},
-    {0x290A, 255}, {0x18A7, 255}, {0x290A, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x41CC, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x290A, 255}, {0x290A, 255}, {0x290A, 255}, {0x0845, 255},
-    {0x290A, 255}, {0x0845, 255}, {0x290A, 255}, {0x0845, 255},
-    {0x290A, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x290A, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x290A, 255}, {0x18A7, 255},
-    {0x290A, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x290A, 255}, {0x290A, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x290A, 255}, {0x18A7, 255},
-    {0x290A, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x290A, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x290A, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x41CC, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x290A, 255}, {0x18A7, 255},
-    {0x290A, 255}, {0x18A7, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0845, 255}, {0x290A, 255}, {0x290A, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x290A, 255}, {0x290A, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0xA346, 255}, {0xA346, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x290A, 255}, {0x18A7, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0xA346, 255},
-    {0xA346, 255}, {0xA346, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0000,   0}, {0x0000,   0}, {0x0845, 255},
-    {0x41CC, 255}, {0x290A, 255}, {0x0845, 255}, {0x290A, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x290A, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0xA346, 255}, {0xA346, 255},
-    {0xA346, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0845, 255},
-    {0x18A7, 255}, {0x290A, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x1065, 255}, {0x0845, 255}, {0x0845, 255}, {0xA346, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0845, 255}, {0x0845, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x1066, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0845, 255}, {0x41CC, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x18A7, 255}, {0x1065, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0845, 255}, {0x41CC, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x1065, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x1065, 255}, {0x1046, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x41CC, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x18A7, 255}, {0x1065, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x41CC, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0845, 255},
-    {0x290A, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x1066, 255}, {0x1066, 255}, {0x0845, 255},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0845, 255},
-    {0x290A, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x290A, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0845, 255}, {0x290A, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x290A, 255},
-    {0x290A, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x290A, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x290A, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0845, 255}, {0x290A, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x61C2, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x18A7, 255}, {0x0845, 255}, {0x0845, 255}, {0x18A7, 255},
-    {0x18A7, 255}, {0x18A7, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x18A7, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0845, 255}, {0x0845, 255},
-    {0x0845, 255}, {0x0845, 255}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
-    {0x0000,   0}, {0x0000,   0}, {0x0000,   0}, {0x0000,   0},
+inline constexpr uint16_t wizard_color[4096] = {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0845,0x41CC,0x41CC,0x2847,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0845,0x0845,0x41CC,0x41CC,0x290A,0x41CC,0x41CC,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0845,0x41CC,0x41CC,0x290A,0x41CC,0x41CC,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,
+    0x41CC,0x290A,0x41CC,0x41CC,0x41CC,0x18A7,0x18A7,0x18A7,0x1087,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,
+    0x41CC,0x41CC,0x41CC,0x41CC,0x18A7,0x18A7,0x18A7,0x1087,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,
+    0x41CC,0x290A,0x41CC,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x41CC,
+    0x290A,0x41CC,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x41CC,
+    0x41CC,0x290A,0x290A,0x290A,0x18A7,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x41CC,
+    0x41CC,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x41CC,0x290A,
+    0x41CC,0x41CC,0x290A,0x290A,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0845,0x41CC,0x41CC,0x41CC,0x41CC,
+    0x41CC,0x41CC,0x41CC,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x61C2,0x61C2,0x61C2,
+    0x61C2,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x41CC,0x41CC,0x290A,0x41CC,0x41CC,0x290A,0x41CC,
+    0x41CC,0x41CC,0x290A,0x41CC,0x290A,0x290A,0x290A,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x61C2,0x61C2,0x0845,0x0845,
+    0x61C2,0x61C2,0x0845,0x0000,0x0000,0x0845,0x0845,0x41CC,0x290A,0x290A,0x41CC,0x41CC,0x41CC,0x41CC,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x61C2,0x61C2,0x0845,0x0845,0x0845,
+    0x0845,0x61C2,0x0845,0x0845,0x0000,0x0845,0x290A,0x41CC,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x1064,
+    0x1064,0x1064,0x1064,0x1064,0x1064,0x1064,0x1064,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x61C2,0x0845,0x0845,0x61C2,0x61C2,
+    0x0845,0x61C2,0x61C2,0x0845,0x0000,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0845,0x1064,0xDED0,
+    0xDED0,0x1064,0x1064,0x1064,0xDED0,0xDED0,0x1064,0x18A7,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x61C2,0x0845,0x61C2,0x61C2,0x0845,0x0845,
+    0x0845,0x0845,0x61C2,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x1064,0x1064,
+    0x1064,0x1064,0x41AB,0x1064,0x1064,0x1064,0x1064,0x18A7,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,0x61C2,0x61C2,0x0845,0x61C2,
+    0x61C2,0x0845,0x0845,0x61C2,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x1064,0x1064,
+    0x41AB,0x41AB,0x41AB,0x41AB,0x41AB,0x41AB,0x1064,0x18A7,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x61C2,0x0845,0x0845,0x0845,0x0845,0x61C2,
+    0x61C2,0x0845,0x61C2,0x61C2,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41AB,0x41AB,
+    0x963A,0xD7BF,0x963A,0x41AB,0x41AB,0x6C31,0x41AB,0x18A7,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x61C2,0x61C2,0x0845,0x61C2,0x61C2,0x61C2,
+    0x0845,0x0845,0x61C2,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41AB,0x6C31,
+    0x963A,0xD7BF,0x963A,0xD7BF,0xD7BF,0x6C31,0xD7BF,0x326A,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x61C2,0x0845,0x0845,0x61C2,0x0845,
+    0x0845,0x61C2,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0xD7BF,0x6C31,
+    0xD7BF,0x1064,0x1064,0xD7BF,0xD7BF,0xD7BF,0xD7BF,0x326A,0x18A7,0x18A7,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x61C2,0x0845,0x0845,0x0845,
+    0x61C2,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0xD7BF,0xD7BF,
+    0xD7BF,0x1064,0x1064,0x1064,0xD7BF,0xD7BF,0xD7BF,0x326A,0x1064,0x18A7,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x61C2,0x61C2,0x0845,
+    0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0xD7BF,0x963A,
+    0x6493,0xD7BF,0xD7BF,0x6493,0xD7BF,0x963A,0xD7BF,0xD7BF,0x1064,0x18A7,0x18A7,0x0845,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x61C2,0x0845,0x0845,
+    0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x963A,0x963A,
+    0xD7BF,0xD7BF,0xD7BF,0x6493,0xD7BF,0x963A,0x6C31,0x963A,0x1064,0x18A7,0x1066,0x0845,0x0845,0x0845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x290A,0x290A,0x963A,0x963A,
+    0x6493,0xD7BF,0x963A,0x6493,0xD7BF,0x963A,0x6C31,0xD7BF,0x1064,0x0845,0x0845,0x0845,0x290A,0x0845,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0845,0x963A,0xD7BF,
+    0xD7BF,0x6C31,0x963A,0xD7BF,0xD7BF,0x963A,0x6C31,0xD7BF,0x1064,0x0845,0x0845,0x290A,0x0845,0x0845,0x0845,0x0845,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x963A,0xD7BF,
+    0xD7BF,0x6C31,0x963A,0x6C31,0xD7BF,0xD7BF,0x6C31,0x1066,0x1066,0x0845,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x0845,
+    0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x2045,0x18A7,0x1066,0xD7BF,
+    0x6C31,0xD7BF,0xD7BF,0x6C31,0x6C31,0xD7BF,0xD7BF,0x0845,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x290A,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x6C31,0xD7BF,0x963A,0x6C31,0x6C31,0xD7BF,0xD7BF,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0xA346,0x0845,0x0845,
+    0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x290A,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x6C31,0xD7BF,0x963A,0x6C31,0xD7BF,0x963A,0x290A,0x290A,0x1066,0x1066,0x1066,0x1066,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0xA346,0xA346,0xA346,0x0845,0xA346,
+    0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0845,0x18A7,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0xD7BF,0x6C31,0xD7BF,0x963A,0x0845,0x0845,0x290A,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x290A,
+    0x290A,0x18A7,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0xA346,0xA346,0xA346,0x0845,0xA346,
+    0x0845,0x290A,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x41CC,0x41CC,0x290A,0x41CC,0x0845,0x0845,0x0845,0x41CC,
+    0x0845,0x41CC,0x0845,0x6C31,0x41CC,0x41CC,0x290A,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x290A,0x290A,0x18A7,
+    0x290A,0x290A,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0xA346,0xA346,0xA346,0xA346,0xA346,0xA346,
+    0x0845,0x41CC,0x41CC,0x290A,0x0845,0x0845,0x0845,0x41CC,0x41CC,0x18A7,0x290A,0x18A7,0x0845,0x0845,0x0845,0x290A,
+    0x0845,0x18A7,0x0845,0x6C31,0x41CC,0x18A7,0x290A,0x0845,0x0845,0x0845,0x290A,0x18A7,0x290A,0x41CC,0x290A,0x290A,
+    0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0xA346,0xA346,0xA346,0xA346,0x0845,
+    0x0845,0x41CC,0x290A,0x290A,0x41CC,0x290A,0x41CC,0x41CC,0x41CC,0x18A7,0x290A,0x18A7,0x0845,0x0845,0x0845,0x290A,
+    0x0845,0x18A7,0x0845,0x41CC,0x41CC,0x18A7,0x290A,0x0845,0x290A,0x0845,0x290A,0x18A7,0x0845,0x290A,0x18A7,0x18A7,
+    0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0xA346,0xA346,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x290A,0x41CC,0x41CC,0x41CC,0x41CC,0x18A7,0x290A,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x290A,
+    0x0845,0x18A7,0x0845,0x18A7,0x290A,0x18A7,0x290A,0x0845,0x290A,0x0845,0x290A,0x0845,0x290A,0x18A7,0x18A7,0x290A,
+    0x290A,0x0845,0x0845,0x18A7,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x41CC,0x41CC,0x290A,0x41CC,0x290A,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x290A,0x0845,0x290A,
+    0x0845,0x18A7,0x0845,0x18A7,0x41CC,0x18A7,0x290A,0x0845,0x290A,0x0845,0x290A,0x0845,0x18A7,0x18A7,0x290A,0x290A,
+    0x18A7,0x0845,0x0845,0x18A7,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,
+    0x0845,0x0845,0x41CC,0x41CC,0x290A,0x18A7,0x290A,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x41CC,0x0845,0x18A7,
+    0x0845,0x18A7,0x0845,0x18A7,0x290A,0x290A,0x290A,0x0845,0x290A,0x0845,0x290A,0x0845,0x290A,0x18A7,0x18A7,0x18A7,
+    0x290A,0x0845,0x0845,0x0845,0x18A7,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,
+    0x0845,0x0845,0x290A,0x18A7,0x290A,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x290A,0x290A,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,
+    0x0845,0x0845,0x290A,0x18A7,0x290A,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x290A,0x18A7,0x18A7,
+    0x18A7,0x18A7,0x18A7,0x290A,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x41CC,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,
+    0x0845,0x0845,0x290A,0x18A7,0x290A,0x18A7,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0845,0x290A,0x290A,0x18A7,
+    0x18A7,0x18A7,0x290A,0x290A,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0845,
+    0xA346,0xA346,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,
+    0x0845,0x0845,0x18A7,0x18A7,0x290A,0x18A7,0x0845,0x0845,0x0845,0x0845,0x0000,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0xA346,
+    0xA346,0xA346,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,
+    0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0000,0x0000,0x0845,0x41CC,0x290A,0x0845,0x290A,
+    0x18A7,0x18A7,0x0845,0x290A,0x18A7,0x18A7,0x18A7,0x0845,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x0845,0xA346,0xA346,
+    0xA346,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,
+    0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0845,0x18A7,0x290A,0x0845,0x18A7,
+    0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x18A7,0x0845,0x18A7,0x18A7,0x1065,0x0845,0x0845,0xA346,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,
+    0x0845,0x0845,0x18A7,0x0845,0x18A7,0x0845,0x0845,0x0000,0x0000,0x0000,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x18A7,
+    0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x1066,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,
+    0x0845,0x0845,0x18A7,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x18A7,0x18A7,0x0845,0x18A7,
+    0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x1065,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x18A7,0x18A7,0x0845,0x18A7,
+    0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x1065,0x0845,
+    0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x18A7,
+    0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x1065,0x1046,
+    0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,
+    0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x1065,
+    0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x18A7,
+    0x0845,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x18A7,
+    0x18A7,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x41CC,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,
+    0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x18A7,
+    0x18A7,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x290A,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x0845,0x0845,
+    0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x18A7,
+    0x18A7,0x1066,0x1066,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x290A,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x18A7,
+    0x18A7,0x18A7,0x18A7,0x290A,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x0845,
+    0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x290A,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,
+    0x18A7,0x18A7,0x18A7,0x290A,0x290A,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x0845,
+    0x0845,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x290A,0x18A7,0x18A7,0x18A7,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x18A7,
+    0x18A7,0x18A7,0x18A7,0x18A7,0x290A,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x18A7,
+    0x0845,0x0845,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x290A,0x18A7,0x18A7,0x0845,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x18A7,
+    0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x18A7,
+    0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x61C2,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x18A7,0x18A7,0x0845,0x18A7,0x0845,0x0845,0x0845,0x18A7,0x18A7,0x18A7,
+    0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x0845,
+    0x18A7,0x0845,0x0845,0x18A7,0x18A7,0x18A7,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0000,
+    0x0000,0x0000,0x0000,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x18A7,0x0845,0x0845,
+    0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
 };
 
+inline constexpr uint8_t wizard_alpha[4096] = {
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,
+    255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,255,255,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,
+    255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,
+    255,255,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,
+    255,255,255,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,
+    255,255,255,  0,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,
+    255,255,255,255,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,
+    255,255,255,255,  0,255,255,255,255,  0,  0,  0,  0,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,
+    255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,
+    255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,
+    255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,
+    255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,
+    255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,
+    255,255,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,
+    255,255,255,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,  0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,  0,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,  0,  0,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,
+    255,255,255,255,255,255,255,255,  0,  0,  0,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,
+    255,255,255,255,255,255,255,  0,  0,  0,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,
+    255,255,255,255,255,255,  0,  0,  0,  0,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,
+    255,255,255,255,255,  0,  0,  0,  0,  0,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,
+    255,255,255,255,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,
+    255,255,255,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,  0,
+      0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,  0,
+      0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,  0,
+      0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,  0,
+      0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,  0,
+      0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,  0,
+      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,  0,
+      0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+inline constexpr Sprite_planes wizard_sprite = {wizard_width, wizard_height, wizard_color, wizard_alpha};
+
 #endif // SPRITE_WIZARD_H
@@ -0,0 +1,232 @@
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdio>
+    #include <cstring>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#else
+    #include "pico/stdlib.h"
+    #include "stdio.h"
+    #include "cstring"
+    #include "hardware/regs/addressmap.h"
+#endif
+#include <bit>
+#include <cstddef>
+
+#include "asset_pack.h"
+
+// Payloads are used in place, the engine types must match the pack layout byte for byte
+static_assert(std::endian::native == std::endian::little, "packs are little-endian");
+static_assert(sizeof(SpritePixel) == PACK_SPRITE_PIXEL_SIZE && offsetof(SpritePixel, alpha) == 2, "SpritePixel layout");
+static_assert(sizeof(Atlas_frame) == PACK_ATLAS_FRAME_SIZE, "Atlas_frame layout");
+
+bool Asset_pack::open_memory(const uint8_t* pack, size_t size) {
+
+	close();
+	if (pack == nullptr || size < sizeof(Pack_header)) {
+		printf("[ERROR] asset pack: no data\n");
+		return false;
+	}
+	if (reinterpret_cast<uintptr_t>(pack) % PACK_ALIGNMENT != 0) {
+		printf("[ERROR] asset pack: data not %u byte aligned\n", static_cast<unsigned>(PACK_ALIGNMENT));
+		return false;
+	}
+
+	const Pack_header* header = reinterpret_cast<const Pack_header*>(pack);
+	if (header->magic != PACK_MAGIC || header->version == 0 || header->version > PACK_VERSION) {
+		printf("[ERROR] asset pack: not a version 1..%u pack\n", PACK_VERSION);
+		return false;
+	}
+	// In flash the size is not known up front, the header says how much is ours
+	if (header->file_size > size || header->file_size < sizeof(Pack_header)) {
+		printf("[ERROR] asset pack: %u bytes, %u available\n", static_cast<unsigned>(header->file_size), static_cast<unsigned>(size));
+		return false;
+	}
+	size = header->file_size;
+
+	const uint64_t toc_end = uint64_t(header->toc_offset) + uint64_t(header->entry_count) * sizeof(Pack_entry);
+	if (header->toc_offset % PACK_ALIGNMENT != 0 || toc_end > size) {
+		printf("[ERROR] asset pack: table of contents out of bound\n");
+		return false;
+	}
+	std::span<const Pack_entry> entries(reinterpret_cast<const Pack_entry*>(pack + header->toc_offset), header->entry_count);
+
+	// Checked once here, lookups trust the entries
+	for (size_t i = 0; i < entries.size(); i++) {
+		const Pack_entry& entry = entries[i];
+		const uint64_t end = uint64_t(entry.offset) + entry.size;
+		if (entry.name[PACK_NAME_LENGTH - 1] != '\0' || entry.offset % PACK_ALIGNMENT != 0 || end > size || entry.size == 0) {
+			printf("[ERROR] asset pack: entry %u is malformed\n", static_cast<unsigned>(i));
+			return false;
+		}
+
+		// Compressed: the size check is on the decoded payload, its content is checked
+		// while decoding
+		uint32_t raw_size = entry.size;
+		if (entry.flags & PACK_FLAG_COMPRESSED) {
+			Lz_stream stream;
+			if (!stream.open(pack + entry.offset, entry.size)) {
+				printf("[ERROR] asset pack: %s is not a valid compressed payload\n", entry.name);
+				return false;
+			}
+			raw_size = stream.raw_size();
+		}
+		if (pack_payload_size(entry, raw_size) != raw_size) {
+			printf("[ERROR] asset pack: entry %u is malformed\n", static_cast<unsigned>(i));
+			return false;
+		}
+		if (entry.type == Asset_type::atlas && !(entry.flags & PACK_FLAG_COMPRESSED)) {
+			const Atlas_frame* frames = reinterpret_cast<const Atlas_frame*>(pack + entry.offset);
+			for (uint16_t f = 0; f < entry.count; f++) {
+				if (frames[f].x + frames[f].width > entry.width || frames[f].y + frames[f].height > entry.height) {
+					printf("[ERROR] asset pack: atlas %s frame %u outside the atlas\n", entry.name, f);
+					return false;
+				}
+			}
+		}
+		if (i > 0 && strncmp(entries[i - 1].name, entry.name, PACK_NAME_LENGTH) >= 0) {
+			printf("[ERROR] asset pack: entries not sorted by name (%s)\n", entry.name);
+			return false;
+		}
+	}
+
+	data = pack;
+	toc = entries;
+	return true;
+}
+
+#ifdef PLATFORM_DESKTOP
+bool Asset_pack::open_file(const char* path) {
+
+	close();
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		printf("[ERROR] asset pack: cannot open %s\n", path);
+		return false;
+	}
+	struct stat info;
+	if (fstat(fd, &info) != 0 || info.st_size == 0) {
+		printf("[ERROR] asset pack: cannot read %s\n", path);
+		::close(fd);
+		return false;
+	}
+	size_t size = static_cast<size_t>(info.st_size);
+	void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);		// the mapping keeps the file
+	if (mapped == MAP_FAILED) {
+		printf("[ERROR] asset pack: cannot map %s\n", path);
+		return false;
+	}
+
+	if (!open_memory(static_cast<const uint8_t*>(mapped), size)) {
+		munmap(mapped, size);
+		return false;
+	}
+	mapping = mapped;
+	mapping_size = size;
+	return true;
+}
+#else
+bool Asset_pack::open_flash() {
+	return open_memory(reinterpret_cast<const uint8_t*>(XIP_BASE + ASSET_PACK_FLASH_OFFSET), PICO_FLASH_SIZE_BYTES - ASSET_PACK_FLASH_OFFSET);
+}
+#endif
+
+void Asset_pack::close() {
+#ifdef PLATFORM_DESKTOP
+	if (mapping) munmap(mapping, mapping_size);
+	mapping = nullptr;
+	mapping_size = 0;
+#endif
+	data = nullptr;
+	toc = {};
+}
+
+const Pack_entry* Asset_pack::find(const char* name) const {
+
+	size_t low = 0;
+	size_t high = toc.size();
+	while (low < high) {
+		size_t middle = (low + high) / 2;
+		int order = strncmp(toc[middle].name, name, PACK_NAME_LENGTH);
+		if (order == 0) return &toc[middle];
+		if (order < 0) low = middle + 1;
+		else high = middle;
+	}
+	return nullptr;
+}
+
+const Pack_entry* Asset_pack::find(const char* name, Asset_type type) const {
+
+	const Pack_entry* entry = find(name);
+	if (entry == nullptr) {
+		printf("[ERROR] asset pack: no asset %s\n", name);
+		return nullptr;
+	}
+	if (entry->type != type) {
+		printf("[ERROR] asset pack: %s has another type\n", name);
+		return nullptr;
+	}
+	if (entry->flags & PACK_FLAG_COMPRESSED) {
+		printf("[ERROR] asset pack: %s is compressed, decode it through stream()\n", name);
+		return nullptr;
+	}
+	return entry;
+}
+
+bool Asset_pack::stream(const char* name, Lz_stream& out) const {
+	const Pack_entry* entry = find(name);
+	if (entry == nullptr || !(entry->flags & PACK_FLAG_COMPRESSED)) {
+		printf("[ERROR] asset pack: no compressed asset %s\n", name);
+		return false;
+	}
+	return out.open(payload(*entry), entry->size);
+}
+
+bool Asset_pack::sprite(const char* name, Sprite_asset& out) const {
+	const Pack_entry* entry = find(name, Asset_type::sprite);
+	if (!entry) return false;
+	out = {entry->width, entry->height, reinterpret_cast<const SpritePixel*>(payload(*entry))};
+	return true;
+}
+
+bool Asset_pack::indexed_sprite(const char* name, Indexed_sprite& out) const {
+	const Pack_entry* entry = find(name, Asset_type::indexed_sprite);
+	if (!entry) return false;
+	out = {entry->width, entry->height, payload(*entry)};
+	return true;
+}
+
+bool Asset_pack::atlas(const char* name, Sprite_atlas& out) const {
+	const Pack_entry* entry = find(name, Asset_type::atlas);
+	if (!entry) return false;
+	const uint8_t* frames = payload(*entry);
+	const uint8_t* pixels = frames + entry->count * PACK_ATLAS_FRAME_SIZE;
+	out = {entry->width, entry->height, reinterpret_cast<const SpritePixel*>(pixels),
+		   reinterpret_cast<const Atlas_frame*>(frames), entry->count};
+	return true;
+}
+
+bool Asset_pack::palette(const char* name, Palette_asset& out) const {
+	const Pack_entry* entry = find(name, Asset_type::palette);
+	if (!entry) return false;
+	out = {reinterpret_cast<const uint16_t*>(payload(*entry)), entry->count};
+	return true;
+}
+
+bool Asset_pack::tilemap(const char* name, Tilemap_asset& out) const {
+	const Pack_entry* entry = find(name, Asset_type::tilemap);
+	if (!entry) return false;
+	out = {entry->width, entry->height, reinterpret_cast<const uint16_t*>(payload(*entry))};
+	return true;
+}
+
+bool Asset_pack::audio(const char* name, Audio_asset& out) const {
+	const Pack_entry* entry = find(name, Asset_type::audio);
+	if (!entry) return false;
+	out = {payload(*entry), entry->size, entry->count, static_cast<uint8_t>(entry->width), static_cast<uint8_t>(entry->height)};
+	return true;
+}
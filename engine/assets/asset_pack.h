@@ -0,0 +1,102 @@
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+#else
+    #include "pico/stdlib.h"
+#endif
+#include <span>
+#include "asset_pack_format.h"
+#include "lz_stream.h"
+#include "engine/graphics/framebuffer.h"
+#include "engine/graphics/framebuffer_indexed.h"
+
+// Read only access to a .pack (tools/asset_packer). Lookups return views into the pack
+// itself: no allocation, no copy, the pointers stay valid until close(). Art changes
+// rebuild the pack, not the firmware.
+//
+// Desktop: open_file() maps the file, the OS pages it in on first touch.
+// Pico: the pack is flashed behind the firmware (picotool load assets.pack -t bin
+// -o 0x10100000) and open_flash() reads it through the XIP window.
+
+#ifndef PLATFORM_DESKTOP
+// Flash offset of the pack, past the firmware (1 MB on a 2 MB Pico)
+constexpr uint32_t ASSET_PACK_FLASH_OFFSET = 1024 * 1024;
+#endif
+
+struct Sprite_asset {
+	uint16_t width;
+	uint16_t height;
+	const SpritePixel* pixels;		// draw_sprite_alpha(y, height, x, width, pixels)
+};
+
+struct Palette_asset {
+	const uint16_t* colors;
+	uint16_t count;
+};
+
+struct Tilemap_asset {
+	uint16_t width;
+	uint16_t height;
+	const uint16_t* tiles;
+};
+
+struct Audio_asset {
+	const uint8_t* samples;
+	uint32_t size;					// bytes
+	uint16_t sample_rate;
+	uint8_t bits;
+	uint8_t channels;
+};
+
+class Asset_pack {
+public:
+	Asset_pack() = default;
+	~Asset_pack() { close(); }
+	Asset_pack(const Asset_pack&) = delete;
+	Asset_pack& operator=(const Asset_pack&) = delete;
+
+	// Pack already addressable (flash, embedded array, loaded file). Used in place,
+	// must outlive the Asset_pack. The whole table of contents is validated here.
+	bool open_memory(const uint8_t* data, size_t size);
+#ifdef PLATFORM_DESKTOP
+	bool open_file(const char* path);
+#else
+	bool open_flash();
+#endif
+	void close();
+
+	bool is_open() const { return data != nullptr; }
+	std::span<const Pack_entry> entries() const { return toc; }
+	const uint8_t* payload(const Pack_entry& entry) const { return data + entry.offset; }
+
+	// Binary search by name, nullptr when missing
+	const Pack_entry* find(const char* name) const;
+
+	// Views in place, false (and an error) when the name is missing, has another type or
+	// is compressed
+	bool sprite(const char* name, Sprite_asset& out) const;
+	bool indexed_sprite(const char* name, Indexed_sprite& out) const;
+	bool atlas(const char* name, Sprite_atlas& out) const;
+	bool palette(const char* name, Palette_asset& out) const;
+	bool tilemap(const char* name, Tilemap_asset& out) const;
+	bool audio(const char* name, Audio_asset& out) const;
+
+	// Compressed entry (PACK_FLAG_COMPRESSED, any type), decoded by the caller into its own
+	// RAM, whole or one chunk at a time
+	bool stream(const char* name, Lz_stream& out) const;
+
+private:
+	const uint8_t* data = nullptr;
+	std::span<const Pack_entry> toc;
+#ifdef PLATFORM_DESKTOP
+	void* mapping = nullptr;
+	size_t mapping_size = 0;
+#endif
+
+	const Pack_entry* find(const char* name, Asset_type type) const;
+};
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef ASSET_PACK_FORMAT_H
+#define ASSET_PACK_FORMAT_H
+
+// On disk / in flash layout of .pack files. Shared by the engine (Asset_pack) and
+// tools/asset_packer, so only standard headers here.
+#include <cstdint>
+
+// Little-endian, every field naturally aligned, so a pack is used in place: mmap on
+// desktop, XIP flash on the Pico. Nothing is parsed or copied at load.
+//
+//   Pack_header                     16 bytes
+//   Pack_entry[entry_count]         32 bytes each, sorted by name (binary search)
+//   payloads                        each at a PACK_ALIGNMENT offset
+//
+// Payload per type (width / height / count meaning):
+//   sprite          width x height SpritePixel (RGB565, alpha, pad) = 4 bytes per pixel
+//   indexed_sprite  width x height uint8_t palette indices
+//   atlas           count Atlas_frame (16 bytes), then width x height SpritePixel
+//   palette         count uint16_t RGB565 colors
+//   tilemap         width x height uint16_t tile ids, row major
+//   audio           PCM, count = sample rate, width = bits per sample (8 / 16), height = channels
+//
+// With PACK_FLAG_COMPRESSED the payload above is stored as an LZ stream (below), size is
+// then the compressed size. The raw payload is split in chunks of chunk_size bytes, each
+// compressed on its own (LZ4 block format), so any chunk decodes into a chunk_size window
+// without the chunks before it:
+//
+//   Lz_header
+//   uint32_t chunk_end[chunk_count]     end of each chunk's data, counted from after this
+//                                       table, LZ_STORED bit = chunk kept raw
+//   chunk data
+
+constexpr uint32_t PACK_MAGIC = 0x4B504750;		// "PGPK"
+constexpr uint16_t PACK_VERSION = 2;			// 2: compressed entries
+constexpr uint32_t PACK_ALIGNMENT = 4;
+constexpr uint32_t PACK_NAME_LENGTH = 16;		// including the terminating 0
+
+enum class Asset_type : uint8_t {
+	sprite = 1,
+	indexed_sprite,
+	atlas,
+	palette,
+	tilemap,
+	audio,
+};
+
+struct Pack_header {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t entry_count;
+	uint32_t toc_offset;
+	uint32_t file_size;
+};
+
+struct Pack_entry {
+	char name[PACK_NAME_LENGTH];
+	uint32_t offset;			// from the start of the pack
+	uint32_t size;				// payload bytes
+	Asset_type type;
+	uint8_t flags;
+	uint16_t width;
+	uint16_t height;
+	uint16_t count;
+};
+
+constexpr uint8_t PACK_FLAG_COMPRESSED = 1;
+
+constexpr uint32_t LZ_MAGIC = 0x315A4C50;		// "PLZ1"
+constexpr uint32_t LZ_STORED = 0x80000000u;
+constexpr uint32_t LZ_MAX_CHUNK_SIZE = 0x10000;	// match offsets are 16 bit
+
+struct Lz_header {
+	uint32_t magic;
+	uint32_t raw_size;
+	uint32_t chunk_size;
+	uint32_t chunk_count;
+};
+
+static_assert(sizeof(Pack_header) == 16, "Pack_header layout");
+static_assert(sizeof(Pack_entry) == 32, "Pack_entry layout");
+
+constexpr uint32_t PACK_SPRITE_PIXEL_SIZE = 4;
+constexpr uint32_t PACK_ATLAS_FRAME_SIZE = 16;
+
+// Raw payload bytes an entry must have, 0 = the entry is malformed.
+// raw_size is entry.size for uncompressed entries (only audio needs it).
+constexpr uint32_t pack_payload_size(const Pack_entry& entry, uint32_t raw_size) {
+	const uint32_t pixels = uint32_t(entry.width) * entry.height;
+	switch (entry.type) {
+		case Asset_type::sprite:			return pixels * PACK_SPRITE_PIXEL_SIZE;
+		case Asset_type::indexed_sprite:	return pixels;
+		case Asset_type::atlas:				return entry.count * PACK_ATLAS_FRAME_SIZE + pixels * PACK_SPRITE_PIXEL_SIZE;
+		case Asset_type::palette:			return entry.count * 2u;
+		case Asset_type::tilemap:			return pixels * 2u;
+		case Asset_type::audio: {
+			const uint32_t frame = (entry.width / 8u) * entry.height;
+			return (entry.width == 8 || entry.width == 16) && frame != 0 && raw_size % frame == 0 ? raw_size : 0;
+		}
+	}
+	return 0;
+}
+
+#endif
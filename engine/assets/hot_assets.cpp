@@ -0,0 +1,235 @@
+#ifdef PLATFORM_DESKTOP
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __linux__
+    #include <sys/inotify.h>
+#endif
+
+#include "hot_assets.h"
+
+Hot_assets::Hot_assets() {
+#ifdef __linux__
+	notify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (notify_fd < 0) printf("[ERROR] hot assets: no inotify, falling back to polling file times\n");
+#endif
+}
+
+Hot_assets::~Hot_assets() {
+	if (notify_fd >= 0) close(notify_fd);
+}
+
+// Modification time and size, false when the file is not there
+static bool file_stamp(const std::string& path, int64_t& modified_ns, int64_t& size) {
+	struct stat info;
+	if (stat(path.c_str(), &info) != 0) return false;
+#ifdef __APPLE__
+	modified_ns = int64_t(info.st_mtimespec.tv_sec) * 1000000000 + info.st_mtimespec.tv_nsec;
+#else
+	modified_ns = int64_t(info.st_mtim.tv_sec) * 1000000000 + info.st_mtim.tv_nsec;
+#endif
+	size = info.st_size;
+	return true;
+}
+
+bool Hot_assets::add_pack(const char* path) {
+	Source source;
+	source.path = path;
+	source.is_pack = true;
+	return add_source(std::move(source));
+}
+
+bool Hot_assets::add_sprite_file(const char* name, const char* path) {
+	Source source;
+	source.path = path;
+	source.name = name;
+	return add_source(std::move(source));
+}
+
+bool Hot_assets::add_source(Source source) {
+
+	std::error_code error;
+	std::filesystem::path absolute = std::filesystem::absolute(source.path, error).lexically_normal();
+	source.directory = absolute.parent_path().string();
+	source.file = absolute.filename().string();
+	file_stamp(source.path, source.modified_ns, source.file_size);
+	if (!load(source, source)) return false;
+
+#ifdef __linux__
+	// Directory, not file: a rename over the file replaces the inode a file watch would follow
+	if (notify_fd >= 0) {
+		source.watch = inotify_add_watch(notify_fd, source.directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+		if (source.watch < 0) printf("[ERROR] hot assets: cannot watch %s\n", source.directory.c_str());
+	}
+#endif
+	sources.push_back(std::move(source));
+	return true;
+}
+
+bool Hot_assets::load(const Source& source, Source& loaded) const {
+
+	std::ifstream in(source.path, std::ios::binary);
+	std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+	if (!in || bytes.empty()) {
+		printf("[ERROR] hot assets: cannot read %s\n", source.path.c_str());
+		return false;
+	}
+
+	if (source.is_pack) {
+		std::vector<uint32_t> words((bytes.size() + 3) / 4, 0);
+		memcpy(words.data(), bytes.data(), bytes.size());
+		std::unique_ptr<Asset_pack> pack = std::make_unique<Asset_pack>();
+		if (!pack->open_memory(reinterpret_cast<const uint8_t*>(words.data()), bytes.size())) {
+			printf("[ERROR] hot assets: %s is not a valid pack\n", source.path.c_str());
+			return false;
+		}
+		// The pack points into the heap block of words, moving the vector keeps it
+		loaded.words = std::move(words);
+		loaded.pack = std::move(pack);
+		return true;
+	}
+
+	uint16_t width = 0, height = 0;
+	if (bytes.size() >= 4) {
+		width = static_cast<uint16_t>(bytes[0] | (bytes[1] << 8));
+		height = static_cast<uint16_t>(bytes[2] | (bytes[3] << 8));
+	}
+	const size_t pixel_count = size_t(width) * height;
+	if (pixel_count == 0 || bytes.size() != 4 + pixel_count * 3) {
+		printf("[ERROR] hot assets: %s is not a %ux%u sprite\n", source.path.c_str(), width, height);
+		return false;
+	}
+	std::vector<SpritePixel> pixels(pixel_count);
+	for (size_t i = 0; i < pixel_count; i++) {
+		const uint8_t* p = &bytes[4 + i * 3];
+		pixels[i] = {static_cast<uint16_t>(p[0] | (p[1] << 8)), p[2]};
+	}
+	loaded.pixels = std::move(pixels);
+	loaded.width = width;
+	loaded.height = height;
+	return true;
+}
+
+bool Hot_assets::resolve(const Source& source, Slot& slot) const {
+
+	if (!source.is_pack) {
+		if (slot.type != Asset_type::sprite || slot.name != source.name) return false;
+		slot.sprite = {source.width, source.height, source.pixels.data()};
+		return true;
+	}
+	// find() first, a pack without the name is not an error when looking through the sources
+	const Pack_entry* entry = source.pack->find(slot.name.c_str());
+	if (!entry || entry->type != slot.type) return false;
+	if (slot.type == Asset_type::sprite) return source.pack->sprite(slot.name.c_str(), slot.sprite);
+	return source.pack->atlas(slot.name.c_str(), slot.atlas);
+}
+
+Hot_assets::Slot* Hot_assets::find_slot(const char* name, Asset_type type) {
+
+	for (std::unique_ptr<Slot>& slot : slots) {
+		if (slot->type == type && slot->name == name) return slot.get();
+	}
+	std::unique_ptr<Slot> slot = std::make_unique<Slot>();
+	slot->name = name;
+	slot->type = type;
+	for (size_t i = 0; i < sources.size(); i++) {
+		if (!resolve(sources[i], *slot)) continue;
+		slot->source = i;
+		slots.push_back(std::move(slot));
+		return slots.back().get();
+	}
+	printf("[ERROR] hot assets: no %s %s\n", type == Asset_type::sprite ? "sprite" : "atlas", name);
+	return nullptr;
+}
+
+const Sprite_asset* Hot_assets::sprite(const char* name) {
+	Slot* slot = find_slot(name, Asset_type::sprite);
+	return slot ? &slot->sprite : nullptr;
+}
+
+const Sprite_atlas* Hot_assets::atlas(const char* name) {
+	Slot* slot = find_slot(name, Asset_type::atlas);
+	return slot ? &slot->atlas : nullptr;
+}
+
+void Hot_assets::collect_changes() {
+
+#ifdef __linux__
+	if (notify_fd >= 0) {
+		alignas(inotify_event) char buffer[4096];
+		ssize_t length;
+		while ((length = read(notify_fd, buffer, sizeof(buffer))) > 0) {
+			for (ssize_t offset = 0; offset < length;) {
+				const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+				offset += sizeof(inotify_event) + event->len;
+				if (event->len == 0) continue;
+				for (Source& source : sources) {
+					if (source.watch == event->wd && source.file == event->name) source.changed = true;
+				}
+			}
+		}
+		return;
+	}
+#endif
+	for (Source& source : sources) {
+		int64_t modified_ns, size;
+		if (!file_stamp(source.path, modified_ns, size)) continue;
+		if (modified_ns == source.modified_ns && size == source.file_size) continue;
+		source.modified_ns = modified_ns;
+		source.file_size = size;
+		source.changed = true;
+	}
+}
+
+bool Hot_assets::reload(size_t index) {
+
+	Source& source = sources[index];
+	Source loaded;
+	loaded.path = source.path;
+	loaded.name = source.name;
+	loaded.is_pack = source.is_pack;
+	if (!load(source, loaded)) {
+		counters.failures++;
+		return false;
+	}
+
+	// Every slot fed by this file must still be there, otherwise nothing changes
+	for (const std::unique_ptr<Slot>& slot : slots) {
+		Slot check = *slot;
+		if (slot->source == index && !resolve(loaded, check)) {
+			printf("[ERROR] hot assets: %s no longer has %s, reload skipped\n", source.path.c_str(), slot->name.c_str());
+			counters.failures++;
+			return false;
+		}
+	}
+
+	// Swap in the new buffers and repoint the slots, all between two frames
+	source.words = std::move(loaded.words);
+	source.pack = std::move(loaded.pack);
+	source.pixels = std::move(loaded.pixels);
+	source.width = loaded.width;
+	source.height = loaded.height;
+	for (std::unique_ptr<Slot>& slot : slots) {
+		if (slot->source == index) resolve(source, *slot);
+	}
+	counters.reloads++;
+	return true;
+}
+
+uint32_t Hot_assets::poll() {
+
+	collect_changes();
+	uint32_t reloaded = 0;
+	for (size_t i = 0; i < sources.size(); i++) {
+		if (!sources[i].changed) continue;
+		sources[i].changed = false;
+		reloaded += reload(i) ? 1 : 0;
+	}
+	return reloaded;
+}
+#endif
@@ -0,0 +1,103 @@
+#ifndef HOT_ASSETS_H
+#define HOT_ASSETS_H
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "asset_pack.h"
+
+// Desktop only: sprites and atlases loaded at run time from packs and loose .sprite files,
+// reloaded in place when a file changes. Art iteration is then "rerun the tool", not
+// "regenerate the headers and rebuild main_glfw.cpp".
+//
+// sprite() / atlas() hand out slots whose address never changes. poll(), once per frame
+// between frames, reloads the changed files and rewrites the slots they feed, so draw
+// code reads the slot every frame instead of copying it:
+//
+//     const Sprite_atlas* characters = assets.atlas("characters");
+//     ...
+//     assets.poll();
+//     draw_sprite_region(*characters, frame, x, y);
+//
+// Files are read into RAM, not mapped: a tool rewriting a pack never pulls pages from
+// under a frame. A file that does not load (half written, broken, a slot's asset gone)
+// keeps the previous data and is retried on its next change.
+//
+// Changes come from inotify on Linux (the directories are watched, so tools that write a
+// temporary file and rename it over the old one are seen too), other hosts compare the
+// modification time and size of every file on each poll().
+
+#ifdef PLATFORM_DESKTOP
+class Hot_assets {
+public:
+	struct Stats {
+		uint32_t reloads;		// files reloaded
+		uint32_t failures;		// reloads rejected, previous data kept
+	};
+
+	Hot_assets();
+	~Hot_assets();
+	Hot_assets(const Hot_assets&) = delete;
+	Hot_assets& operator=(const Hot_assets&) = delete;
+
+	// Sources, looked up in the order they were added
+	bool add_pack(const char* path);
+	// png_to_sprite_alpha output: uint16 width, uint16 height, RGB565 + Alpha8 per pixel
+	bool add_sprite_file(const char* name, const char* path);
+
+	// Slot for the first source that has the name, nullptr (and an error) when none has it.
+	// The same name returns the same slot.
+	const Sprite_asset* sprite(const char* name);
+	const Sprite_atlas* atlas(const char* name);
+
+	// Between frames: reloads the files changed since the last call, returns how many were
+	// reloaded. Does not wait for anything.
+	uint32_t poll();
+
+	const Stats& stats() const { return counters; }
+
+private:
+	struct Source {
+		std::string path;
+		std::string directory;					// absolute, what inotify watches
+		std::string file;
+		std::string name;						// loose sprite
+		bool is_pack = false;
+		std::vector<uint32_t> words;			// pack file, uint32_t keeps the payloads aligned
+		std::unique_ptr<Asset_pack> pack;
+		std::vector<SpritePixel> pixels;		// loose sprite
+		uint16_t width = 0;
+		uint16_t height = 0;
+		int watch = -1;
+		int64_t modified_ns = 0;				// stat fallback
+		int64_t file_size = 0;
+		bool changed = false;
+	};
+
+	struct Slot {
+		std::string name;
+		Asset_type type;
+		size_t source;
+		Sprite_asset sprite;
+		Sprite_atlas atlas;
+	};
+
+	std::vector<Source> sources;
+	std::vector<std::unique_ptr<Slot>> slots;
+	Stats counters = {};
+	int notify_fd = -1;
+
+	bool add_source(Source source);
+	void collect_changes();
+	// Reads the file of a source into the buffers of loaded, false when it does not load
+	bool load(const Source& source, Source& loaded) const;
+	// Slot contents from a loaded source, false when the source does not have it
+	bool resolve(const Source& source, Slot& slot) const;
+	Slot* find_slot(const char* name, Asset_type type);
+	bool reload(size_t index);
+};
+#endif
+
+#endif
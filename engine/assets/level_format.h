@@ -0,0 +1,29 @@
+#ifndef LEVEL_FORMAT_H
+#define LEVEL_FORMAT_H
+
+// On disk layout of .level files. Shared by the engine (Level_stream) and tools/assetc,
+// so only standard headers here.
+#include <cstdint>
+
+// .level file (little-endian):
+//   Level_header                                                          16 bytes
+//   chunks, row by row of chunks, each chunk_width * chunk_height uint16
+//   tile ids row by row (edge chunks are padded to the full size)
+
+constexpr uint32_t LEVEL_MAGIC = 0x564C4750;		// "PGLV"
+constexpr uint16_t LEVEL_VERSION = 1;
+// Tile outside the level or in a chunk that is not loaded yet
+constexpr uint16_t LEVEL_TILE_MISSING = 0xFFFF;
+
+struct Level_header {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t reserved;
+	uint16_t width;				// tiles
+	uint16_t height;
+	uint16_t chunk_width;		// tiles
+	uint16_t chunk_height;
+};
+static_assert(sizeof(Level_header) == 16, "Level_header layout");
+
+#endif
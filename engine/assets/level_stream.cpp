@@ -0,0 +1,313 @@
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdio>
+    #include <cstring>
+    #include <chrono>
+#else
+    #include "pico/stdlib.h"
+    #include "stdio.h"
+    #include "cstring"
+#endif
+#include <algorithm>
+#include <bit>
+
+#include "level_stream.h"
+
+// Chunks are read straight into the regions
+static_assert(std::endian::native == std::endian::little, "levels are little-endian");
+
+bool Level_storage::read(uint32_t offset, void* dst, uint32_t size) {
+
+	if (!start_read(offset, dst, size)) return false;
+	Status status;
+	while ((status = poll()) == Status::busy) {}
+	return status == Status::done;
+}
+
+bool Memory_level_storage::start_read(uint32_t offset, void* dst, uint32_t size) {
+
+	if (status != Status::idle || uint64_t(offset) + size > data_size) return false;
+	memcpy(dst, data + offset, size);
+	status = Status::done;
+	return true;
+}
+
+Level_storage::Status Memory_level_storage::poll() {
+	Status result = status;
+	status = Status::idle;
+	return result;
+}
+
+#ifdef PLATFORM_DESKTOP
+static int64_t now_us() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool File_level_storage::open(const char* path) {
+
+	close();
+	file = fopen(path, "rb");
+	if (!file) {
+		printf("[ERROR] level storage: cannot open %s\n", path);
+		return false;
+	}
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	if (size <= 0 || size > 0x7FFFFFFF) {
+		printf("[ERROR] level storage: cannot read %s\n", path);
+		close();
+		return false;
+	}
+	file_size = static_cast<uint32_t>(size);
+	return true;
+}
+
+void File_level_storage::close() {
+	if (file) fclose(file);
+	file = nullptr;
+	file_size = 0;
+	status = Status::idle;
+}
+
+void File_level_storage::set_throttle(uint32_t latency, uint32_t bandwidth) {
+	latency_us = latency;
+	bytes_per_second = bandwidth;
+}
+
+bool File_level_storage::start_read(uint32_t offset, void* dst, uint32_t size) {
+
+	if (!file || status != Status::idle || uint64_t(offset) + size > file_size) return false;
+
+	// The file is read right away, the throttle only delays the completion
+	bool ok = fseek(file, offset, SEEK_SET) == 0 && fread(dst, 1, size, file) == size;
+	status = ok ? Status::done : Status::failed;
+	ready_at_us = now_us() + latency_us;
+	if (bytes_per_second) ready_at_us += int64_t(size) * 1000000 / bytes_per_second;
+	return true;
+}
+
+Level_storage::Status File_level_storage::poll() {
+
+	if (status == Status::idle) return Status::idle;
+	if (now_us() < ready_at_us) return Status::busy;
+	Status result = status;
+	status = Status::idle;
+	return result;
+}
+#endif
+
+static int32_t floor_div(int32_t a, int32_t b) {
+	return (a >= 0) ? a / b : -((-a + b - 1) / b);
+}
+
+Level_stream::Level_stream(Level_storage& level_storage, uint16_t region_count)
+	: storage(level_storage) {
+
+	if (region_count == 0) {
+		printf("[ERROR] Level_stream: no region\n");
+		region_count = 1;
+	}
+	regions.resize(region_count);
+}
+
+bool Level_stream::open() {
+
+	loading = -1;
+	header = {};
+	if (!storage.read(0, &header, sizeof(header))) {
+		printf("[ERROR] level stream: cannot read the header\n");
+		return false;
+	}
+	if (header.magic != LEVEL_MAGIC || header.version != LEVEL_VERSION) {
+		printf("[ERROR] level stream: not a version %u level\n", LEVEL_VERSION);
+		header = {};
+		return false;
+	}
+	if (header.width == 0 || header.height == 0 || header.chunk_width == 0 || header.chunk_height == 0) {
+		printf("[ERROR] level stream: empty level or chunk\n");
+		header = {};
+		return false;
+	}
+
+	chunks_x = static_cast<uint16_t>((header.width + header.chunk_width - 1) / header.chunk_width);
+	chunks_y = static_cast<uint16_t>((header.height + header.chunk_height - 1) / header.chunk_height);
+	chunk_tiles = uint32_t(header.chunk_width) * header.chunk_height;
+	const uint64_t end = sizeof(Level_header) + uint64_t(chunks_x) * chunks_y * chunk_tiles * sizeof(uint16_t);
+	if (end > storage.size()) {
+		printf("[ERROR] level stream: %u chunks need %llu bytes, %u available\n", static_cast<unsigned>(chunks_x * chunks_y),
+			static_cast<unsigned long long>(end), static_cast<unsigned>(storage.size()));
+		header = {};
+		return false;
+	}
+
+	for (Region& region : regions) region = {0, 0, 0, State::empty};
+	tiles.assign(regions.size() * chunk_tiles, 0);
+	prefetch = std::max(header.chunk_width, header.chunk_height);
+	frame = 0;
+	shortage_reported = false;
+	counters = {};
+	return true;
+}
+
+int32_t Level_stream::find(int32_t chunk_x, int32_t chunk_y) const {
+	for (size_t i = 0; i < regions.size(); i++) {
+		const Region& region = regions[i];
+		if (region.state != State::empty && region.chunk_x == chunk_x && region.chunk_y == chunk_y) return static_cast<int32_t>(i);
+	}
+	return -1;
+}
+
+const uint16_t* Level_stream::chunk(int32_t chunk_x, int32_t chunk_y) const {
+	int32_t i = find(chunk_x, chunk_y);
+	if (i < 0 || regions[i].state != State::ready) return nullptr;
+	return &tiles[size_t(i) * chunk_tiles];
+}
+
+uint16_t Level_stream::tile(int32_t x, int32_t y) const {
+
+	if (x < 0 || y < 0 || x >= header.width || y >= header.height) return LEVEL_TILE_MISSING;
+	const uint16_t* data = chunk(x / header.chunk_width, y / header.chunk_height);
+	if (!data) return LEVEL_TILE_MISSING;
+	return data[(y % header.chunk_height) * header.chunk_width + x % header.chunk_width];
+}
+
+// Tile rectangle [x0, x1) x [y0, y1) to the chunks inside the level, false when empty
+bool Level_stream::chunk_range(int32_t x0, int32_t y0, int32_t x1, int32_t y1, Chunk_range& range) const {
+
+	if (chunk_tiles == 0 || x1 <= x0 || y1 <= y0) return false;
+	range.x0 = std::max(floor_div(x0, header.chunk_width), 0);
+	range.y0 = std::max(floor_div(y0, header.chunk_height), 0);
+	range.x1 = std::min(floor_div(x1 - 1, header.chunk_width), chunks_x - 1);
+	range.y1 = std::min(floor_div(y1 - 1, header.chunk_height), chunks_y - 1);
+	return range.x0 <= range.x1 && range.y0 <= range.y1;
+}
+
+uint32_t Level_stream::want(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+
+	Chunk_range range;
+	if (!chunk_range(x0, y0, x1, y1, range)) return 0;
+	uint32_t missing = 0;
+	for (int32_t cy = range.y0; cy <= range.y1; cy++) {
+		for (int32_t cx = range.x0; cx <= range.x1; cx++) {
+			int32_t i = find(cx, cy);
+			if (i >= 0) regions[i].last_used = frame;
+			if (i < 0 || regions[i].state != State::ready) missing++;
+		}
+	}
+	return missing;
+}
+
+void Level_stream::fetch(int32_t x0, int32_t y0, int32_t x1, int32_t y1, bool visible) {
+
+	Chunk_range range;
+	if (loading >= 0 || !chunk_range(x0, y0, x1, y1, range)) return;
+	for (int32_t cy = range.y0; cy <= range.y1; cy++) {
+		for (int32_t cx = range.x0; cx <= range.x1; cx++) {
+			if (find(cx, cy) >= 0) continue;
+			if (!request(cx, cy) && visible && !shortage_reported) {
+				printf("[ERROR] level stream: %u regions are not enough for the view\n", static_cast<unsigned>(regions.size()));
+				shortage_reported = true;
+			}
+			return;
+		}
+	}
+}
+
+bool Level_stream::request(int32_t chunk_x, int32_t chunk_y) {
+
+	// Empty region first, then the least recently wanted one that this update does not need
+	int32_t victim = -1;
+	for (size_t i = 0; i < regions.size(); i++) {
+		const Region& region = regions[i];
+		if (region.state == State::loading || region.last_used == frame) continue;
+		if (victim < 0 || region.state == State::empty ||
+			(regions[victim].state != State::empty && region.last_used < regions[victim].last_used)) victim = static_cast<int32_t>(i);
+		if (region.state == State::empty) break;
+	}
+	if (victim < 0) return false;
+
+	Region& region = regions[victim];
+	region = {chunk_x, chunk_y, frame, State::loading};
+	const uint32_t bytes = chunk_tiles * sizeof(uint16_t);
+	const uint32_t offset = sizeof(Level_header) + (uint32_t(chunk_y) * chunks_x + chunk_x) * bytes;
+	if (!storage.start_read(offset, &tiles[size_t(victim) * chunk_tiles], bytes)) {
+		printf("[ERROR] level stream: cannot start reading chunk %d,%d\n", static_cast<int>(chunk_x), static_cast<int>(chunk_y));
+		region.state = State::empty;
+		counters.failures++;
+		return true;
+	}
+	loading = victim;
+	counters.reads++;
+	counters.bytes += bytes;
+	return true;
+}
+
+void Level_stream::collect() {
+
+	if (loading < 0) return;
+	Level_storage::Status status = storage.poll();
+	if (status == Level_storage::Status::busy) return;
+
+	Region& region = regions[loading];
+	if (status == Level_storage::Status::done) {
+		region.state = State::ready;
+	} else {
+		if (counters.failures == 0) printf("[ERROR] level stream: reading chunk %d,%d failed\n", static_cast<int>(region.chunk_x), static_cast<int>(region.chunk_y));
+		region.state = State::empty;
+		counters.failures++;
+	}
+	loading = -1;
+}
+
+void Level_stream::update(int32_t view_x, int32_t view_y, int32_t view_width, int32_t view_height) {
+
+	if (chunk_tiles == 0) return;
+	frame++;
+	collect();
+
+	// Direction of motion since the last update, the prefetch area extends that way
+	int32_t dx = (frame > 1) ? view_x - last_view_x : 0;
+	int32_t dy = (frame > 1) ? view_y - last_view_y : 0;
+	last_view_x = view_x;
+	last_view_y = view_y;
+	int32_t x0 = view_x - (dx < 0 ? prefetch : 0);
+	int32_t x1 = view_x + view_width + (dx > 0 ? prefetch : 0);
+	int32_t y0 = view_y - (dy < 0 ? prefetch : 0);
+	int32_t y1 = view_y + view_height + (dy > 0 ? prefetch : 0);
+
+	// Mark everything wanted before fetching, so a fetch never evicts a wanted chunk
+	uint32_t missing = want(view_x, view_y, view_x + view_width, view_y + view_height);
+	if (prefetch) want(x0, y0, x1, y1);
+	if (missing) counters.misses++;
+
+	fetch(view_x, view_y, view_x + view_width, view_y + view_height, true);
+	if (prefetch) fetch(x0, y0, x1, y1, false);
+}
+
+bool Level_stream::load_view(int32_t view_x, int32_t view_y, int32_t view_width, int32_t view_height) {
+
+	// Waiting is the point here, not a miss
+	const uint32_t failures = counters.failures;
+	const uint32_t misses = counters.misses;
+	bool loaded;
+	while (!(loaded = view_loaded(view_x, view_y, view_width, view_height))) {
+		update(view_x, view_y, view_width, view_height);
+		// Nothing in flight and still missing: no region left or the storage fails
+		if (loading < 0 && (counters.failures != failures || shortage_reported)) break;
+	}
+	counters.misses = misses;
+	return loaded;
+}
+
+bool Level_stream::view_loaded(int32_t view_x, int32_t view_y, int32_t view_width, int32_t view_height) const {
+
+	Chunk_range range;
+	if (!chunk_range(view_x, view_y, view_x + view_width, view_y + view_height, range)) return chunk_tiles != 0;
+	for (int32_t cy = range.y0; cy <= range.y1; cy++) {
+		for (int32_t cx = range.x0; cx <= range.x1; cx++) {
+			if (!chunk(cx, cy)) return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,166 @@
+#ifndef LEVEL_STREAM_H
+#define LEVEL_STREAM_H
+
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdio>
+#else
+    #include "pico/stdlib.h"
+#endif
+#include <vector>
+#include "level_format.h"
+
+// Tilemaps bigger than RAM, streamed in chunks around the camera. Instead of one
+// load_level() into a MAX_LEVEL_SIZE block (Docs/memory/level_loading.md), a fixed set of
+// chunk regions is allocated once and refilled while the camera moves: the chunks under
+// the view first, then the ones the camera is moving towards. One read is in flight at a
+// time and update() never waits for it, so a frame does not stall on a storage that reads
+// in the background (DMA, XIP flash through Memory_level_storage). File_level_storage does
+// not: its fread runs inside start_read().
+//
+// The .level layout is in level_format.h, tools/assetc --levels writes it from Tiled CSV.
+
+// Where the level comes from (SD card, flash, file). Reads are asynchronous: start_read()
+// hands over the destination, poll() reports when it is filled. One read at a time.
+class Level_storage {
+public:
+	enum class Status : uint8_t { idle, busy, done, failed };
+
+	virtual ~Level_storage() {}
+
+	// false when the read cannot start (busy, past the end)
+	virtual bool start_read(uint32_t offset, void* dst, uint32_t size) = 0;
+	// busy until the read completes, done / failed are reported once, then idle
+	virtual Status poll() = 0;
+	virtual uint32_t size() const = 0;
+
+	// Blocking read (headers, loading screens)
+	bool read(uint32_t offset, void* dst, uint32_t size);
+};
+
+// Level already addressable: XIP flash, embedded array, file loaded in RAM
+class Memory_level_storage : public Level_storage {
+public:
+	Memory_level_storage(const uint8_t* data, uint32_t size) : data(data), data_size(size) {}
+
+	bool start_read(uint32_t offset, void* dst, uint32_t size) override;
+	Status poll() override;
+	uint32_t size() const override { return data_size; }
+
+private:
+	const uint8_t* data;
+	uint32_t data_size;
+	Status status = Status::idle;
+};
+
+#ifdef PLATFORM_DESKTOP
+// Host file with an optional throttle that behaves like an SD card: a read completes
+// latency_us + size / bytes_per_second after it started. The file is read synchronously in
+// start_read(), on the calling thread, the throttle only delays poll() reporting it done:
+// it models when data arrives, not what a read costs the frame.
+class File_level_storage : public Level_storage {
+public:
+	File_level_storage() = default;
+	~File_level_storage() { close(); }
+	File_level_storage(const File_level_storage&) = delete;
+	File_level_storage& operator=(const File_level_storage&) = delete;
+
+	bool open(const char* path);
+	void close();
+	void set_throttle(uint32_t latency_us, uint32_t bytes_per_second);
+
+	bool start_read(uint32_t offset, void* dst, uint32_t size) override;
+	Status poll() override;
+	uint32_t size() const override { return file_size; }
+
+private:
+	FILE* file = nullptr;
+	uint32_t file_size = 0;
+	uint32_t latency_us = 0;
+	uint32_t bytes_per_second = 0;
+	Status status = Status::idle;
+	int64_t ready_at_us = 0;
+};
+#endif
+
+class Level_stream {
+public:
+	struct Stats {
+		uint32_t reads;
+		uint32_t bytes;
+		uint32_t misses;		// updates where a chunk under the view was not loaded
+		uint32_t failures;		// reads that failed
+	};
+
+	// region_count chunk buffers, allocated by open(). Needs at least the chunks a view can
+	// touch ((view / chunk + 2) squared covers any position) plus a few for prefetch.
+	Level_stream(Level_storage& storage, uint16_t region_count);
+
+	// Reads and checks the header (blocking), allocates the regions, nothing is loaded yet
+	bool open();
+
+	uint16_t width() const { return header.width; }
+	uint16_t height() const { return header.height; }
+	uint16_t chunk_width() const { return header.chunk_width; }
+	uint16_t chunk_height() const { return header.chunk_height; }
+
+	// How far ahead of the view (tiles) chunks are fetched in the direction of motion,
+	// one chunk by default, 0 = only what is under the view
+	void set_prefetch(uint16_t tiles) { prefetch = tiles; }
+
+	// Once per frame with the view in tiles: collects a finished read, starts the next
+	// one. Never blocks.
+	void update(int32_t view_x, int32_t view_y, int32_t view_width, int32_t view_height);
+	// Blocking update() until the whole view is loaded (level start, teleport)
+	bool load_view(int32_t view_x, int32_t view_y, int32_t view_width, int32_t view_height);
+
+	// Loaded chunk tiles (chunk_width * chunk_height, row by row), nullptr if not loaded
+	const uint16_t* chunk(int32_t chunk_x, int32_t chunk_y) const;
+	// LEVEL_TILE_MISSING outside the level or when its chunk is not loaded
+	uint16_t tile(int32_t x, int32_t y) const;
+	bool view_loaded(int32_t view_x, int32_t view_y, int32_t view_width, int32_t view_height) const;
+
+	const Stats& stats() const { return counters; }
+
+private:
+	enum class State : uint8_t { empty, loading, ready };
+
+	struct Region {
+		int32_t chunk_x;
+		int32_t chunk_y;
+		uint32_t last_used;		// update that last wanted it
+		State state;
+	};
+
+	Level_storage& storage;
+	Level_header header = {};
+	uint16_t chunks_x = 0;
+	uint16_t chunks_y = 0;
+	uint32_t chunk_tiles = 0;
+	uint16_t prefetch = 0;
+	uint32_t frame = 0;
+	int32_t last_view_x = 0;
+	int32_t last_view_y = 0;
+	int32_t loading = -1;			// region being read
+	bool shortage_reported = false;
+	Stats counters = {};
+	std::vector<Region> regions;
+	std::vector<uint16_t> tiles;
+
+	struct Chunk_range {
+		int32_t x0, y0, x1, y1;		// inclusive
+	};
+
+	int32_t find(int32_t chunk_x, int32_t chunk_y) const;
+	bool chunk_range(int32_t x0, int32_t y0, int32_t x1, int32_t y1, Chunk_range& range) const;
+	// Marks the loaded / loading chunks of a tile rectangle as used, returns how many are not loaded
+	uint32_t want(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+	// Starts reading the first chunk of the rectangle that has no region (if nothing is in flight)
+	void fetch(int32_t x0, int32_t y0, int32_t x1, int32_t y1, bool visible);
+	// Reads a chunk into the least recently used region, false when every region is wanted
+	bool request(int32_t chunk_x, int32_t chunk_y);
+	void collect();
+};
+
+#endif
@@ -0,0 +1,141 @@
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdio>
+    #include <cstring>
+#else
+    #include "pico/stdlib.h"
+    #include "stdio.h"
+    #include "cstring"
+#endif
+
+#include "lz_stream.h"
+
+bool Lz_stream::open(const uint8_t* stream, size_t size) {
+
+	header = {};
+	if (stream == nullptr || size < sizeof(Lz_header) || reinterpret_cast<uintptr_t>(stream) % 4 != 0) {
+		printf("[ERROR] lz stream: no data\n");
+		return false;
+	}
+	Lz_header h;
+	memcpy(&h, stream, sizeof(h));
+	if (h.magic != LZ_MAGIC || h.chunk_size == 0 || h.chunk_size > LZ_MAX_CHUNK_SIZE ||
+		h.chunk_count != (uint64_t(h.raw_size) + h.chunk_size - 1) / h.chunk_size) {
+		printf("[ERROR] lz stream: bad header\n");
+		return false;
+	}
+	const uint64_t table_end = sizeof(Lz_header) + uint64_t(h.chunk_count) * 4;
+	if (table_end > size) {
+		printf("[ERROR] lz stream: chunk table out of bound\n");
+		return false;
+	}
+
+	// Chunks are back to back, stored ones have exactly their raw size
+	const uint32_t* ends = reinterpret_cast<const uint32_t*>(stream + sizeof(Lz_header));
+	uint32_t start = 0;
+	for (uint32_t i = 0; i < h.chunk_count; i++) {
+		uint32_t end = ends[i] & ~LZ_STORED;
+		uint32_t raw = (i + 1 < h.chunk_count) ? h.chunk_size : h.raw_size - i * h.chunk_size;
+		if (end < start || table_end + end > size || ((ends[i] & LZ_STORED) && end - start != raw)) {
+			printf("[ERROR] lz stream: chunk %u out of bound\n", static_cast<unsigned>(i));
+			return false;
+		}
+		start = end;
+	}
+
+	header = h;
+	chunk_end = ends;
+	chunks = stream + table_end;
+	return true;
+}
+
+Lz_stream::Chunk Lz_stream::chunk(uint32_t index) const {
+
+	if (index >= header.chunk_count) return {nullptr, 0, 0, false};
+	uint32_t start = index == 0 ? 0 : chunk_end[index - 1] & ~LZ_STORED;
+	uint32_t end = chunk_end[index] & ~LZ_STORED;
+	uint32_t raw = (index + 1 < header.chunk_count) ? header.chunk_size : header.raw_size - index * header.chunk_size;
+	return {chunks + start, end - start, raw, (chunk_end[index] & LZ_STORED) != 0};
+}
+
+// LZ4 block: sequences of [token][literal length+][literals][offset16][match length+],
+// token = literal length (high 4 bits) | match length - 4 (low 4 bits), 15 = more bytes
+// follow (255 = continue). The last sequence has literals only.
+int32_t Lz_stream::decode(const Chunk& chunk, uint8_t* window, size_t capacity) {
+
+	if (chunk.data == nullptr || chunk.raw_size > capacity) return -1;
+	if (chunk.stored) {
+		memcpy(window, chunk.data, chunk.raw_size);
+		return static_cast<int32_t>(chunk.raw_size);
+	}
+
+	const uint8_t* src = chunk.data;
+	const uint8_t* const src_end = src + chunk.size;
+	uint8_t* dst = window;
+	uint8_t* const dst_end = window + chunk.raw_size;
+
+	auto read_length = [&](uint32_t length) -> int64_t {
+		if (length != 15) return length;
+		uint8_t byte;
+		do {
+			if (src == src_end) return -1;
+			byte = *src++;
+			length += byte;
+		} while (byte == 255);
+		return length;
+	};
+
+	while (src < src_end) {
+		const uint8_t token = *src++;
+
+		int64_t literals = read_length(token >> 4);
+		if (literals < 0 || literals > src_end - src || literals > dst_end - dst) return -1;
+		memcpy(dst, src, static_cast<size_t>(literals));
+		src += literals;
+		dst += literals;
+		if (src == src_end) break;			// last sequence
+
+		if (src_end - src < 2) return -1;
+		const uint32_t offset = src[0] | (src[1] << 8);
+		src += 2;
+		int64_t length = read_length(token & 15);
+		if (length < 0 || offset == 0 || offset > dst - window) return -1;
+		length += 4;
+		if (length > dst_end - dst) return -1;
+
+		// Far enough back: 8 byte copies, overlapping (RLE like) matches byte by byte
+		const uint8_t* match = dst - offset;
+		if (offset >= 8 && length <= dst_end - dst - 8) {
+			uint8_t* end = dst + length;
+			do {
+				memcpy(dst, match, 8);
+				dst += 8;
+				match += 8;
+			} while (dst < end);
+			dst = end;
+		} else {
+			for (int64_t i = 0; i < length; i++) dst[i] = match[i];
+			dst += length;
+		}
+	}
+	return dst == dst_end ? static_cast<int32_t>(chunk.raw_size) : -1;
+}
+
+bool Lz_stream::decode_all(uint8_t* dst, size_t capacity) const {
+
+	if (capacity < header.raw_size) {
+		printf("[ERROR] lz stream: %u bytes do not fit in %u\n", static_cast<unsigned>(header.raw_size), static_cast<unsigned>(capacity));
+		return false;
+	}
+	uint32_t offset = 0;
+	for (uint32_t i = 0; i < header.chunk_count; i++) {
+		int32_t size = decode(i, dst + offset, capacity - offset);
+		if (size < 0) {
+			printf("[ERROR] lz stream: chunk %u is corrupt\n", static_cast<unsigned>(i));
+			return false;
+		}
+		offset += static_cast<uint32_t>(size);
+	}
+	return true;
+}
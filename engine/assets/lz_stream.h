@@ -0,0 +1,62 @@
+#ifndef LZ_STREAM_H
+#define LZ_STREAM_H
+
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+#else
+    #include "pico/stdlib.h"
+#endif
+#include "asset_pack_format.h"
+
+// Decoder for compressed pack payloads (tools/asset_packer -c). No allocation and no
+// state between chunks: a chunk is decoded into a caller supplied window of chunk_size()
+// bytes. Chunks are located through the chunk table, so the caller can fetch the next
+// chunk (SD / DMA read into a second buffer) while the current one decodes, or seek.
+
+class Lz_stream {
+public:
+	struct Chunk {
+		const uint8_t* data;
+		uint32_t size;			// bytes in the stream
+		uint32_t raw_size;		// bytes once decoded
+		bool stored;			// kept raw, decoding is a copy
+	};
+
+	// stream = compressed payload, used in place. Header and chunk table are validated here.
+	bool open(const uint8_t* stream, size_t size);
+
+	uint32_t raw_size() const { return header.raw_size; }
+	uint32_t chunk_size() const { return header.chunk_size; }
+	uint32_t chunk_count() const { return header.chunk_count; }
+	Chunk chunk(uint32_t index) const;
+
+	// One chunk (from the stream or a copy of its bytes) into window, returns the bytes
+	// written or -1 when the data is corrupt or does not fit
+	static int32_t decode(const Chunk& chunk, uint8_t* window, size_t capacity);
+	int32_t decode(uint32_t index, uint8_t* window, size_t capacity) const { return decode(chunk(index), window, capacity); }
+
+	// Whole payload into dst (raw_size() bytes)
+	bool decode_all(uint8_t* dst, size_t capacity) const;
+
+	// sink(uint32_t raw_offset, const uint8_t* data, uint32_t size) for every chunk in order,
+	// decoded into window (chunk_size() bytes). false when a chunk is corrupt.
+	template<typename Sink>
+	bool decode_chunks(uint8_t* window, size_t capacity, Sink&& sink) const {
+		uint32_t offset = 0;
+		for (uint32_t i = 0; i < header.chunk_count; i++) {
+			int32_t size = decode(i, window, capacity);
+			if (size < 0) return false;
+			sink(offset, static_cast<const uint8_t*>(window), static_cast<uint32_t>(size));
+			offset += static_cast<uint32_t>(size);
+		}
+		return true;
+	}
+
+private:
+	Lz_header header = {};
+	const uint32_t* chunk_end = nullptr;
+	const uint8_t* chunks = nullptr;
+};
+
+#endif
@@ -0,0 +1,148 @@
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdio>
+#else
+    #include "pico/stdlib.h"
+    #include "stdio.h"
+#endif
+
+#include "animation.h"
+
+Animation_system::Animation_system(std::span<const Animation_clip> source) {
+
+	clips.reserve(source.size());
+	for (const Animation_clip& clip : source) {
+		Clip_range range{static_cast<uint16_t>(frame_atlas.size()), clip.frame_count, clip.mode, 0};
+		if (clip.frame_count == 0) {
+			printf("[ERROR] Animation_system: empty clip %u\n", static_cast<unsigned>(clips.size()));
+			// Still playable, shows atlas frame 0
+			frame_atlas.push_back(0);
+			frame_duration.push_back(Fixed_q16::max());
+			range.count = 1;
+		}
+		for (uint16_t f = 0; f < clip.frame_count; f++) {
+			Fixed_q16 duration = clip.frames[f].duration;
+			if (duration <= 0) {
+				printf("[ERROR] Animation_system: clip %u frame %u has no duration\n", static_cast<unsigned>(clips.size()), f);
+				duration = Fixed_q16::epsilon();
+			}
+			frame_atlas.push_back(clip.frames[f].atlas_frame);
+			frame_duration.push_back(duration);
+		}
+
+		// Time after which a looping clip is back on the same frame going the same way
+		if (range.count > 1 && range.mode != Animation_mode::once) {
+			int64_t cycle = 0;
+			for (uint16_t f = 0; f < range.count; f++) cycle += frame_duration[range.first + f].raw;
+			if (range.mode == Animation_mode::ping_pong) {
+				cycle = 2 * cycle - frame_duration[range.first].raw - frame_duration[range.first + range.count - 1].raw;
+			}
+			range.cycle = cycle <= INT32_MAX ? static_cast<int32_t>(cycle) : 0;
+		}
+		clips.push_back(range);
+	}
+}
+
+void Animation_system::play(uint32_t id, uint16_t clip) {
+
+	if (id == NONE) {
+		printf("[ERROR] Animation_system: invalid id\n");
+		return;
+	}
+	if (clip >= clips.size()) {
+		printf("[ERROR] Animation_system: clip %u out of bound\n", clip);
+		return;
+	}
+	const Clip_range& range = clips[clip];
+
+	if (!contains(id)) {
+		if (id >= index_of.size()) index_of.resize(id + 1, NONE);
+		index_of[id] = static_cast<uint32_t>(entity.size());
+		entity.push_back(id);
+		clip_of.push_back(0);
+		frame.push_back(0);
+		direction.push_back(0);
+		time_left.push_back(0);
+		current_atlas.push_back(0);
+	}
+
+	uint32_t i = index_of[id];
+	clip_of[i] = clip;
+	frame[i] = 0;
+	// A single frame only ever ends when it is a once clip
+	direction[i] = (range.count > 1 || range.mode == Animation_mode::once) ? 1 : 0;
+	time_left[i] = frame_duration[range.first];
+	current_atlas[i] = frame_atlas[range.first];
+}
+
+void Animation_system::remove(uint32_t id) {
+
+	if (!contains(id)) return;
+
+	// Swap with the last animation
+	uint32_t i = index_of[id];
+	size_t last = entity.size() - 1;
+	entity[i] = entity[last];
+	clip_of[i] = clip_of[last];
+	frame[i] = frame[last];
+	direction[i] = direction[last];
+	time_left[i] = time_left[last];
+	current_atlas[i] = current_atlas[last];
+	index_of[entity[i]] = i;
+	index_of[id] = NONE;
+
+	entity.pop_back();
+	clip_of.pop_back();
+	frame.pop_back();
+	direction.pop_back();
+	time_left.pop_back();
+	current_atlas.pop_back();
+}
+
+void Animation_system::update(Fixed_q16 dt) {
+
+	// Most animations stay on their frame: one subtract and compare per entity,
+	// frame changes go to advance()
+	const size_t count = entity.size();
+	for (size_t i = 0; i < count; i++) {
+		if (direction[i] == 0) continue;
+		time_left[i] -= dt;
+		if (time_left[i] <= 0) advance(i);
+	}
+}
+
+void Animation_system::advance(size_t i) {
+
+	const Clip_range& range = clips[clip_of[i]];
+
+	// Skip whole cycles of a long dt (paused game, debugger) instead of walking them
+	if (range.cycle > 0 && time_left[i].raw <= -range.cycle) {
+		time_left[i] = Fixed_q16::from_raw(-(-time_left[i].raw % range.cycle));
+	}
+
+	int current = frame[i];
+	int step = direction[i];
+	while (time_left[i] <= 0) {
+		int next = current + step;
+		if (next < 0 || next >= range.count) {
+			if (range.mode == Animation_mode::once) {
+				step = 0;
+				time_left[i] = 0;
+				break;
+			}
+			if (range.mode == Animation_mode::loop || range.count == 1) {
+				next = 0;
+			} else {
+				step = -step;
+				next = current + step;
+			}
+		}
+		current = next;
+		time_left[i] += frame_duration[range.first + current];
+	}
+
+	frame[i] = static_cast<uint16_t>(current);
+	direction[i] = static_cast<int8_t>(step);
+	current_atlas[i] = frame_atlas[range.first + current];
+}
@@ -0,0 +1,90 @@
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+#else
+    #include "pico/stdlib.h"
+#endif
+#include <vector>
+#include <span>
+#include "engine/math/fixed_point.h"
+
+// Sprite animation: clips are sequences of atlas frames (Sprite_atlas frame ids) with a
+// duration per frame in Fixed_q16 seconds. Time is fixed point, so the same dt sequence
+// gives the same frames on desktop and MCU.
+
+enum class Animation_mode : uint8_t {
+	once,			// stops on the last frame
+	loop,			// 0 1 2 0 1 2 ...
+	ping_pong		// 0 1 2 1 0 1 ...
+};
+
+struct Animation_frame {
+	uint16_t atlas_frame;
+	Fixed_q16 duration;		// seconds, > 0
+};
+
+struct Animation_clip {
+	const Animation_frame* frames;
+	uint16_t frame_count;
+	Animation_mode mode;
+};
+
+// Animation component for dense ids (entity id / component index), stored as SoA so
+// update() is one pass over flat arrays. atlas_frames() is parallel to ids() and is what
+// the render queue reads.
+class Animation_system {
+public:
+	// Clips are copied, clip ids are indices into this span
+	explicit Animation_system(std::span<const Animation_clip> clips);
+
+	// Starts (or restarts) clip from its first frame
+	void play(uint32_t id, uint16_t clip);
+	void remove(uint32_t id);
+
+	bool contains(uint32_t id) const { return id < index_of.size() && index_of[id] != NONE; }
+	size_t size() const { return entity.size(); }
+
+	// Advance every animation by dt seconds
+	void update(Fixed_q16 dt);
+
+	uint16_t atlas_frame(uint32_t id) const { return current_atlas[index_of[id]]; }
+	// A once clip is past the end of its last frame
+	bool finished(uint32_t id) const {
+		uint32_t i = index_of[id];
+		return direction[i] == 0 && clips[clip_of[i]].mode == Animation_mode::once;
+	}
+
+	std::span<const uint32_t> ids() const { return entity; }
+	std::span<const uint16_t> atlas_frames() const { return current_atlas; }
+
+private:
+	static constexpr uint32_t NONE = UINT32_MAX;
+
+	// Frames of all clips in one table, a clip is a range of it
+	struct Clip_range {
+		uint16_t first;
+		uint16_t count;
+		Animation_mode mode;
+		int32_t cycle;		// raw Fixed_q16 length of one loop, 0 = none
+	};
+	std::vector<Clip_range> clips;
+	std::vector<uint16_t> frame_atlas;
+	std::vector<Fixed_q16> frame_duration;
+
+	// Per animation
+	std::vector<uint32_t> entity;
+	std::vector<uint16_t> clip_of;
+	std::vector<uint16_t> frame;			// position in the clip
+	std::vector<int8_t> direction;			// +1 / -1, 0 = stopped
+	std::vector<Fixed_q16> time_left;		// on the current frame
+	std::vector<uint16_t> current_atlas;
+
+	std::vector<uint32_t> index_of;			// id -> index
+
+	void advance(size_t i);
+};
+
+#endif
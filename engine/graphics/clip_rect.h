@@ -0,0 +1,40 @@
+#ifndef CLIP_RECT_H
+#define CLIP_RECT_H
+
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include "platform_desktop.h"
+#else
+    #include "pico/stdlib.h"
+    #include "display.h"
+#endif
+
+// Part of a width x height rect at (x, y) that is on screen, computed once per call so
+// the drawing loops never test bounds. src_x / src_y = first visible pixel of the rect.
+// Shared by the RGB565 and the indexed framebuffer.
+struct Clip_rect {
+	int x;
+	int y;
+	int width;
+	int height;
+	int src_x;
+	int src_y;
+
+	bool empty() const { return width <= 0 || height <= 0; }
+};
+
+static inline Clip_rect clip_to_screen(int x, int y, int width, int height) {
+
+	int left = x < 0 ? 0 : x;
+	int top = y < 0 ? 0 : y;
+	// 64 bit: x + width may not fit an int for far off screen objects
+	int64_t right = static_cast<int64_t>(x) + width;
+	int64_t bottom = static_cast<int64_t>(y) + height;
+	if (right > DISPLAY_WIDTH) right = DISPLAY_WIDTH;
+	if (bottom > DISPLAY_HEIGHT) bottom = DISPLAY_HEIGHT;
+	// Nothing visible: out before left - x, which overflows for x near INT_MIN
+	if (right <= left || bottom <= top) return {0, 0, 0, 0, 0, 0};
+	return {left, top, static_cast<int>(right - left), static_cast<int>(bottom - top), left - x, top - y};
+}
+
+#endif
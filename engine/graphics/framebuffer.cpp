@@ -12,7 +12,11 @@
     #include "display.h"
 #endif
 
+#include <algorithm>
+
 #include "framebuffer.h"
+#include "clip_rect.h"
+#include "profiler.h"
 
 // Buffer definitions (shared across all files)
 uint16_t Framebuffer::framebuffer_0[DISPLAY_HEIGHT * DISPLAY_WIDTH];
@@ -41,6 +45,7 @@ void Framebuffer::init() {
 }
 
 void Framebuffer::send_to_display() {
+	PROFILE_ZONE("flush");
 	swap_endian(front_buffer);
 	set_window(0, 0, DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1);
 	uint16_t buffer_size = DISPLAY_WIDTH * DISPLAY_HEIGHT;
@@ -55,9 +60,9 @@ void Framebuffer::swap_buffers() {
 	back_buffer = buffer;
 }
 
-void Framebuffer::set_pixel(uint16_t x, uint16_t y, uint16_t color) {
+void Framebuffer::set_pixel(int x, int y, uint16_t color) {
 
-	if(x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) return;
+	if (static_cast<unsigned>(x) >= DISPLAY_WIDTH || static_cast<unsigned>(y) >= DISPLAY_HEIGHT) return;
 	back_buffer[y * DISPLAY_WIDTH + x] = color;
 }
 void Framebuffer::fill_with_color(uint16_t color) {
@@ -68,169 +73,403 @@ void Framebuffer::fill_with_color(uint16_t color) {
 	draw_rectangle_memset(0, DISPLAY_HEIGHT, 0, DISPLAY_WIDTH, color);
 }
 
-void Framebuffer::draw_line(uint16_t x, uint16_t y, uint16_t width, uint16_t color) {
+void Framebuffer::draw_line(int x, int y, int width, uint16_t color) {
+
+	Clip_rect clip = clip_to_screen(x, y, width, 1);
+	if (clip.empty()) return;
 
-	for (size_t i = 0; i < width; i++) {
-		back_buffer[y * DISPLAY_WIDTH + x + i] = color;
+	uint16_t* line = &back_buffer[clip.y * DISPLAY_WIDTH + clip.x];
+	for (int i = 0; i < clip.width; i++) {
+		line[i] = color;
 	}
 }
-void Framebuffer::draw_rectangle(uint16_t y, uint16_t height, uint16_t x, uint16_t width, uint16_t color) {
+void Framebuffer::draw_rectangle(int y, int height, int x, int width, uint16_t color) {
 
+	Clip_rect clip = clip_to_screen(x, y, width, height);
+	if (clip.empty()) return;
 
-	if(y > DISPLAY_HEIGHT) {
-		printf("[ERROR] starting raw out of bound\n");
-		return;
+	for (int row = 0; row < clip.height; row++) {
+		uint16_t* line = &back_buffer[(clip.y + row) * DISPLAY_WIDTH + clip.x];
+		for (int i = 0; i < clip.width; i++) {
+			line[i] = color;
+		}
 	}
-	if(height > DISPLAY_WIDTH - y) {
-		printf("[ERROR] number of raws out of bound\n");
-		return;
+}
+void Framebuffer::draw_rectangle_memset(int y, int height, int x, int width, uint16_t color) {
+
+	Clip_rect clip = clip_to_screen(x, y, width, height);
+	if (clip.empty()) return;
+
+	uint16_t *line = &back_buffer[clip.y * DISPLAY_WIDTH + clip.x];
+	for (int i = 0; i < clip.width; i++) {
+		line[i] = color;
 	}
 
-	size_t end_raw_y = y + height;
-	for (size_t i = y; i < end_raw_y; i++) {
-		draw_line(x, i, width, color);
+	size_t line_len = clip.width * sizeof(uint16_t);
+	uint16_t *dest = line + DISPLAY_WIDTH;
+	for (int i = 1; i < clip.height; i++) {
+		memcpy(dest, line, line_len);
+		dest += DISPLAY_WIDTH;
 	}
 }
-void Framebuffer::draw_rectangle_memset(uint16_t y, uint16_t height, uint16_t x, uint16_t width, uint16_t color) {
 
-	if(y > DISPLAY_HEIGHT) {
-		printf("[ERROR] starting raw out of bound\n");
-		return;
+void Framebuffer::draw_sprite(int y, int height, int x, int width, const uint16_t* sprite) {
+
+	Clip_rect clip = clip_to_screen(x, y, width, height);
+	if (clip.empty()) return;
+
+	for (int row = 0; row < clip.height; row++) {
+		const uint16_t* src = &sprite[(clip.src_y + row) * width + clip.src_x];
+		uint16_t* dst = &back_buffer[(clip.y + row) * DISPLAY_WIDTH + clip.x];
+
+		for (int i = 0; i < clip.width; i++) {
+			uint16_t pixel = src[i];
+			if (pixel == 0x1FF8) continue;  // Skip transparency
+			dst[i] = pixel;
+		}
 	}
-	if(height > DISPLAY_WIDTH - y) {
-		printf("[ERROR] number of raws out of bound\n");
+}
+
+// One RGB565 + Alpha8 sprite pixel over the background
+static inline void blend_pixel(SpritePixel pixel, uint16_t& dst) {
+
+	// Skip near-transparent pixels
+	if (pixel.alpha < 10) return;
+
+	// Full opaque - just write directly (native little-endian)
+	if (pixel.alpha == 255) {
+		dst = pixel.color;
 		return;
 	}
 
-	uint16_t *line = &back_buffer[y * DISPLAY_WIDTH + x];
-	for (size_t i = 0; i < width; i++) {
-		line[i] = color;
+	dst = Framebuffer::blend_rgb565(dst, pixel);
+}
+
+// One visible row of an RGB565 + Alpha8 sprite
+static inline void blend_row(const SpritePixel* src, uint16_t* dst, int width) {
+	for (int i = 0; i < width; i++) blend_pixel(src[i], dst[i]);
+}
+
+// Pixel readers for the blits shared by both sprite layouts, src[i] is the pixel i
+// (negative too) from the current position
+struct Pixel_source {
+	const SpritePixel* pixels;
+
+	SpritePixel operator[](int32_t i) const { return pixels[i]; }
+	Pixel_source at(int32_t i) const { return {pixels + i}; }
+};
+
+struct Planes_source {
+	const uint16_t* color;
+	const uint8_t* alpha;
+
+	SpritePixel operator[](int32_t i) const { return {color[i], alpha[i]}; }
+	Planes_source at(int32_t i) const { return {color + i, alpha + i}; }
+};
+
+static inline void blend_row(const Pixel_source& src, uint16_t* dst, int width) {
+	blend_row(src.pixels, dst, width);
+}
+
+static inline void blend_row(const Planes_source& src, uint16_t* dst, int width) {
+	for (int i = 0; i < width; i++) blend_pixel(src[i], dst[i]);
+}
+
+void Framebuffer::draw_sprite_alpha(int y, int height, int x, int width, const SpritePixel* sprite) {
+
+	Clip_rect clip = clip_to_screen(x, y, width, height);
+	if (clip.empty()) return;
+
+	for (int row = 0; row < clip.height; row++) {
+		blend_row(&sprite[(clip.src_y + row) * width + clip.src_x],
+				  &back_buffer[(clip.y + row) * DISPLAY_WIDTH + clip.x], clip.width);
 	}
+}
 
-	size_t line_len = width * sizeof(uint16_t);
-	uint16_t *dest = line + DISPLAY_WIDTH;
-	for (size_t i = 1; i < height; i++) {
-		memcpy(dest, line, line_len);
-		dest += DISPLAY_WIDTH;
+void Framebuffer::draw_sprite_planes(const Sprite_planes& sprite, int x, int y) {
+
+	Clip_rect clip = clip_to_screen(x, y, sprite.width, sprite.height);
+	if (clip.empty()) return;
+
+	for (int row = 0; row < clip.height; row++) {
+		const int32_t offset = (clip.src_y + row) * sprite.width + clip.src_x;
+		blend_row(Planes_source{sprite.color + offset, sprite.alpha + offset},
+				  &back_buffer[(clip.y + row) * DISPLAY_WIDTH + clip.x], clip.width);
 	}
 }
 
-void Framebuffer::draw_sprite(uint16_t y, uint16_t height, uint16_t x, uint16_t width, const uint16_t* sprite) {
+void Framebuffer::draw_sprite_region(const Sprite_atlas& atlas, uint16_t frame_id, int x, int y) {
 
-	if(y > DISPLAY_HEIGHT) {
-		printf("[ERROR] starting raw out of bound\n");
+	if (frame_id >= atlas.frame_count) {
+		printf("[ERROR] atlas frame out of bound\n");
 		return;
 	}
-	if(height > DISPLAY_WIDTH - y) {
-		printf("[ERROR] number of raws out of bound\n");
+	// Offsets are >= 0: past the right / bottom edge stays off screen, and x + offset cannot overflow
+	if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) return;
+	const Atlas_frame& frame = atlas.frames[frame_id];
+
+	// Clip the trimmed rect against the screen
+	Clip_rect clip = clip_to_screen(x + frame.offset_x, y + frame.offset_y, frame.width, frame.height);
+	if (clip.empty()) return;
+
+	for (int row = 0; row < clip.height; row++) {
+		blend_row(&atlas.pixels[(frame.y + clip.src_y + row) * atlas.width + frame.x + clip.src_x],
+				  &back_buffer[(clip.y + row) * DISPLAY_WIDTH + clip.x], clip.width);
+	}
+}
+
+void Framebuffer::draw_sprite_region(const Sprite_atlas_planes& atlas, uint16_t frame_id, int x, int y) {
+
+	if (frame_id >= atlas.frame_count) {
+		printf("[ERROR] atlas frame out of bound\n");
 		return;
 	}
+	if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) return;
+	const Atlas_frame& frame = atlas.frames[frame_id];
 
-	for (size_t i = y; i < height; i++)
-	{
-		for (size_t j = 0; j < width; j++)
-		{
-			// if (sprite[(i - y) * width + j] == 0x1FF8) continue;
-			// back_buffer[i * DISPLAY_WIDTH + x + j ] = sprite[(i - y) * width + j];
+	Clip_rect clip = clip_to_screen(x + frame.offset_x, y + frame.offset_y, frame.width, frame.height);
+	if (clip.empty()) return;
 
-			uint16_t pixel = sprite[i * width + j];
-			if (pixel == 0x1FF8) continue;  // Skip transparency
-			back_buffer[(y + i) * DISPLAY_WIDTH + x + j] = pixel;
-		}
+	for (int row = 0; row < clip.height; row++) {
+		const int32_t offset = (frame.y + clip.src_y + row) * atlas.width + frame.x + clip.src_x;
+		blend_row(Planes_source{atlas.color + offset, atlas.alpha + offset},
+				  &back_buffer[(clip.y + row) * DISPLAY_WIDTH + clip.x], clip.width);
 	}
 }
-void Framebuffer::draw_sprite_alpha(uint16_t y, uint16_t height, uint16_t x, uint16_t width, const SpritePixel* sprite) {
 
-	if(y > DISPLAY_HEIGHT) {
-		printf("[ERROR] starting raw out of bound\n");
+// Transformed blit. Each screen pixel center is mapped back into the sprite (inverse
+// transform), sprite coordinates are Q16.16 and step by a constant per pixel and per row.
+// The visible run of every scanline is solved once per row (division), the pixel loop
+// then only adds: integer and fractional parts of u/v step separately, a fraction carry
+// moves the source index by 1 pixel or 1 row, no multiply and no bounds test per pixel.
+
+// Floor / ceil of a / b for any signs
+static inline int64_t floor_div(int64_t a, int64_t b) {
+	int64_t q = a / b;
+	return (a % b != 0 && ((a < 0) != (b < 0))) ? q - 1 : q;
+}
+static inline int64_t ceil_div(int64_t a, int64_t b) {
+	return -floor_div(-a, b);
+}
+
+// Narrow [first, last] to the steps k where start + k * step is inside [0, limit)
+static inline void narrow_span(int64_t start, int64_t step, int64_t limit, int64_t& first, int64_t& last) {
+	if (step == 0) {
+		if (start < 0 || start >= limit) last = first - 1;
 		return;
 	}
-	if(height > DISPLAY_WIDTH - y) {
-		printf("[ERROR] number of raws out of bound\n");
+	int64_t lo = step > 0 ? ceil_div(-start, step) : ceil_div(limit - 1 - start, step);
+	int64_t hi = step > 0 ? floor_div(limit - 1 - start, step) : floor_div(-start, step);
+	if (lo > first) first = lo;
+	if (hi < last) last = hi;
+}
+
+static constexpr int32_t MIN_SCALE_RAW = 1 << 8;		// 1/256
+static constexpr int MAX_TRANSFORMED_SIZE = 0x7FFF;
+
+template<typename Source>
+static void blit_transformed(int x, int y, int width, int height, Source sprite, const Sprite_transform& transform) {
+
+	if (width <= 0 || height <= 0) return;
+	if (width > MAX_TRANSFORMED_SIZE || height > MAX_TRANSFORMED_SIZE ||
+		transform.scale_x.raw < MIN_SCALE_RAW || transform.scale_y.raw < MIN_SCALE_RAW) {
+		printf("[ERROR] draw_sprite_transformed: sprite %dx%d or scale out of range\n", width, height);
 		return;
 	}
 
-	size_t end_y = y + height;
-	for (size_t i = y; i < end_y; i++)
-	{
-		for (size_t j = 0; j < width; j++)
-		{
-			const SpritePixel& pixel = sprite[(i - y) * width + j];
-
-			// Skip near-transparent pixels
-			if (pixel.alpha < 10) continue;
+	// Flips only: 1:1 rows, read backwards and/or bottom up
+	if (transform.angle == 0 && transform.scale_x == 1 && transform.scale_y == 1) {
+		Clip_rect clip = clip_to_screen(x, y, width, height);
+		if (clip.empty()) return;
 
-			size_t buffer_index = i * DISPLAY_WIDTH + x + j;
+		for (int row = 0; row < clip.height; row++) {
+			int src_row = clip.src_y + row;
+			if (transform.flip_y) src_row = height - 1 - src_row;
+			uint16_t* dst = &Framebuffer::back_buffer[(clip.y + row) * DISPLAY_WIDTH + clip.x];
 
-			// Full opaque - just write directly (native little-endian)
-			if (pixel.alpha == 255) {
-				back_buffer[buffer_index] = pixel.color;
+			if (!transform.flip_x) {
+				blend_row(sprite.at(src_row * width + clip.src_x), dst, clip.width);
 				continue;
 			}
+			const Source src = sprite.at(src_row * width + width - 1 - clip.src_x);
+			for (int i = 0; i < clip.width; i++) blend_pixel(src[-i], dst[i]);
+		}
+		return;
+	}
 
-			// Alpha blending - native little-endian RGB565 (CPU natural format)
-			// RGB565: [RRRRR GGGGGG BBBBB] as uint16_t
-
-			// Extract sprite RGB (simple bit shifts!)
-			uint8_t sr = (pixel.color >> 11) & 0x1F;  // R: bits 15-11
-			uint8_t sg = (pixel.color >> 5) & 0x3F;   // G: bits 10-5
-			uint8_t sb = pixel.color & 0x1F;          // B: bits 4-0
-
-			// Extract background RGB (simple bit shifts!)
-			uint16_t bg = back_buffer[buffer_index];
-			uint8_t br = (bg >> 11) & 0x1F;
-			uint8_t bg_g = (bg >> 5) & 0x3F;
-			uint8_t bb = bg & 0x1F;
-
-			// Blend: result = (sprite * alpha + bg * (255 - alpha)) / 255
-			uint8_t inv_alpha = 255 - pixel.alpha;
-			uint8_t r = (sr * pixel.alpha + br * inv_alpha) / 255;
-			uint8_t g = (sg * pixel.alpha + bg_g * inv_alpha) / 255;
-			uint8_t b = (sb * pixel.alpha + bb * inv_alpha) / 255;
+	const int64_t cos_raw = Fixed_math::cos(transform.angle).raw;
+	const int64_t sin_raw = Fixed_math::sin(transform.angle).raw;
+	const int64_t scale_x = transform.scale_x.raw;
+	const int64_t scale_y = transform.scale_y.raw;
+
+	// Screen bounds of the transformed quad around the pivot (Q16.16), 1 pixel margin
+	// for rounding, the per row spans below are exact
+	const int64_t pivot_x = (int64_t(x) << 16) + (int64_t(width) << 15);
+	const int64_t pivot_y = (int64_t(y) << 16) + (int64_t(height) << 15);
+	const int64_t abs_cos = cos_raw < 0 ? -cos_raw : cos_raw;
+	const int64_t abs_sin = sin_raw < 0 ? -sin_raw : sin_raw;
+	const int64_t half_w = (((abs_cos * scale_x) >> 16) * width + ((abs_sin * scale_y) >> 16) * height) >> 1;
+	const int64_t half_h = (((abs_sin * scale_x) >> 16) * width + ((abs_cos * scale_y) >> 16) * height) >> 1;
+
+	const int64_t left = std::max<int64_t>(((pivot_x - half_w) >> 16) - 1, 0);
+	const int64_t top = std::max<int64_t>(((pivot_y - half_h) >> 16) - 1, 0);
+	const int64_t right = std::min<int64_t>(((pivot_x + half_w) >> 16) + 2, DISPLAY_WIDTH);
+	const int64_t bottom = std::min<int64_t>(((pivot_y + half_h) >> 16) + 2, DISPLAY_HEIGHT);
+	if (left >= right || top >= bottom) return;
+
+	// Inverse mapping, sprite space per screen pixel:
+	// u - cu = flip_x / scale_x * ( cos * dx + sin * dy)
+	// v - cv = flip_y / scale_y * (-sin * dx + cos * dy)
+	const int64_t inv_x = (int64_t(1) << 32) / scale_x;
+	const int64_t inv_y = (int64_t(1) << 32) / scale_y;
+	const int64_t sign_x = transform.flip_x ? -1 : 1;
+	const int64_t sign_y = transform.flip_y ? -1 : 1;
+	const int64_t du_dx = sign_x * ((cos_raw * inv_x) >> 16);
+	const int64_t du_dy = sign_x * ((sin_raw * inv_x) >> 16);
+	const int64_t dv_dx = sign_y * ((-sin_raw * inv_y) >> 16);
+	const int64_t dv_dy = sign_y * ((cos_raw * inv_y) >> 16);
+
+	// Sprite position of the center of pixel (left, top)
+	const int64_t dx = (left << 16) + 0x8000 - pivot_x;
+	const int64_t dy = (top << 16) + 0x8000 - pivot_y;
+	int64_t row_u = (int64_t(width) << 15) + ((du_dx * dx) >> 16) + ((du_dy * dy) >> 16);
+	int64_t row_v = (int64_t(height) << 15) + ((dv_dx * dx) >> 16) + ((dv_dy * dy) >> 16);
+
+	const int64_t limit_u = int64_t(width) << 16;
+	const int64_t limit_v = int64_t(height) << 16;
+
+	// Per pixel steps split into whole pixels (floor) and fraction
+	const int32_t step_u = static_cast<int32_t>(du_dx >> 16);
+	const int32_t step_v = static_cast<int32_t>(dv_dx >> 16);
+	const uint32_t frac_step_u = static_cast<uint32_t>(du_dx & 0xFFFF);
+	const uint32_t frac_step_v = static_cast<uint32_t>(dv_dx & 0xFFFF);
+	const int32_t step_index = step_u + step_v * width;
+
+	for (int64_t row = top; row < bottom; row++, row_u += du_dy, row_v += dv_dy) {
+
+		int64_t first = 0;
+		int64_t last = right - left - 1;
+		narrow_span(row_u, du_dx, limit_u, first, last);
+		narrow_span(row_v, dv_dx, limit_v, first, last);
+		if (first > last) continue;
+
+		const int64_t u = row_u + first * du_dx;
+		const int64_t v = row_v + first * dv_dx;
+		int32_t index = static_cast<int32_t>((v >> 16) * width + (u >> 16));
+		uint32_t frac_u = static_cast<uint32_t>(u & 0xFFFF);
+		uint32_t frac_v = static_cast<uint32_t>(v & 0xFFFF);
+
+		uint16_t* dst = &Framebuffer::back_buffer[row * DISPLAY_WIDTH + left + first];
+		const int count = static_cast<int>(last - first + 1);
+
+		// No rotation: the source row is fixed, only u moves
+		if (dv_dx == 0) {
+			const Source src = sprite.at(static_cast<int32_t>((v >> 16) * width));
+			uint32_t u_fixed = static_cast<uint32_t>(u);
+			for (int i = 0; i < count; i++, u_fixed += static_cast<uint32_t>(du_dx)) {
+				blend_pixel(src[static_cast<int32_t>(u_fixed >> 16)], dst[i]);
+			}
+			continue;
+		}
 
-			// Pack back to RGB565 (simple bit shifts!)
-			back_buffer[buffer_index] = (r << 11) | (g << 5) | b;
+		for (int i = 0; i < count; i++) {
+			blend_pixel(sprite[index], dst[i]);
+			frac_u += frac_step_u;
+			frac_v += frac_step_v;
+			index += step_index + static_cast<int32_t>(frac_u >> 16) + (-static_cast<int32_t>(frac_v >> 16) & width);
+			frac_u &= 0xFFFF;
+			frac_v &= 0xFFFF;
 		}
 	}
 }
 
-void Framebuffer::draw_line_bresenham(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
-	if (x0 >= DISPLAY_WIDTH || x1 >= DISPLAY_WIDTH ||
-	y0 >= DISPLAY_HEIGHT || y1 >= DISPLAY_HEIGHT) return;
+void Framebuffer::draw_sprite_transformed(int x, int y, int width, int height, const SpritePixel* sprite, const Sprite_transform& transform) {
+	blit_transformed(x, y, width, height, Pixel_source{sprite}, transform);
+}
+
+void Framebuffer::draw_sprite_transformed(const Sprite_planes& sprite, int x, int y, const Sprite_transform& transform) {
+	blit_transformed(x, y, sprite.width, sprite.height, Planes_source{sprite.color, sprite.alpha}, transform);
+}
+
+
+static constexpr int64_t MAX_LINE_LENGTH = int64_t(1) << 28;
 
-	uint16_t dx = abs(x1 - x0);
-	uint16_t dy = abs(y1 - y0);
+void Framebuffer::draw_line_bresenham(int x0, int y0, int x1, int y1, uint16_t color) {
 
+	// Walk the major axis a, the minor axis b moves when the error term goes positive.
+	// After k major steps the minor axis has moved m(k) = (2 db k + da - 1) / (2 da) times,
+	// so the line can start at the first on screen step with the same pixels as the
+	// unclipped line, and stop at the last one.
+	int64_t dx = x1 > x0 ? static_cast<int64_t>(x1) - x0 : static_cast<int64_t>(x0) - x1;
+	int64_t dy = y1 > y0 ? static_cast<int64_t>(y1) - y0 : static_cast<int64_t>(y0) - y1;
 	int sx = (x0 < x1) ? 1 : -1;
 	int sy = (y0 < y1) ? 1 : -1;
 
-	if (dx >= dy) {
-		// Shallow: x is fast axis
-		int y = y0;
-		int d = 2*dy - dx;
-		for(int x = x0; x != x1; x += sx) {
-			back_buffer[y * DISPLAY_WIDTH + x] = color;
-			if(d > 0) {
-				y += sy;
-				d -= 2*dx;
-			}
-			d += 2*dy;
-		}
-	} else {
-		// Steep: y is fast axis
-		int x = x0;
-		int d = 2*dx - dy;
-		for(int y = y0; y != y1; y += sy)
-		{
-			back_buffer[y * DISPLAY_WIDTH + x] = color;
-			if(d > 0) {
-				x += sx;
-				d -= 2*dy;
-			}
-			d += 2*dx;
-		}
+	const bool steep = dy > dx;
+	const int64_t da = steep ? dy : dx;
+	const int64_t db = steep ? dx : dy;
+	const int64_t a0 = steep ? y0 : x0;
+	const int64_t b0 = steep ? x0 : y0;
+	const int sa = steep ? sy : sx;
+	const int sb = steep ? sx : sy;
+	const int64_t a_size = steep ? DISPLAY_HEIGHT : DISPLAY_WIDTH;
+	const int64_t b_size = steep ? DISPLAY_WIDTH : DISPLAY_HEIGHT;
+
+	if (da == 0) {
+		set_pixel(x0, y0, color);
+		return;
+	}
+	// Keeps 2 db k within 64 bits
+	if (da > MAX_LINE_LENGTH) {
+		printf("[ERROR] line longer than %ld pixels\n", static_cast<long>(MAX_LINE_LENGTH));
+		return;
+	}
+	auto minor_steps = [&](int64_t k) { return (2 * db * k + da - 1) / (2 * da); };
+
+	// Steps with the major axis on screen
+	int64_t k_first = sa > 0 ? -a0 : a0 - (a_size - 1);
+	int64_t k_last = sa > 0 ? a_size - 1 - a0 : a0;
+	if (k_first < 0) k_first = 0;
+	if (k_last > da) k_last = da;
+	if (k_first > k_last) return;
+
+	// Steps with the minor axis on screen, m(k) never decreases
+	int64_t m_min = sb > 0 ? -b0 : b0 - (b_size - 1);
+	int64_t m_max = sb > 0 ? b_size - 1 - b0 : b0;
+	int64_t lo = k_first, hi = k_last + 1;
+	while (lo < hi) {
+		int64_t mid = lo + (hi - lo) / 2;
+		if (minor_steps(mid) >= m_min) hi = mid; else lo = mid + 1;
+	}
+	k_first = lo;
+	lo = k_first - 1;
+	hi = k_last;
+	while (lo < hi) {
+		int64_t mid = hi - (hi - lo) / 2;
+		if (minor_steps(mid) <= m_max) lo = mid; else hi = mid - 1;
+	}
+	k_last = lo;
+	if (k_first > k_last) return;
+
+	// Error term at k_first. It stays within (-2 da, 2 db], so the loop runs in 32 bits
+	int64_t m = minor_steps(k_first);
+	int32_t d = static_cast<int32_t>(2 * db - da + 2 * db * k_first - 2 * da * m);
+	const int32_t up = static_cast<int32_t>(2 * db);
+	const int32_t down = static_cast<int32_t>(2 * da);
+	int64_t a = a0 + sa * k_first;
+	int64_t b = b0 + sb * m;
+
+	ptrdiff_t index = steep ? a * DISPLAY_WIDTH + b : b * DISPLAY_WIDTH + a;
+	const ptrdiff_t step_a = steep ? sa * DISPLAY_WIDTH : sa;
+	const ptrdiff_t step_b = steep ? sb : sb * DISPLAY_WIDTH;
+
+	for (int32_t count = static_cast<int32_t>(k_last - k_first); count >= 0; count--) {
+		back_buffer[index] = color;
+		// Minor step without a branch: mask is all ones when d > 0
+		int32_t mask = -static_cast<int32_t>(d > 0);
+		index += step_a + (step_b & mask);
+		d += up - (down & mask);
 	}
-	back_buffer[y1 * DISPLAY_WIDTH + x1] = color;
 }
 
 void Framebuffer::draw_diamond_outline(int center_x, int center_y, int width, int height, uint16_t color) {
@@ -240,3 +479,38 @@ void Framebuffer::draw_diamond_outline(int center_x, int center_y, int width, in
 	draw_line_bresenham(center_x + width, center_y, center_x, center_y + height, color);
 	draw_line_bresenham(center_x + width, center_y, center_x, center_y - height, color);
 }
+
+// Fixed factor: the inner loop is a known number of stores, gcc unrolls / vectorizes it
+template<int Scale>
+static void expand_row(const uint16_t* src, uint16_t width, uint16_t* dst) {
+	for (uint16_t x = 0; x < width; x++) {
+		for (int k = 0; k < Scale; k++) dst[x * Scale + k] = src[x];
+	}
+}
+
+void Framebuffer::upscale(const uint16_t* src, uint16_t width, uint16_t height, uint16_t* dst, uint32_t dst_stride, uint8_t scale) {
+
+	if (scale == 0 || static_cast<uint32_t>(width) * scale > dst_stride) {
+		printf("[ERROR] upscale: %ux does not fit %lu pixel rows\n", scale, static_cast<unsigned long>(dst_stride));
+		return;
+	}
+
+	size_t row_bytes = static_cast<size_t>(width) * scale * sizeof(uint16_t);
+	for (uint16_t y = 0; y < height; y++) {
+		const uint16_t* line = &src[y * width];
+		uint16_t* out = &dst[static_cast<size_t>(y) * scale * dst_stride];
+
+		switch (scale) {
+			case 1: memcpy(out, line, width * sizeof(uint16_t)); break;
+			case 2: expand_row<2>(line, width, out); break;
+			case 3: expand_row<3>(line, width, out); break;
+			case 4: expand_row<4>(line, width, out); break;
+			default:
+				for (uint16_t x = 0; x < width; x++) {
+					for (int k = 0; k < scale; k++) out[x * scale + k] = line[x];
+				}
+		}
+		// Line doubling: the other scale - 1 rows are copies
+		for (int k = 1; k < scale; k++) memcpy(out + k * dst_stride, out, row_bytes);
+	}
+}
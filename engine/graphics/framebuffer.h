@@ -6,6 +6,7 @@
 #else
     #include "display.h"
 #endif
+#include "engine/math/fixed_math.h"
 
 // Sprite pixel format for alpha blending
 struct SpritePixel {
@@ -13,6 +14,59 @@ struct SpritePixel {
 	uint8_t alpha;   // 0-255
 };
 
+// Sub-rect of a sprite atlas (tools/atlas_packer). Transparent borders are trimmed,
+// offset puts the trimmed rect back where it was in the source image.
+struct Atlas_frame {
+	uint16_t x;
+	uint16_t y;
+	uint16_t width;
+	uint16_t height;
+	uint16_t offset_x;
+	uint16_t offset_y;
+	uint16_t source_width;
+	uint16_t source_height;
+};
+
+// Many sprites / animation frames in one pixel array
+struct Sprite_atlas {
+	uint16_t width;
+	uint16_t height;
+	const SpritePixel* pixels;
+	const Atlas_frame* frames;
+	uint16_t frame_count;
+};
+
+// Sprite as two planes, RGB565 then Alpha8: 3 bytes per pixel where SpritePixel pads to 4.
+// Generated sprite headers define <name>_sprite over inline constexpr arrays (one copy in
+// the program however many files include the header).
+struct Sprite_planes {
+	uint16_t width;
+	uint16_t height;
+	const uint16_t* color;		// RGB565
+	const uint8_t* alpha;
+};
+
+// Sprite_atlas stored as planes, 3 bytes per pixel: the atlas headers from atlas_packer.
+// Asset packs keep Sprite_atlas, their SpritePixel data is drawn in place.
+struct Sprite_atlas_planes {
+	uint16_t width;
+	uint16_t height;
+	const uint16_t* color;		// RGB565, width x height
+	const uint8_t* alpha;
+	const Atlas_frame* frames;
+	uint16_t frame_count;
+};
+
+// Scale, rotation and mirroring for draw_sprite_transformed, applied around the sprite center.
+// Mirroring happens first (in sprite space), then scale, then rotation.
+struct Sprite_transform {
+	Fixed_q16 scale_x = 1;				// >= 1/256
+	Fixed_q16 scale_y = 1;
+	Fixed_math::Angle angle = 0;		// binary angle, clockwise on screen (y points down)
+	bool flip_x = false;				// mirror left/right (character facing the other way)
+	bool flip_y = false;
+};
+
 namespace Framebuffer {
 
 	extern uint16_t framebuffer_0[DISPLAY_HEIGHT * DISPLAY_WIDTH];
@@ -22,19 +76,54 @@ namespace Framebuffer {
 
 	uint16_t* get_front_buffer();
 
+	// Alpha blending - native little-endian RGB565 (CPU natural format)
+	// result = (sprite * alpha + bg * (255 - alpha)) / 255 per channel
+	inline uint16_t blend_rgb565(uint16_t bg, const SpritePixel& pixel) {
+
+		// RGB565: [RRRRR GGGGGG BBBBB] as uint16_t
+		uint8_t sr = (pixel.color >> 11) & 0x1F;
+		uint8_t sg = (pixel.color >> 5) & 0x3F;
+		uint8_t sb = pixel.color & 0x1F;
+
+		uint8_t br = (bg >> 11) & 0x1F;
+		uint8_t bg_g = (bg >> 5) & 0x3F;
+		uint8_t bb = bg & 0x1F;
+
+		uint8_t inv_alpha = 255 - pixel.alpha;
+		uint8_t r = (sr * pixel.alpha + br * inv_alpha) / 255;
+		uint8_t g = (sg * pixel.alpha + bg_g * inv_alpha) / 255;
+		uint8_t b = (sb * pixel.alpha + bb * inv_alpha) / 255;
+
+		return (r << 11) | (g << 5) | b;
+	}
+
 	void init();
 	void swap_buffers();
-	void set_pixel(uint16_t x, uint16_t y, uint16_t color);
+	void set_pixel(int x, int y, uint16_t color);
 	void send_to_display();
 
+	// Drawing takes signed coordinates, anything partly or fully off screen is clipped
 	void fill_with_color(uint16_t color);
-	void draw_line(uint16_t x, uint16_t y, uint16_t line_len, uint16_t color);
-	void draw_rectangle(uint16_t start_raw_y, uint16_t number_of_raws_y, uint16_t x, uint16_t line_len, uint16_t color);
-	void draw_rectangle_memset(uint16_t start_raw_y, uint16_t number_of_raws_y, uint16_t x, uint16_t line_len, uint16_t color);
-	void draw_sprite(uint16_t start_raw_y, uint16_t number_of_raws_y, uint16_t x, uint16_t line_len, const uint16_t* sprite);
-	void draw_sprite_alpha(uint16_t start_raw_y, uint16_t number_of_raws_y, uint16_t x, uint16_t line_len, const SpritePixel* sprite);
-	void draw_line_bresenham(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+	void draw_line(int x, int y, int line_len, uint16_t color);
+	void draw_rectangle(int start_raw_y, int number_of_raws_y, int x, int line_len, uint16_t color);
+	void draw_rectangle_memset(int start_raw_y, int number_of_raws_y, int x, int line_len, uint16_t color);
+	void draw_sprite(int start_raw_y, int number_of_raws_y, int x, int line_len, const uint16_t* sprite);
+	void draw_sprite_alpha(int start_raw_y, int number_of_raws_y, int x, int line_len, const SpritePixel* sprite);
+	// x, y - top left of the untrimmed frame, may be partly or fully off screen
+	void draw_sprite_region(const Sprite_atlas& atlas, uint16_t frame_id, int x, int y);
+	void draw_sprite_region(const Sprite_atlas_planes& atlas, uint16_t frame_id, int x, int y);
+	// x, y - top left of the untransformed sprite, the pivot is its center. Identity transform
+	// draws the same pixels as draw_sprite_alpha, flips only take a 1:1 row copy path.
+	void draw_sprite_transformed(int x, int y, int width, int height, const SpritePixel* sprite, const Sprite_transform& transform);
+	// Same pixels as draw_sprite_alpha / draw_sprite_transformed from the split planes
+	void draw_sprite_planes(const Sprite_planes& sprite, int x, int y);
+	void draw_sprite_transformed(const Sprite_planes& sprite, int x, int y, const Sprite_transform& transform);
+	void draw_line_bresenham(int x0, int y0, int x1, int y1, uint16_t color);
 	void draw_diamond_outline(int center_x, int center_y, int width, int height, uint16_t color);
+
+	// Nearest neighbour integer upscale of a width x height image, dst rows are dst_stride
+	// pixels apart (letterbox / bigger panel). Each row is expanded once, then copied scale - 1 times.
+	void upscale(const uint16_t* src, uint16_t width, uint16_t height, uint16_t* dst, uint32_t dst_stride, uint8_t scale);
 };
 
 
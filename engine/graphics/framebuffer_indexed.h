@@ -0,0 +1,68 @@
+#ifndef FRAMEBUFFER_INDEXED_H
+#define FRAMEBUFFER_INDEXED_H
+
+#ifdef PLATFORM_DESKTOP
+    #include "platform_desktop.h"
+    #include <cstddef>
+#else
+    #include "display.h"
+#endif
+
+// 8bpp indexed color mode: one byte per pixel plus a 256 entry RGB565 palette.
+// Half the memory and blit bandwidth of the RGB565 buffers (2 x 20 KB instead of
+// 2 x 40 KB at 160x128). The palette is applied while flushing, a few lines at a time,
+// so no full RGB565 frame ever exists on the MCU. Changing palette entries recolors
+// the whole screen for free (palette cycling: water, fire, blinking lights).
+//
+// The RGB565 Framebuffer buffers are only linked in when something draws through them
+// (Pico builds use --gc-sections), a game drawing only here does not pay for them.
+
+// Palette indexed sprite (tools/png_to_sprite/png_to_sprite_indexed)
+struct Indexed_sprite {
+	uint16_t width;
+	uint16_t height;
+	const uint8_t* pixels;
+};
+
+// 4bpp palette indexed sprite (png_to_sprite_indexed -b 4): two pixels per byte, first pixel in
+// the high nibble, rows start on a byte. Nibble 0 is transparent, 1..15 map to palette entries
+// bank + 1..bank + 15, so several 16 color sprites share the 256 entry palette.
+struct Indexed_sprite_4bpp {
+	uint16_t width;
+	uint16_t height;
+	const uint8_t* pixels;
+};
+
+namespace Indexed_framebuffer {
+
+	// Sprite pixels with this index are not drawn
+	constexpr uint8_t TRANSPARENT = 0;
+	// Lines expanded per display transfer (2.5 KB of RGB565 at 160 px)
+	constexpr uint16_t FLUSH_LINES = 8;
+
+	extern uint8_t framebuffer_0[DISPLAY_HEIGHT * DISPLAY_WIDTH];
+	extern uint8_t framebuffer_1[DISPLAY_HEIGHT * DISPLAY_WIDTH];
+	extern uint8_t* back_buffer;
+	extern uint8_t* front_buffer;
+	extern uint16_t palette[256];
+
+	void swap_buffers();
+	// Pico: expand the front buffer through the palette and send it to the display
+	void send_to_display();
+	// Front buffer through the palette into a full RGB565 frame (desktop present, tests)
+	void expand(uint16_t* rgb565);
+
+	void set_palette(uint8_t first, const uint16_t* colors, uint16_t count);
+	// Shift entries first..first+count-1 by one (last moves to first), one step of a color cycle
+	void rotate_palette(uint8_t first, uint16_t count);
+
+	// Signed position, off screen pixels are skipped
+	void set_pixel(int x, int y, uint8_t color);
+	void fill_with_color(uint8_t color);
+	// Signed position, clipped to the screen
+	void draw_rectangle(int x, int y, int width, int height, uint8_t color);
+	void draw_sprite(const Indexed_sprite& sprite, int x, int y);
+	void draw_sprite(const Indexed_sprite_4bpp& sprite, int x, int y, uint8_t bank = 0);
+};
+
+#endif
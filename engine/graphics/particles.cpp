@@ -0,0 +1,154 @@
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdio>
+#else
+    #include "pico/stdlib.h"
+    #include "stdio.h"
+#endif
+
+#include "particles.h"
+
+Particle_system::Particle_system(uint32_t capacity, Fixed_q16 step, uint32_t seed)
+	: max_particles(capacity), step_seconds(step), rng(seed) {
+
+	if (step_seconds <= 0) {
+		printf("[ERROR] Particle_system: step must be > 0\n");
+		step_seconds = Fixed_q16(1) / 60;
+	}
+	x.reserve(capacity);
+	y.reserve(capacity);
+	vx.reserve(capacity);
+	vy.reserve(capacity);
+	life.reserve(capacity);
+	color.reserve(capacity);
+}
+
+void Particle_system::set_gravity(Fixed_q16 gx, Fixed_q16 gy) {
+	gravity_x = gx * step_seconds * step_seconds;
+	gravity_y = gy * step_seconds * step_seconds;
+}
+
+// Seconds -> whole steps, rounded, in [1, UINT16_MAX]. Divides the raw values in 64 bit:
+// the Q16.16 quotient overflows past 32767 steps (about 546 s at 60 Hz).
+static int32_t lifetime_steps(Fixed_q16 seconds, Fixed_q16 step) {
+
+	int64_t steps = (static_cast<int64_t>(seconds.raw) * 2 + step.raw) / (static_cast<int64_t>(step.raw) * 2);
+	if (steps < 1) return 1;
+	if (steps > UINT16_MAX) return UINT16_MAX;
+	return static_cast<int32_t>(steps);
+}
+
+uint32_t Particle_system::emit(const Particle_emitter& emitter, uint32_t count) {
+
+	uint32_t free = max_particles - static_cast<uint32_t>(x.size());
+	if (count > free) count = free;
+
+	// Per second -> per step once per emit, not per particle
+	const Fixed_q16 speed_min = emitter.speed_min * step_seconds;
+	const Fixed_q16 speed_max = emitter.speed_max * step_seconds;
+	const int32_t life_min = lifetime_steps(emitter.life_min, step_seconds);
+	const int32_t life_max = lifetime_steps(emitter.life_max, step_seconds);
+
+	for (uint32_t n = 0; n < count; n++) {
+		Fixed_math::Angle angle = emitter.direction;
+		if (emitter.spread != 0) angle += static_cast<Fixed_math::Angle>(rng.bounded(emitter.spread + 1u) - emitter.spread / 2);
+		Fixed_q16 speed = speed_max > speed_min ? rng.uniform(speed_min, speed_max) : speed_min;
+
+		Fixed_q16 spawn_x = emitter.x;
+		Fixed_q16 spawn_y = emitter.y;
+		if (emitter.radius > 0) {
+			spawn_x += rng.uniform(-emitter.radius, emitter.radius);
+			spawn_y += rng.uniform(-emitter.radius, emitter.radius);
+		}
+
+		int32_t steps = life_max > life_min ? rng.range(life_min, life_max) : life_min;
+
+		x.push_back(spawn_x);
+		y.push_back(spawn_y);
+		vx.push_back(Fixed_math::cos(angle) * speed);
+		vy.push_back(Fixed_math::sin(angle) * speed);
+		life.push_back(static_cast<uint16_t>(steps));
+		color.push_back(emitter.colors.empty() ? 0xFFFF : emitter.colors[rng.bounded(static_cast<uint32_t>(emitter.colors.size()))]);
+	}
+	return count;
+}
+
+void Particle_system::clear() {
+	x.clear();
+	y.clear();
+	vx.clear();
+	vy.clear();
+	life.clear();
+	color.clear();
+	accumulator = 0;
+}
+
+uint32_t Particle_system::update(Fixed_q16 dt) {
+
+	accumulator += dt;
+	uint32_t steps = 0;
+	while (accumulator >= step_seconds && steps < MAX_STEPS) {
+		step();
+		accumulator -= step_seconds;
+		steps++;
+	}
+	if (accumulator >= step_seconds) accumulator = Fixed_q16::from_raw(accumulator.raw % step_seconds.raw);
+	return steps;
+}
+
+void Particle_system::step() {
+
+	// Integration: flat adds over every array, vectorized at -O3
+	const size_t count = x.size();
+	for (size_t i = 0; i < count; i++) {
+		vx[i] += gravity_x;
+		vy[i] += gravity_y;
+		x[i] += vx[i];
+		y[i] += vy[i];
+		life[i]--;
+	}
+
+	// Remove the expired ones, the last particle takes the slot
+	size_t alive = count;
+	for (size_t i = 0; i < alive;) {
+		if (life[i] != 0) {
+			i++;
+			continue;
+		}
+		alive--;
+		x[i] = x[alive];
+		y[i] = y[alive];
+		vx[i] = vx[alive];
+		vy[i] = vy[alive];
+		life[i] = life[alive];
+		color[i] = color[alive];
+	}
+	x.resize(alive);
+	y.resize(alive);
+	vx.resize(alive);
+	vy.resize(alive);
+	life.resize(alive);
+	color.resize(alive);
+}
+
+void Particle_system::draw_points() const {
+
+	uint16_t* buffer = Framebuffer::back_buffer;
+	const size_t count = x.size();
+	for (size_t i = 0; i < count; i++) {
+		// Negative positions wrap to huge unsigned values, one compare per axis
+		uint32_t px = static_cast<uint32_t>(x[i].to_int());
+		uint32_t py = static_cast<uint32_t>(y[i].to_int());
+		if (px >= DISPLAY_WIDTH || py >= DISPLAY_HEIGHT) continue;
+		buffer[py * DISPLAY_WIDTH + px] = color[i];
+	}
+}
+
+void Particle_system::draw_sprites(const SpritePixel* sprite, int width, int height) const {
+
+	const size_t count = x.size();
+	for (size_t i = 0; i < count; i++) {
+		Framebuffer::draw_sprite_alpha(y[i].to_int() - height / 2, height, x[i].to_int() - width / 2, width, sprite);
+	}
+}
@@ -0,0 +1,132 @@
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdio>
+#else
+    #include "pico/stdlib.h"
+    #include "stdio.h"
+#endif
+#include <algorithm>
+
+#include "strip_renderer.h"
+
+Strip_renderer::Strip_renderer(uint16_t width, uint16_t height, uint16_t strip_lines, uint32_t max_commands)
+	: screen_width(width), screen_height(height), lines(strip_lines), capacity(max_commands) {
+
+	if (lines == 0 || lines > height) {
+		printf("[ERROR] Strip_renderer: strip of %u lines for %u lines screen\n", lines, height);
+		lines = lines == 0 ? 1 : height;
+	}
+	commands.reserve(capacity);
+	strips[0].resize(width * lines);
+	strips[1].resize(width * lines);
+}
+
+void Strip_renderer::begin(uint16_t color) {
+	commands.clear();
+	clear_color = color;
+	overflow_reported = false;
+}
+
+bool Strip_renderer::push(const Command& command) {
+
+	// Nothing on screen, not worth a slot
+	if (command.x >= screen_width || command.y >= screen_height ||
+		command.x + command.width <= 0 || command.y + command.height <= 0) return false;
+
+	if (commands.size() == capacity) {
+		if (!overflow_reported) printf("[ERROR] Strip_renderer: display list full (%u commands)\n", static_cast<unsigned>(capacity));
+		overflow_reported = true;
+		return false;
+	}
+	commands.push_back(command);
+	return true;
+}
+
+void Strip_renderer::draw_rectangle(int x, int y, int width, int height, uint16_t color) {
+	if (width <= 0 || height <= 0) return;
+	width = std::min(width, 0xFFFF);
+	height = std::min(height, 0xFFFF);
+	push({Op::rectangle, x, y, static_cast<uint16_t>(width), static_cast<uint16_t>(height), 0, color, nullptr, nullptr, nullptr});
+}
+
+void Strip_renderer::draw_sprite_alpha(int x, int y, uint16_t width, uint16_t height, const SpritePixel* sprite) {
+	push({Op::sprite, x, y, width, height, width, 0, sprite, nullptr, nullptr});
+}
+
+void Strip_renderer::draw_sprite_region(const Sprite_atlas& atlas, uint16_t frame_id, int x, int y) {
+
+	if (frame_id >= atlas.frame_count) {
+		printf("[ERROR] atlas frame out of bound\n");
+		return;
+	}
+	// Offsets are >= 0: off the right / bottom edge stays off, and x + offset cannot overflow
+	if (x >= screen_width || y >= screen_height) return;
+	// A trimmed frame is a sprite whose rows are atlas.width apart
+	const Atlas_frame& frame = atlas.frames[frame_id];
+	push({Op::sprite, x + frame.offset_x, y + frame.offset_y, frame.width, frame.height,
+		atlas.width, 0, &atlas.pixels[frame.y * atlas.width + frame.x], nullptr, nullptr});
+}
+
+void Strip_renderer::draw_sprite_region(const Sprite_atlas_planes& atlas, uint16_t frame_id, int x, int y) {
+
+	if (frame_id >= atlas.frame_count) {
+		printf("[ERROR] atlas frame out of bound\n");
+		return;
+	}
+	if (x >= screen_width || y >= screen_height) return;
+	const Atlas_frame& frame = atlas.frames[frame_id];
+	const int32_t offset = frame.y * atlas.width + frame.x;
+	push({Op::planes, x + frame.offset_x, y + frame.offset_y, frame.width, frame.height,
+		atlas.width, 0, nullptr, atlas.color + offset, atlas.alpha + offset});
+}
+
+void Strip_renderer::draw_sprite_planes(const Sprite_planes& sprite, int x, int y) {
+	push({Op::planes, x, y, sprite.width, sprite.height, sprite.width, 0, nullptr, sprite.color, sprite.alpha});
+}
+
+// Same threshold as draw_sprite_alpha
+static inline void blend_pixel(SpritePixel pixel, uint16_t& dst) {
+	if (pixel.alpha < 10) return;
+	dst = (pixel.alpha == 255) ? pixel.color : Framebuffer::blend_rgb565(dst, pixel);
+}
+
+uint16_t* Strip_renderer::render_strip(uint32_t buffer, uint32_t strip_y, uint16_t count) {
+
+	uint16_t* strip = strips[buffer].data();
+	std::fill(strip, strip + screen_width * count, clear_color);
+	const int strip_bottom = strip_y + count;
+
+	for (const Command& command : commands) {
+		int top = command.y;
+		int bottom = command.y + command.height;
+		if (bottom <= static_cast<int>(strip_y) || top >= strip_bottom) continue;
+
+		// Clip to the strip
+		int first_row = std::max(top, static_cast<int>(strip_y));
+		int last_row = std::min(bottom, strip_bottom);
+		int left = std::max<int>(command.x, 0);
+		int right = std::min<int>(command.x + command.width, screen_width);
+		if (left >= right) continue;
+
+		for (int row = first_row; row < last_row; row++) {
+			uint16_t* dst = &strip[(row - strip_y) * screen_width + left];
+
+			if (command.op == Op::rectangle) {
+				std::fill(dst, dst + (right - left), command.color);
+				continue;
+			}
+
+			const int offset = (row - top) * command.stride + (left - command.x);
+			if (command.op == Op::sprite) {
+				const SpritePixel* src = &command.pixels[offset];
+				for (int i = 0; i < right - left; i++) blend_pixel(src[i], dst[i]);
+				continue;
+			}
+			const uint16_t* color = &command.color_plane[offset];
+			const uint8_t* alpha = &command.alpha_plane[offset];
+			for (int i = 0; i < right - left; i++) blend_pixel({color[i], alpha[i]}, dst[i]);
+		}
+	}
+	return strip;
+}
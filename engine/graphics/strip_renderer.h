@@ -0,0 +1,86 @@
+#ifndef STRIP_RENDERER_H
+#define STRIP_RENDERER_H
+
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+#else
+    #include "pico/stdlib.h"
+#endif
+#include <vector>
+#include "framebuffer.h"
+
+// Rendering without a full framebuffer. Draw calls are recorded into a display list,
+// then the frame is rendered N lines at a time into a strip buffer and each strip is
+// handed to the display right away (set the address window to the strip, send it).
+// RAM is 2 strips instead of 2 frames: 480x320 with 16 line strips is 30 KB, double
+// buffered RGB565 frames would be 600 KB.
+//
+// Two strip buffers alternate: while the sink streams one (DMA), the next one is
+// rendered. A sink that starts a transfer and returns must wait for its previous
+// transfer first, the buffer it gets is reused two strips later.
+//
+// Every command is checked against every strip (one compare each), fine for a few
+// hundred commands per frame. Drawing order is record order.
+
+class Strip_renderer {
+public:
+	Strip_renderer(uint16_t width, uint16_t height, uint16_t strip_lines, uint32_t max_commands);
+
+	uint16_t width() const { return screen_width; }
+	uint16_t height() const { return screen_height; }
+	uint16_t strip_lines() const { return lines; }
+	size_t command_count() const { return commands.size(); }
+
+	// Start a new display list, every strip starts as clear_color
+	void begin(uint16_t clear_color);
+
+	// Same pixels as the Framebuffer primitives, positions may be off screen
+	void draw_rectangle(int x, int y, int width, int height, uint16_t color);
+	void draw_sprite_alpha(int x, int y, uint16_t width, uint16_t height, const SpritePixel* sprite);
+	void draw_sprite_region(const Sprite_atlas& atlas, uint16_t frame_id, int x, int y);
+	void draw_sprite_region(const Sprite_atlas_planes& atlas, uint16_t frame_id, int x, int y);
+	void draw_sprite_planes(const Sprite_planes& sprite, int x, int y);
+
+	// sink(uint16_t y, uint16_t line_count, uint16_t* pixels) for each strip top to bottom,
+	// pixels are width * line_count native RGB565 (the sink may byte swap them in place)
+	template<typename Sink>
+	void render(Sink&& sink) {
+		uint32_t strip = 0;
+		for (uint32_t y = 0; y < screen_height; y += lines, strip++) {
+			uint16_t count = (screen_height - y < lines) ? screen_height - y : lines;
+			uint16_t* pixels = render_strip(strip & 1, y, count);
+			sink(static_cast<uint16_t>(y), count, pixels);
+		}
+	}
+
+private:
+	enum class Op : uint8_t { rectangle, sprite, planes };
+
+	struct Command {
+		Op op;
+		int32_t x;
+		int32_t y;
+		uint16_t width;
+		uint16_t height;
+		uint16_t stride;		// sprite: pixels per source row
+		uint16_t color;			// rectangle
+		const SpritePixel* pixels;
+		const uint16_t* color_plane;	// planes
+		const uint8_t* alpha_plane;
+	};
+
+	uint16_t screen_width;
+	uint16_t screen_height;
+	uint16_t lines;
+	uint32_t capacity;
+	uint16_t clear_color = 0;
+	bool overflow_reported = false;
+	std::vector<Command> commands;
+	std::vector<uint16_t> strips[2];
+
+	bool push(const Command& command);
+	uint16_t* render_strip(uint32_t buffer, uint32_t y, uint16_t count);
+};
+
+#endif
@@ -0,0 +1,58 @@
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdio>
+    #include <chrono>
+#else
+    #include "pico/stdlib.h"
+    #include "stdio.h"
+#endif
+
+#include "block_device.h"
+
+#ifdef PLATFORM_DESKTOP
+bool Image_block_device::open(const char* path) {
+
+	close();
+	file = fopen(path, "rb");
+	if (!file) {
+		printf("[ERROR] block device: cannot open %s\n", path);
+		return false;
+	}
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	if (size < static_cast<long>(BLOCK_SIZE)) {
+		printf("[ERROR] block device: %s is smaller than a block\n", path);
+		close();
+		return false;
+	}
+	blocks = static_cast<uint32_t>(size / BLOCK_SIZE);
+	return true;
+}
+
+void Image_block_device::close() {
+	if (file) fclose(file);
+	file = nullptr;
+	blocks = 0;
+}
+
+void Image_block_device::set_throttle(uint32_t command, uint32_t bandwidth) {
+	command_us = command;
+	bytes_per_second = bandwidth;
+}
+
+bool Image_block_device::read_blocks(uint32_t lba, uint32_t count, uint8_t* dst) {
+
+	if (!file || count == 0 || uint64_t(lba) + count > blocks) return false;
+	auto start = std::chrono::steady_clock::now();
+	counters.commands++;
+	counters.blocks += count;
+	bool ok = fseek(file, long(lba) * BLOCK_SIZE, SEEK_SET) == 0 && fread(dst, BLOCK_SIZE, count, file) == count;
+
+	// Spin, sleeps are far coarser than a command
+	int64_t wait_us = command_us;
+	if (bytes_per_second) wait_us += int64_t(count) * BLOCK_SIZE * 1000000 / bytes_per_second;
+	while (std::chrono::steady_clock::now() - start < std::chrono::microseconds(wait_us)) {}
+	return ok;
+}
+#endif
@@ -0,0 +1,63 @@
+#ifndef BLOCK_DEVICE_H
+#define BLOCK_DEVICE_H
+
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdio>
+#else
+    #include "pico/stdlib.h"
+#endif
+
+// Storage addressed in 512 byte blocks (SD card, disk image). A read of several
+// consecutive blocks is one command: on an SD card CMD18 streams the blocks after one
+// command latency, CMD17 pays it for every block, so callers group what they can.
+
+constexpr uint32_t BLOCK_SIZE = 512;
+
+class Block_device {
+public:
+	struct Stats {
+		uint32_t commands;		// read_blocks calls that reached the device
+		uint32_t blocks;
+	};
+
+	virtual ~Block_device() {}
+
+	virtual uint32_t block_count() const = 0;
+	// count blocks from lba into dst (count * BLOCK_SIZE bytes), false on error or past the end
+	virtual bool read_blocks(uint32_t lba, uint32_t count, uint8_t* dst) = 0;
+
+	const Stats& stats() const { return counters; }
+	void reset_stats() { counters = {}; }
+
+protected:
+	Stats counters = {};
+};
+
+#ifdef PLATFORM_DESKTOP
+// Disk image of a card (dd if=/dev/sdX of=card.img), with an optional throttle that
+// behaves like an SPI SD card: every command waits command_us + bytes / bytes_per_second
+class Image_block_device : public Block_device {
+public:
+	Image_block_device() = default;
+	~Image_block_device() { close(); }
+	Image_block_device(const Image_block_device&) = delete;
+	Image_block_device& operator=(const Image_block_device&) = delete;
+
+	bool open(const char* path);
+	void close();
+	void set_throttle(uint32_t command_us, uint32_t bytes_per_second);
+
+	uint32_t block_count() const override { return blocks; }
+	bool read_blocks(uint32_t lba, uint32_t count, uint8_t* dst) override;
+
+private:
+	FILE* file = nullptr;
+	uint32_t blocks = 0;
+	uint32_t command_us = 0;
+	uint32_t bytes_per_second = 0;
+};
+#endif
+
+#endif
@@ -0,0 +1,299 @@
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdio>
+    #include <cstring>
+#else
+    #include "pico/stdlib.h"
+    #include "stdio.h"
+    #include "cstring"
+#endif
+#include <algorithm>
+
+#include "fat32.h"
+
+// On disk values are little-endian at any alignment
+static uint16_t read16(const uint8_t* p) {
+	return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+static uint32_t read32(const uint8_t* p) {
+	return p[0] | (p[1] << 8) | (p[2] << 16) | (uint32_t(p[3]) << 24);
+}
+
+static char lower(char c) {
+	return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + 32) : c;
+}
+
+static bool same_name(const char* a, size_t length, const char* b) {
+	for (size_t i = 0; i < length; i++) {
+		if (b[i] == '\0' || lower(a[i]) != lower(b[i])) return false;
+	}
+	return b[length] == '\0';
+}
+
+const uint32_t FAT_END = 0x0FFFFFF8;
+const uint8_t ATTR_VOLUME = 0x08;
+const uint8_t ATTR_DIRECTORY = 0x10;
+const uint8_t ATTR_LONG_NAME = 0x0F;
+const size_t LONG_NAME_LENGTH = 255;
+
+bool Fat_volume::mount() {
+
+	cluster_count = 0;
+	const uint8_t* sector = cache.sector(0);
+	if (!sector || read16(sector + 510) != 0xAA55) {
+		printf("[ERROR] fat32: no boot sector\n");
+		return false;
+	}
+
+	// A boot sector starts with a jump, an MBR with code: look for a FAT32 partition then
+	uint32_t volume_lba = 0;
+	bool boot_sector = (sector[0] == 0xEB || sector[0] == 0xE9) && read16(sector + 11) == BLOCK_SIZE && read16(sector + 22) == 0;
+	if (!boot_sector) {
+		for (int i = 0; i < 4 && volume_lba == 0; i++) {
+			const uint8_t* partition = sector + 446 + i * 16;
+			if (partition[4] == 0x0B || partition[4] == 0x0C) volume_lba = read32(partition + 8);
+		}
+		if (volume_lba == 0 || !(sector = cache.sector(volume_lba)) || read16(sector + 510) != 0xAA55) {
+			printf("[ERROR] fat32: no FAT32 partition\n");
+			return false;
+		}
+	}
+
+	const uint16_t bytes_per_sector = read16(sector + 11);
+	const uint8_t cluster_sectors = sector[13];
+	const uint16_t reserved = read16(sector + 14);
+	const uint8_t fat_count = sector[16];
+	const uint16_t root_entries = read16(sector + 17);
+	const uint32_t total = read16(sector + 19) ? read16(sector + 19) : read32(sector + 32);
+	const uint32_t fat_size = read32(sector + 36);
+	if (bytes_per_sector != BLOCK_SIZE || cluster_sectors == 0 || (cluster_sectors & (cluster_sectors - 1)) != 0 ||
+		fat_count == 0 || root_entries != 0 || read16(sector + 22) != 0 || fat_size == 0) {
+		printf("[ERROR] fat32: not a FAT32 volume with 512 byte sectors\n");
+		return false;
+	}
+
+	fat_lba = volume_lba + reserved;
+	data_lba = fat_lba + fat_count * fat_size;
+	sectors_per_cluster = cluster_sectors;
+	root_cluster = read32(sector + 44);
+	const uint32_t data_sectors = total > data_lba - volume_lba ? total - (data_lba - volume_lba) : 0;
+	// Clusters addressable by the FAT too, a damaged total would read past it
+	cluster_count = std::min(data_sectors / cluster_sectors, fat_size * (BLOCK_SIZE / 4) - 2);
+	if (cluster_count == 0 || !valid_cluster(root_cluster)) {
+		printf("[ERROR] fat32: bad root directory cluster\n");
+		cluster_count = 0;
+		return false;
+	}
+	return true;
+}
+
+uint32_t Fat_volume::next_cluster(uint32_t cluster) {
+
+	const uint8_t* sector = cache.sector(fat_lba + cluster / (BLOCK_SIZE / 4));
+	if (!sector) return 0;
+	uint32_t next = read32(sector + (cluster % (BLOCK_SIZE / 4)) * 4) & 0x0FFFFFFF;
+	if (next >= FAT_END) return 0;
+	if (!valid_cluster(next)) {
+		printf("[ERROR] fat32: cluster %u links to %u\n", static_cast<unsigned>(cluster), static_cast<unsigned>(next));
+		return 0;
+	}
+	return next;
+}
+
+bool Fat_volume::find(uint32_t directory, const char* name, size_t length, Entry& out) {
+
+	char long_name[LONG_NAME_LENGTH + 1];
+	uint8_t long_checksum = 0;
+	bool has_long_name = false;
+
+	// A directory larger than the card is a loop in the chain
+	for (uint32_t cluster = directory, guard = 0; cluster != 0 && guard < cluster_count; cluster = next_cluster(cluster), guard++) {
+		for (uint32_t s = 0; s < sectors_per_cluster; s++) {
+			const uint8_t* sector = cache.sector(cluster_lba(cluster) + s);
+			if (!sector) return false;
+
+			for (uint32_t offset = 0; offset < BLOCK_SIZE; offset += 32) {
+				const uint8_t* entry = sector + offset;
+				if (entry[0] == 0x00) return false;		// end of the directory
+				if (entry[0] == 0xE5) {
+					has_long_name = false;
+					continue;
+				}
+
+				// Long name pieces come last piece first, 13 UTF-16 characters each
+				if (entry[11] == ATTR_LONG_NAME) {
+					uint8_t order = entry[0] & 0x1F;
+					if (entry[0] & 0x40) {
+						memset(long_name, 0, sizeof(long_name));
+						long_checksum = entry[13];
+						has_long_name = true;
+					}
+					if (!has_long_name || order == 0 || order > 20 || entry[13] != long_checksum) {
+						has_long_name = false;
+						continue;
+					}
+					static const uint8_t positions[13] = {1, 3, 5, 7, 9, 14, 16, 18, 20, 22, 24, 28, 30};
+					for (int i = 0; i < 13; i++) {
+						uint16_t c = read16(entry + positions[i]);
+						size_t at = (order - 1) * 13 + i;
+						if (c == 0x0000 || c == 0xFFFF || at >= LONG_NAME_LENGTH) break;
+						long_name[at] = c < 0x80 ? static_cast<char>(c) : '?';
+					}
+					continue;
+				}
+				if (entry[11] & ATTR_VOLUME) {
+					has_long_name = false;
+					continue;
+				}
+
+				// The long name belongs to this entry if its checksum matches the 8.3 name
+				uint8_t checksum = 0;
+				for (int i = 0; i < 11; i++) checksum = static_cast<uint8_t>(((checksum & 1) << 7) + (checksum >> 1) + entry[i]);
+				bool match = has_long_name && checksum == long_checksum && same_name(name, length, long_name);
+				has_long_name = false;
+				if (!match) {
+					char short_name[13];
+					size_t n = 0;
+					for (int i = 0; i < 8 && entry[i] != ' '; i++) short_name[n++] = static_cast<char>(entry[i]);
+					if (entry[8] != ' ') short_name[n++] = '.';
+					for (int i = 8; i < 11 && entry[i] != ' '; i++) short_name[n++] = static_cast<char>(entry[i]);
+					short_name[n] = '\0';
+					if (short_name[0] == 0x05) short_name[0] = static_cast<char>(0xE5);
+					match = same_name(name, length, short_name);
+				}
+				if (match) {
+					out.cluster = (uint32_t(read16(entry + 20)) << 16) | read16(entry + 26);
+					out.size = read32(entry + 28);
+					out.directory = (entry[11] & ATTR_DIRECTORY) != 0;
+					return true;
+				}
+			}
+		}
+	}
+	return false;
+}
+
+bool Fat_volume::open(const char* path, Fat_file& file) {
+
+	file = Fat_file();
+	if (!is_mounted()) {
+		printf("[ERROR] fat32: not mounted\n");
+		return false;
+	}
+
+	Entry entry = {root_cluster, 0, true};
+	const char* p = path;
+	while (*p) {
+		while (*p == '/') p++;
+		const char* end = p;
+		while (*end && *end != '/') end++;
+		if (end == p) break;
+		if (!entry.directory || !find(entry.cluster == 0 ? root_cluster : entry.cluster, p, end - p, entry)) {
+			printf("[ERROR] fat32: %s not found\n", path);
+			return false;
+		}
+		p = end;
+	}
+	if (entry.directory) {
+		printf("[ERROR] fat32: %s is a directory\n", path);
+		return false;
+	}
+	if (entry.size != 0 && !valid_cluster(entry.cluster)) {
+		printf("[ERROR] fat32: %s starts at cluster %u\n", path, static_cast<unsigned>(entry.cluster));
+		return false;
+	}
+
+	// Walk the chain once: long enough for the size, and contiguous or not
+	const uint32_t clusters = (entry.size + cluster_size() - 1) / cluster_size();
+	bool contiguous = true;
+	uint32_t cluster = entry.cluster;
+	for (uint32_t i = 1; i < clusters; i++) {
+		uint32_t next = next_cluster(cluster);
+		if (next == 0) {
+			printf("[ERROR] fat32: %s has %u of %u clusters\n", path, static_cast<unsigned>(i), static_cast<unsigned>(clusters));
+			return false;
+		}
+		contiguous = contiguous && next == cluster + 1;
+		cluster = next;
+	}
+
+	file.volume = this;
+	file.first_cluster = entry.cluster;
+	file.file_size = entry.size;
+	file.contiguous = contiguous;
+	file.cursor_cluster = entry.cluster;
+	return true;
+}
+
+bool Fat_file::seek(uint32_t position) {
+	if (!volume || position > file_size) return false;
+	pos = position;
+	return true;
+}
+
+bool Fat_file::locate(uint32_t position, uint32_t wanted, uint32_t& lba, uint32_t& run) {
+
+	const uint32_t cluster_sectors = volume->sectors_per_cluster;
+	const uint32_t index = position / volume->cluster_size();
+	const uint32_t sector_in_cluster = (position / BLOCK_SIZE) % cluster_sectors;
+
+	if (contiguous) {
+		lba = volume->cluster_lba(first_cluster + index) + sector_in_cluster;
+		run = wanted;
+		return true;
+	}
+
+	// Cursor on the cluster of the position (forward from the cursor, or from the start)
+	if (index < cursor_index) {
+		cursor_cluster = first_cluster;
+		cursor_index = 0;
+	}
+	while (cursor_index < index) {
+		cursor_cluster = volume->next_cluster(cursor_cluster);
+		if (cursor_cluster == 0) return false;
+		cursor_index++;
+	}
+	lba = volume->cluster_lba(cursor_cluster) + sector_in_cluster;
+
+	// Extended over the clusters that follow it on the card
+	run = cluster_sectors - sector_in_cluster;
+	for (uint32_t cluster = cursor_cluster; run < wanted; cluster++) {
+		if (volume->next_cluster(cluster) != cluster + 1) break;
+		run += cluster_sectors;
+	}
+	run = std::min(run, wanted);
+	return true;
+}
+
+int32_t Fat_file::read(void* dst, uint32_t size) {
+
+	if (!volume) return -1;
+	size = std::min(size, file_size - pos);
+	uint8_t* out = static_cast<uint8_t*>(dst);
+	uint32_t left = size;
+
+	while (left > 0) {
+		const uint32_t offset = pos % BLOCK_SIZE;
+		const uint32_t whole = (offset == 0) ? left / BLOCK_SIZE : 0;
+		uint32_t lba, run;
+		if (!locate(pos, std::max<uint32_t>(whole, 1), lba, run)) return -1;
+
+		uint32_t bytes;
+		if (whole == 0) {
+			// Partial sector through the cache
+			const uint8_t* sector = volume->cache.sector(lba);
+			if (!sector) return -1;
+			bytes = std::min(BLOCK_SIZE - offset, left);
+			memcpy(out, sector + offset, bytes);
+		} else {
+			if (!volume->cache.read(lba, run, out)) return -1;
+			bytes = run * BLOCK_SIZE;
+		}
+		out += bytes;
+		pos += bytes;
+		left -= bytes;
+	}
+	return static_cast<int32_t>(size);
+}
@@ -0,0 +1,86 @@
+#ifndef FAT32_H
+#define FAT32_H
+
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+#else
+    #include "pico/stdlib.h"
+#endif
+#include "sector_cache.h"
+
+// Minimal read only FAT32 for assets on the SD card: first FAT32 partition of the MBR
+// (or a card formatted without partition table), paths with '/', case insensitive 8.3
+// and long names (ASCII), no write, no FAT12/16.
+//
+// Every file is checked once at open: when its clusters follow each other (any file
+// copied on a freshly formatted card), reads skip the FAT and go straight to the sectors.
+// Fragmented files walk the cluster chain and still read each run of consecutive clusters
+// with one command.
+
+class Fat_volume;
+
+class Fat_file {
+public:
+	uint32_t size() const { return file_size; }
+	uint32_t position() const { return pos; }
+	bool is_open() const { return volume != nullptr; }
+	bool is_contiguous() const { return contiguous; }
+
+	// false past the end
+	bool seek(uint32_t position);
+	// Up to size bytes from the position, returns the bytes read (0 at the end), -1 on error
+	int32_t read(void* dst, uint32_t size);
+
+private:
+	friend class Fat_volume;
+
+	Fat_volume* volume = nullptr;
+	uint32_t first_cluster = 0;
+	uint32_t file_size = 0;
+	uint32_t pos = 0;
+	bool contiguous = false;
+	uint32_t cursor_cluster = 0;		// cluster number cursor_index of the chain
+	uint32_t cursor_index = 0;
+
+	// Sector of the position and how many sectors follow it on the device before the
+	// chain jumps (limited to wanted), false on a broken chain
+	bool locate(uint32_t position, uint32_t wanted, uint32_t& lba, uint32_t& run);
+};
+
+class Fat_volume {
+public:
+	explicit Fat_volume(Sector_cache& cache) : cache(cache) {}
+
+	bool mount();
+	bool is_mounted() const { return cluster_count != 0; }
+
+	// "/assets/level1.level", false (and an error) when missing or a directory
+	bool open(const char* path, Fat_file& file);
+
+	uint32_t cluster_size() const { return uint32_t(sectors_per_cluster) * BLOCK_SIZE; }
+
+private:
+	friend class Fat_file;
+
+	struct Entry {
+		uint32_t cluster;
+		uint32_t size;
+		bool directory;
+	};
+
+	Sector_cache& cache;
+	uint32_t fat_lba = 0;
+	uint32_t data_lba = 0;
+	uint32_t root_cluster = 0;
+	uint32_t cluster_count = 0;
+	uint8_t sectors_per_cluster = 0;
+
+	bool valid_cluster(uint32_t cluster) const { return cluster >= 2 && cluster - 2 < cluster_count; }
+	uint32_t cluster_lba(uint32_t cluster) const { return data_lba + (cluster - 2) * sectors_per_cluster; }
+	// Next cluster of the chain, 0 at the end or on error
+	uint32_t next_cluster(uint32_t cluster);
+	bool find(uint32_t directory, const char* name, size_t length, Entry& out);
+};
+
+#endif
@@ -0,0 +1,106 @@
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdio>
+    #include <cstring>
+#else
+    #include "pico/stdlib.h"
+    #include "stdio.h"
+    #include "cstring"
+#endif
+#include <algorithm>
+
+#include "sector_cache.h"
+
+Sector_cache::Sector_cache(Block_device& block_device, uint16_t line_count, uint16_t sectors_per_line)
+	: device(block_device), line_sectors(sectors_per_line) {
+
+	if (line_count == 0 || line_sectors == 0) {
+		printf("[ERROR] Sector_cache: %u lines of %u sectors\n", line_count, line_sectors);
+		line_count = std::max<uint16_t>(line_count, 1);
+		line_sectors = std::max<uint16_t>(line_sectors, 1);
+	}
+	lines.assign(line_count, {0, 0, 0});
+	data.resize(size_t(line_count) * line_sectors * BLOCK_SIZE);
+}
+
+int32_t Sector_cache::find(uint32_t lba) const {
+	for (size_t i = 0; i < lines.size(); i++) {
+		const Line& line = lines[i];
+		if (lba - line.first < line.count) return static_cast<int32_t>(i);
+	}
+	return -1;
+}
+
+const uint8_t* Sector_cache::sector(uint32_t lba) {
+
+	tick++;
+	int32_t i = find(lba);
+	if (i >= 0) {
+		counters.hits++;
+		lines[i].last_used = tick;
+		return &data[(size_t(i) * line_sectors + (lba - lines[i].first)) * BLOCK_SIZE];
+	}
+
+	// Least recently used line, filled with the aligned group of sectors around lba
+	counters.misses++;
+	i = 0;
+	for (size_t j = 1; j < lines.size(); j++) {
+		if (lines[j].last_used < lines[i].last_used) i = static_cast<int32_t>(j);
+	}
+	Line& line = lines[i];
+	uint32_t first = lba - lba % line_sectors;
+	uint32_t count = std::min<uint32_t>(line_sectors, device.block_count() > first ? device.block_count() - first : 0);
+	uint8_t* dst = &data[size_t(i) * line_sectors * BLOCK_SIZE];
+	if (lba >= first + count || !device.read_blocks(first, count, dst)) {
+		printf("[ERROR] sector cache: cannot read sector %u\n", static_cast<unsigned>(lba));
+		line.count = 0;
+		return nullptr;
+	}
+	line = {first, static_cast<uint16_t>(count), tick};
+	return dst + (lba - first) * BLOCK_SIZE;
+}
+
+bool Sector_cache::read(uint32_t lba, uint32_t count, uint8_t* dst) {
+
+	while (count > 0) {
+		int32_t i = find(lba);
+		if (i >= 0) {
+			counters.hits++;
+			lines[i].last_used = ++tick;
+			memcpy(dst, &data[(size_t(i) * line_sectors + (lba - lines[i].first)) * BLOCK_SIZE], BLOCK_SIZE);
+			lba++;
+			count--;
+			dst += BLOCK_SIZE;
+			continue;
+		}
+
+		// Short reads go through a line (read ahead for the next ones)
+		if (count < line_sectors) {
+			const uint8_t* cached = sector(lba);
+			if (!cached) return false;
+			memcpy(dst, cached, BLOCK_SIZE);
+			lba++;
+			count--;
+			dst += BLOCK_SIZE;
+			continue;
+		}
+
+		// Run of uncached sectors, one command
+		uint32_t run = 1;
+		while (run < count && find(lba + run) < 0) run++;
+		if (!device.read_blocks(lba, run, dst)) {
+			printf("[ERROR] sector cache: cannot read %u sectors at %u\n", static_cast<unsigned>(run), static_cast<unsigned>(lba));
+			return false;
+		}
+		counters.direct += run;
+		lba += run;
+		count -= run;
+		dst += size_t(run) * BLOCK_SIZE;
+	}
+	return true;
+}
+
+void Sector_cache::invalidate() {
+	for (Line& line : lines) line = {0, 0, 0};
+}
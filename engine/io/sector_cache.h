@@ -0,0 +1,61 @@
+#ifndef SECTOR_CACHE_H
+#define SECTOR_CACHE_H
+
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+#else
+    #include "pico/stdlib.h"
+#endif
+#include <vector>
+#include "block_device.h"
+
+// Read only LRU cache in front of a Block_device. Sectors are cached in lines of
+// sectors_per_line consecutive sectors: a miss reads its whole line with one multi block
+// command, which is the read ahead for FAT walks, directory scans and small file reads.
+// Reads of a line or more (read()) go straight from the device into the caller's buffer
+// for the sectors that are not cached, they would only evict the lines worth keeping.
+//
+// RAM: line_count * sectors_per_line * 512 bytes (8 lines of 4 sectors = 16 KB).
+
+class Sector_cache {
+public:
+	struct Stats {
+		uint32_t hits;			// sector() served from a line
+		uint32_t misses;		// sector() that read a line
+		uint32_t direct;		// sectors read() took straight from the device
+	};
+
+	Sector_cache(Block_device& device, uint16_t line_count, uint16_t sectors_per_line);
+
+	// One sector, nullptr on a device error. Valid until the next call on the cache.
+	const uint8_t* sector(uint32_t lba);
+	// count sectors into dst: cached ones are copied, every run of the others is one
+	// device command (through a line when less than a line is left)
+	bool read(uint32_t lba, uint32_t count, uint8_t* dst);
+	// Drop every line (card swapped)
+	void invalidate();
+
+	Block_device& block_device() { return device; }
+	const Stats& stats() const { return counters; }
+	void reset_stats() { counters = {}; }
+
+private:
+	struct Line {
+		uint32_t first;			// lba of the first sector
+		uint16_t count;			// sectors held, 0 = empty (short at the end of the device)
+		uint32_t last_used;
+	};
+
+	Block_device& device;
+	uint16_t line_sectors;
+	uint32_t tick = 0;
+	Stats counters = {};
+	std::vector<Line> lines;
+	std::vector<uint8_t> data;
+
+	// Line holding lba, -1 if none
+	int32_t find(uint32_t lba) const;
+};
+
+#endif
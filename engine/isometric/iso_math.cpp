@@ -0,0 +1,94 @@
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+#else
+    #include "pico/stdlib.h"
+#endif
+
+#include "iso_math.h"
+
+// Raw Q16.16 math on plain int32 so the compiler sees simple integer loops.
+// (x + y) >> 1 instead of a divide, __restrict tells it the arrays do not overlap.
+// Adds, subtracts and the * 65536 go through uint32_t: they wrap like Fixed_q16 (Overflow::wrap)
+// for far out coordinates instead of being signed overflow, and still vectorize.
+
+static inline int32_t wrap_add(int32_t a, int32_t b) {
+	return static_cast<int32_t>(static_cast<uint32_t>(a) + static_cast<uint32_t>(b));
+}
+static inline int32_t wrap_sub(int32_t a, int32_t b) {
+	return static_cast<int32_t>(static_cast<uint32_t>(a) - static_cast<uint32_t>(b));
+}
+
+void world_to_screen(const Fixed_q16* x, const Fixed_q16* y, const Fixed_q16* z, size_t count,
+const Camera& cam, Screen_space* screen) {
+
+	const int32_t offset_x = cam.offset_x;
+	const int32_t offset_y = cam.offset_y;
+	const Fixed_q16* __restrict wx = x;
+	const Fixed_q16* __restrict wy = y;
+	Screen_space* __restrict out = screen;
+
+	if (z == nullptr) {
+		for (size_t i = 0; i < count; i++) {
+			int32_t sx = wrap_sub(wx[i].raw, wy[i].raw);
+			int32_t sy = wrap_add(wx[i].raw, wy[i].raw) >> 1;
+			out[i].x = static_cast<int16_t>(wrap_add(sx >> 16, offset_x));
+			out[i].y = static_cast<int16_t>(wrap_add(sy >> 16, offset_y));
+		}
+		return;
+	}
+
+	const Fixed_q16* __restrict wz = z;
+	for (size_t i = 0; i < count; i++) {
+		int32_t sx = wrap_sub(wx[i].raw, wy[i].raw);
+		int32_t sy = wrap_sub(wrap_add(wx[i].raw, wy[i].raw) >> 1, wz[i].raw);
+		out[i].x = static_cast<int16_t>(wrap_add(sx >> 16, offset_x));
+		out[i].y = static_cast<int16_t>(wrap_add(sy >> 16, offset_y));
+	}
+}
+
+void world_to_screen(const Fixed_q16* x, const Fixed_q16* y, const Fixed_q16* z, size_t count,
+const Camera& cam, int16_t* screen_x, int16_t* screen_y) {
+
+	const int32_t offset_x = cam.offset_x;
+	const int32_t offset_y = cam.offset_y;
+	const Fixed_q16* __restrict wx = x;
+	const Fixed_q16* __restrict wy = y;
+	int16_t* __restrict out_x = screen_x;
+	int16_t* __restrict out_y = screen_y;
+
+	if (z == nullptr) {
+		for (size_t i = 0; i < count; i++) {
+			int32_t sx = wrap_sub(wx[i].raw, wy[i].raw);
+			int32_t sy = wrap_add(wx[i].raw, wy[i].raw) >> 1;
+			out_x[i] = static_cast<int16_t>(wrap_add(sx >> 16, offset_x));
+			out_y[i] = static_cast<int16_t>(wrap_add(sy >> 16, offset_y));
+		}
+		return;
+	}
+
+	const Fixed_q16* __restrict wz = z;
+	for (size_t i = 0; i < count; i++) {
+		int32_t sx = wrap_sub(wx[i].raw, wy[i].raw);
+		int32_t sy = wrap_sub(wrap_add(wx[i].raw, wy[i].raw) >> 1, wz[i].raw);
+		out_x[i] = static_cast<int16_t>(wrap_add(sx >> 16, offset_x));
+		out_y[i] = static_cast<int16_t>(wrap_add(sy >> 16, offset_y));
+	}
+}
+
+void screen_to_world(const Screen_space* screen, size_t count, const Camera& cam, Fixed_q16 z,
+Fixed_q16* x, Fixed_q16* y) {
+
+	const int32_t offset_x = cam.offset_x;
+	const int32_t offset_y = cam.offset_y;
+	const Screen_space* __restrict in = screen;
+	Fixed_q16* __restrict out_x = x;
+	Fixed_q16* __restrict out_y = y;
+
+	for (size_t i = 0; i < count; i++) {
+		int32_t sx = static_cast<int32_t>(static_cast<uint32_t>(wrap_sub(in[i].x, offset_x)) << 16);
+		int32_t sy = wrap_add(static_cast<int32_t>(static_cast<uint32_t>(wrap_sub(in[i].y, offset_y)) << 16), z.raw);
+		out_x[i].raw = wrap_add(sx >> 1, sy);
+		out_y[i].raw = wrap_sub(sy, sx >> 1);
+	}
+}
@@ -3,6 +3,7 @@
 
 #ifdef PLATFORM_DESKTOP
     #include <cstdint>
+    #include <cstddef>
 #else
     #include "pico/stdlib.h"
 #endif
@@ -28,7 +29,7 @@ struct Camera {
 inline Screen_space world_to_screen(const World_space& world, const Camera& cam) {
 
 	Fixed_q16 sx = world.x - world.y;
-	Fixed_q16 sy = (world.x + world.y) / 2 - world.z;
+	Fixed_q16 sy = ((world.x + world.y) >> 1) - world.z;
 
 	Screen_space screen;
 	screen.x = sx.to_int() + cam.offset_x;
@@ -43,14 +44,37 @@ inline World_space screen_to_world(const Screen_space& screen, const Camera& cam
 	Fixed_q16 sy = Fixed_q16(screen.y - cam.offset_y);
 
 	World_space world;  // z is already 0 from default constructor
-	world.x = sx / 2 + sy;
-	world.y = sy - sx / 2;
+	world.x = (sx >> 1) + sy;
+	world.y = sy - (sx >> 1);
 	return world;
 }
 
 // Rare case - specific z level (elevated platforms, multi-floor buildings)
+// Height lifts the point up the screen, so undo it before the ground inverse.
 inline World_space screen_to_world(const Screen_space& screen, const Camera& cam,
-Fixed_q16 z);
+Fixed_q16 z) {
+
+	Fixed_q16 sx = Fixed_q16(screen.x - cam.offset_x);
+	Fixed_q16 sy = Fixed_q16(screen.y - cam.offset_y) + z;
+
+	World_space world;
+	world.x = (sx >> 1) + sy;
+	world.y = sy - (sx >> 1);
+	world.z = z;
+	return world;
+}
+
+// Batch versions over SoA arrays (one call per frame for all entities / tile corners).
+// Same results as the scalar functions, including Q16.16 wrap around for far out coordinates.
+// Loops are branch free so the desktop build vectorizes them.
+// z == nullptr means ground level.
+void world_to_screen(const Fixed_q16* x, const Fixed_q16* y, const Fixed_q16* z, size_t count,
+const Camera& cam, Screen_space* screen);
+void world_to_screen(const Fixed_q16* x, const Fixed_q16* y, const Fixed_q16* z, size_t count,
+const Camera& cam, int16_t* screen_x, int16_t* screen_y);
+
+void screen_to_world(const Screen_space* screen, size_t count, const Camera& cam, Fixed_q16 z,
+Fixed_q16* x, Fixed_q16* y);
 
 
 #endif
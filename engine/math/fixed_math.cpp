@@ -0,0 +1,223 @@
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+#else
+    #include "pico/stdlib.h"
+#endif
+
+#include "fixed_math.h"
+
+namespace {
+
+	constexpr int CORDIC_ITERATIONS_USED = 20;
+	static_assert(CORDIC_ITERATIONS_USED <= Fixed_math::CORDIC_ITERATIONS, "not enough atan entries");
+
+	// Angle of (x, y) with 2^32 = full turn
+	uint32_t atan2_raw(int32_t y_raw, int32_t x_raw) {
+
+		if (x_raw == 0 && y_raw == 0) return 0;
+
+		int64_t x = x_raw;
+		int64_t y = y_raw;
+		uint32_t angle = 0;
+
+		// Rotate left half plane by 180° - CORDIC converges only for |angle| < ~99°
+		if (x < 0) {
+			x = -x;
+			y = -y;
+			angle = 0x80000000u;
+		}
+
+		// Bring the larger component to [2^28, 2^29): keeps precision for small
+		// vectors and leaves headroom for the CORDIC gain (~1.65) in int32.
+		uint64_t magnitude = static_cast<uint64_t>(x > (y < 0 ? -y : y) ? x : (y < 0 ? -y : y));
+		int bits = 64 - __builtin_clzll(magnitude);
+		if (bits > 29) {
+			x >>= (bits - 29);
+			y >>= (bits - 29);
+		} else {
+			x <<= (29 - bits);
+			y <<= (29 - bits);
+		}
+
+		int32_t cx = static_cast<int32_t>(x);
+		int32_t cy = static_cast<int32_t>(y);
+		for (int i = 0; i < CORDIC_ITERATIONS_USED; i++) {
+			int32_t dx = cx >> i;
+			int32_t dy = cy >> i;
+			if (cy > 0) {
+				cx += dy;
+				cy -= dx;
+				angle += Fixed_math::cordic_lut.value[i];
+			} else {
+				cx -= dy;
+				cy += dx;
+				angle -= Fixed_math::cordic_lut.value[i];
+			}
+		}
+		return angle;
+	}
+}
+
+Fixed_math::Angle Fixed_math::atan2_angle(Fixed_q16 y, Fixed_q16 x) {
+	return static_cast<Angle>((atan2_raw(y.raw, x.raw) + 0x8000u) >> 16);
+}
+
+Fixed_q16 Fixed_math::atan2(Fixed_q16 y, Fixed_q16 x) {
+	int32_t angle = static_cast<int32_t>(atan2_raw(y.raw, x.raw));
+	return Fixed_q16::from_raw(static_cast<int32_t>((static_cast<int64_t>(angle) * TWO_PI.raw) >> 32));
+}
+
+uint16_t Fixed_math::isqrt(uint32_t value) {
+
+	if (value == 0) return 0;
+
+	// Highest power of four <= value
+	uint32_t result = 0;
+	uint32_t bit = 1u << ((31 - __builtin_clz(value)) & ~1);
+
+	while (bit != 0) {
+		if (value >= result + bit) {
+			value -= result + bit;
+			result = (result >> 1) + bit;
+		} else {
+			result >>= 1;
+		}
+		bit >>= 2;
+	}
+	return static_cast<uint16_t>(result);
+}
+
+uint32_t Fixed_math::isqrt(uint64_t value) {
+
+	if (value == 0) return 0;
+
+	uint64_t result = 0;
+	uint64_t bit = 1ull << ((63 - __builtin_clzll(value)) & ~1);
+
+	while (bit != 0) {
+		if (value >= result + bit) {
+			value -= result + bit;
+			result = (result >> 1) + bit;
+		} else {
+			result >>= 1;
+		}
+		bit >>= 2;
+	}
+	return static_cast<uint32_t>(result);
+}
+
+Fixed_q16 Fixed_math::sqrt(Fixed_q16 value) {
+
+	if (value.raw <= 0) return Fixed_q16();
+	// sqrt(raw / 2^16) * 2^16 == sqrt(raw * 2^16)
+	return Fixed_q16::from_raw(static_cast<int32_t>(isqrt(static_cast<uint64_t>(value.raw) << 16)));
+}
+
+namespace {
+
+	// 1 / d for d in [0.5, 1) given as Q0.32, result Q2.30.
+	// Initial estimate 48/17 - 32/17 * d (max error 1/17), then Newton: y = y * (2 - d * y).
+	// Three iterations reach the Q30 precision limit.
+	uint32_t reciprocal_normalized(uint32_t d) {
+		uint32_t y = 3031741621u - static_cast<uint32_t>((static_cast<uint64_t>(d) * 2021161081u) >> 32);
+		for (int i = 0; i < 3; i++) {
+			uint32_t dy = static_cast<uint32_t>((static_cast<uint64_t>(d) * y) >> 32);
+			uint32_t correction = 0x80000000u - dy;
+			y = static_cast<uint32_t>((static_cast<uint64_t>(y) * correction) >> 30);
+		}
+		return y;
+	}
+}
+
+Fixed_q16 Fixed_math::reciprocal(Fixed_q16 value) {
+
+	if (value.raw == 0) return Fixed_q16::max();
+
+	bool negative = value.raw < 0;
+	uint32_t u = negative ? 0u - static_cast<uint32_t>(value.raw) : static_cast<uint32_t>(value.raw);
+
+	int shift = __builtin_clz(u);
+	uint32_t y = reciprocal_normalized(u << shift);
+
+	// value = d * 2^(16 - shift)  ->  1 / value = y * 2^(shift - 16), result in Q16 = y * 2^shift / 2^30
+	uint64_t result = (shift >= 30) ? static_cast<uint64_t>(y) << (shift - 30) : static_cast<uint64_t>(y) >> (30 - shift);
+	if (result > static_cast<uint64_t>(INT32_MAX)) result = INT32_MAX;
+
+	int32_t raw = static_cast<int32_t>(result);
+	return Fixed_q16::from_raw(negative ? -raw : raw);
+}
+
+namespace {
+
+	// Squares are Q32, so the root of the sum is Q16 again
+	Fixed_q16 root_of_squares(uint64_t sum) {
+		uint32_t root = Fixed_math::isqrt(sum);
+		if (root > static_cast<uint32_t>(INT32_MAX)) root = INT32_MAX;
+		return Fixed_q16::from_raw(static_cast<int32_t>(root));
+	}
+
+	uint64_t square(Fixed_q16 value) {
+		return static_cast<uint64_t>(static_cast<int64_t>(value.raw) * value.raw);
+	}
+}
+
+Fixed_q16 Fixed_math::length(const Vec2_q16& v) {
+	return root_of_squares(square(v.x) + square(v.y));
+}
+
+Fixed_q16 Fixed_math::length(const Vec3_q16& v) {
+	return root_of_squares(square(v.x) + square(v.y) + square(v.z));
+}
+
+namespace {
+
+	// Normalizing is scale invariant: shift all components so the largest one is in
+	// [2^28, 2^29). Small vectors keep their precision and the length fits int32.
+	int normalize_shift(uint32_t max_component) {
+		int bits = 32 - __builtin_clz(max_component);
+		return 29 - bits;
+	}
+
+	int64_t apply_shift(int32_t raw, int shift) {
+		return shift >= 0 ? static_cast<int64_t>(raw) << shift : static_cast<int64_t>(raw) >> -shift;
+	}
+
+	uint32_t magnitude(int32_t raw) {
+		return raw < 0 ? 0u - static_cast<uint32_t>(raw) : static_cast<uint32_t>(raw);
+	}
+
+	// component / length in Q16, length in [2^28, 2^31)
+	Fixed_q16 divide_by_length(int64_t component, uint32_t length) {
+		int shift = __builtin_clz(length);
+		uint32_t y = reciprocal_normalized(length << shift);
+		// 1 / length = y * 2^(shift - 62), times 2^16 for Q16
+		return Fixed_q16::from_raw(static_cast<int32_t>((component * y) >> (46 - shift)));
+	}
+}
+
+Vec2_q16 Fixed_math::normalize(const Vec2_q16& v) {
+
+	uint32_t max_component = magnitude(v.x.raw) | magnitude(v.y.raw);
+	if (max_component == 0) return Vec2_q16{};
+
+	int shift = normalize_shift(max_component);
+	int64_t x = apply_shift(v.x.raw, shift);
+	int64_t y = apply_shift(v.y.raw, shift);
+	uint32_t len = isqrt(static_cast<uint64_t>(x * x + y * y));
+
+	return Vec2_q16{divide_by_length(x, len), divide_by_length(y, len)};
+}
+
+Vec3_q16 Fixed_math::normalize(const Vec3_q16& v) {
+
+	uint32_t max_component = magnitude(v.x.raw) | magnitude(v.y.raw) | magnitude(v.z.raw);
+	if (max_component == 0) return Vec3_q16{};
+
+	int shift = normalize_shift(max_component);
+	int64_t x = apply_shift(v.x.raw, shift);
+	int64_t y = apply_shift(v.y.raw, shift);
+	int64_t z = apply_shift(v.z.raw, shift);
+	uint32_t len = isqrt(static_cast<uint64_t>(x * x + y * y + z * z));
+
+	return Vec3_q16{divide_by_length(x, len), divide_by_length(y, len), divide_by_length(z, len)};
+}
@@ -0,0 +1,156 @@
+#ifndef FIXED_MATH_H
+#define FIXED_MATH_H
+
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+#else
+    #include "pico/stdlib.h"
+#endif
+#include "engine/math/fixed_point.h"
+
+// Trigonometry, sqrt and reciprocal without float.
+// Angles are binary angles: a full turn is 65536, so wrap around is free (uint16_t overflow).
+// 0x4000 = 90°, 0x8000 = 180°, 0xC000 = 270°.
+
+struct Vec2_q16 {
+	Fixed_q16 x = 0;
+	Fixed_q16 y = 0;
+};
+
+struct Vec3_q16 {
+	Fixed_q16 x = 0;
+	Fixed_q16 y = 0;
+	Fixed_q16 z = 0;
+};
+
+namespace Fixed_math {
+
+	using Angle = uint16_t;
+
+	constexpr Angle ANGLE_90 = 0x4000;
+	constexpr Angle ANGLE_180 = 0x8000;
+	constexpr Angle ANGLE_270 = 0xC000;
+
+	constexpr Fixed_q16 PI = 3.14159265358979_q16;
+	constexpr Fixed_q16 TWO_PI = 6.28318530717959_q16;
+	constexpr Fixed_q16 HALF_PI = 1.57079632679490_q16;
+
+	// Compile-time helpers used to build the tables (double precision, never called at runtime)
+	namespace table_gen {
+
+		constexpr double PI_D = 3.14159265358979323846;
+
+		// Taylor series, x in [0, pi/2]
+		constexpr double sin_series(double x) {
+			double term = x;
+			double sum = x;
+			for (int n = 1; n < 12; n++) {
+				term *= -x * x / ((2 * n) * (2 * n + 1));
+				sum += term;
+			}
+			return sum;
+		}
+		// Series converges quickly for |x| <= 0.5, pi/4 is used for x == 1
+		constexpr double atan_series(double x) {
+			double power = x;
+			double sum = 0;
+			for (int n = 0; n < 40; n++) {
+				sum += ((n & 1) ? -power : power) / (2 * n + 1);
+				power *= x * x;
+			}
+			return sum;
+		}
+	}
+
+	// Quarter wave sine, Q16.16, 256 steps + end point for interpolation
+	constexpr int SIN_LUT_BITS = 8;
+	constexpr int SIN_LUT_SIZE = (1 << SIN_LUT_BITS) + 1;
+
+	struct Sin_lut {
+		int32_t value[SIN_LUT_SIZE];
+
+		constexpr Sin_lut() : value() {
+			for (int i = 0; i < SIN_LUT_SIZE; i++) {
+				double x = table_gen::sin_series(table_gen::PI_D / 2 * i / (SIN_LUT_SIZE - 1));
+				value[i] = static_cast<int32_t>(x * 65536.0 + 0.5);
+			}
+		}
+	};
+	inline constexpr Sin_lut sin_lut{};
+
+	// atan(2^-i) for CORDIC, in 32-bit binary angle units (full turn = 2^32)
+	constexpr int CORDIC_ITERATIONS = 24;
+
+	struct Cordic_lut {
+		uint32_t value[CORDIC_ITERATIONS];
+
+		constexpr Cordic_lut() : value() {
+			double x = 1.0;
+			for (int i = 0; i < CORDIC_ITERATIONS; i++) {
+				double angle = (i == 0) ? table_gen::PI_D / 4 : table_gen::atan_series(x);
+				value[i] = static_cast<uint32_t>(angle / (2 * table_gen::PI_D) * 4294967296.0 + 0.5);
+				x *= 0.5;
+			}
+		}
+	};
+	inline constexpr Cordic_lut cordic_lut{};
+
+	static_assert(sin_lut.value[0] == 0 && sin_lut.value[SIN_LUT_SIZE - 1] == 65536, "sin table end points");
+	static_assert(cordic_lut.value[0] == 0x20000000u, "atan(1) must be 45 degrees");
+
+	constexpr Fixed_q16 sin(Angle angle) {
+		uint16_t quadrant = angle >> 14;
+		uint16_t index = angle & 0x3FFF;
+		if (quadrant & 1) index = 0x4000 - index;	// mirror for 90°..180° and 270°..360°
+
+		// 14 bit position inside the quarter -> 8 bit table index + 6 bit interpolation
+		constexpr int frac_bits = 14 - SIN_LUT_BITS;
+		uint16_t i = index >> frac_bits;
+		int32_t frac = index & ((1 << frac_bits) - 1);
+		int32_t a = sin_lut.value[i];
+		int32_t b = (frac != 0) ? sin_lut.value[i + 1] : a;
+		int32_t value = a + (((b - a) * frac) >> frac_bits);
+
+		return Fixed_q16::from_raw((quadrant & 2) ? -value : value);
+	}
+	constexpr Fixed_q16 cos(Angle angle) {
+		return sin(static_cast<Angle>(angle + ANGLE_90));
+	}
+
+	// Radians <-> binary angle. Any radian value maps into one turn.
+	constexpr Angle to_angle(Fixed_q16 radians) {
+		// 65536 / (2 * pi) in Q32
+		return static_cast<Angle>((static_cast<int64_t>(radians.raw) * 683565276LL) >> 32);
+	}
+	constexpr Fixed_q16 to_radians(Angle angle) {
+		// signed so the result is in [-pi, pi)
+		return Fixed_q16::from_raw(static_cast<int32_t>((static_cast<int64_t>(static_cast<int16_t>(angle)) * TWO_PI.raw) >> 16));
+	}
+
+	constexpr Fixed_q16 sin(Fixed_q16 radians) { return sin(to_angle(radians)); }
+	constexpr Fixed_q16 cos(Fixed_q16 radians) { return cos(to_angle(radians)); }
+
+	// CORDIC vectoring, returns binary angle of (x, y). atan2(0, 0) == 0.
+	Angle atan2_angle(Fixed_q16 y, Fixed_q16 x);
+	// Radians in [-pi, pi)
+	Fixed_q16 atan2(Fixed_q16 y, Fixed_q16 x);
+
+	// Integer square roots (digit by digit, no multiply or divide)
+	uint16_t isqrt(uint32_t value);
+	uint32_t isqrt(uint64_t value);
+
+	// Negative input returns 0
+	Fixed_q16 sqrt(Fixed_q16 value);
+
+	// 1 / value via Newton-Raphson, no divide. Saturates for |value| < 2^-15, 0 returns max().
+	Fixed_q16 reciprocal(Fixed_q16 value);
+
+	Fixed_q16 length(const Vec2_q16& v);
+	Fixed_q16 length(const Vec3_q16& v);
+
+	// Zero vector stays zero
+	Vec2_q16 normalize(const Vec2_q16& v);
+	Vec3_q16 normalize(const Vec3_q16& v);
+}
+
+#endif
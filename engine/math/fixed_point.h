@@ -6,128 +6,242 @@
 #else
     #include "pico/stdlib.h"
 #endif
+#include <type_traits>
+#include <limits>
+
+// What happens when a result does not fit the storage type.
+// wrap     - two's complement wrap around (cheapest, old Fixed_q16 behaviour)
+// saturate - clamp to min/max representable value
+enum class Overflow : uint8_t {
+	wrap,
+	saturate,
+};
 
+namespace fixed_detail {
 
-struct Fixed_q16 {
-
-	int32_t raw;
-
-	Fixed_q16() : raw(0){}
-	Fixed_q16(int32_t input) : raw(to_fixed(input)) {}
+	// Smallest signed type holding Bits bits
+	template<int Bits>
+	using storage_for = std::conditional_t<(Bits <= 8), int8_t,
+						std::conditional_t<(Bits <= 16), int16_t,
+						std::conditional_t<(Bits <= 32), int32_t, int64_t>>>;
 
-	#ifdef PLATFORM_DESKTOP
-		Fixed_q16(float input) : raw(static_cast<int32_t>(input * 65536.0f)) {}
-	#endif
+	// Intermediate type for multiply/divide (twice the storage width)
+	template<typename Storage>
+	using wide_t = std::conditional_t<(sizeof(Storage) <= 2), int32_t, int64_t>;
 
-	inline int32_t to_fixed(const int32_t input) const {
-		return (input << 16);
-	}
-	inline int32_t to_int() {
-		return (raw >> 16);
+	template<typename Storage, Overflow Policy, typename Wide>
+	constexpr Storage narrow(Wide value) {
+		if constexpr (Policy == Overflow::saturate) {
+			if (value > static_cast<Wide>(std::numeric_limits<Storage>::max())) return std::numeric_limits<Storage>::max();
+			if (value < static_cast<Wide>(std::numeric_limits<Storage>::min())) return std::numeric_limits<Storage>::min();
+		}
+		return static_cast<Storage>(value);
 	}
 
-
-	Fixed_q16 operator+(const Fixed_q16& other) const {
-		Fixed_q16 result;
-		result.raw = raw + other.raw;
-		return result;
-	}
-	Fixed_q16 operator-(const Fixed_q16& other) const {
-		Fixed_q16 result;
-		result.raw = raw - other.raw;
-		return result;
-	}
-	Fixed_q16 operator*(const Fixed_q16& other) const {
-		Fixed_q16 result;
-		result.raw = (static_cast<int64_t>(raw) * other.raw) >> 16;
-		return result;
-	}
-	Fixed_q16 operator/(const Fixed_q16& other) const {
-		Fixed_q16 result;
-		result.raw = (static_cast<int64_t>(raw) << 16) / other.raw;
-		return result;
+	// Shift that accepts negative amounts (used by mixed-format conversion)
+	template<typename T>
+	constexpr T shift(T value, int amount) {
+		return amount >= 0 ? static_cast<T>(value * (T(1) << amount)) : static_cast<T>(value >> -amount);
 	}
+}
 
-	bool operator>(const Fixed_q16& other) const {
-		Fixed_q16 result;
-		return (raw > other.raw) ;
-	}
-	bool operator<(const Fixed_q16& other) const {
-		Fixed_q16 result;
-		return (raw < other.raw);
-	}
+// Signed fixed point number, Q<IntBits>.<FracBits>
+// IntBits includes the sign bit: Q8.8 and Q1.15 fit int16_t, Q16.16 and Q24.8 fit int32_t.
+template<int IntBits, int FracBits,
+		 typename Storage = fixed_detail::storage_for<IntBits + FracBits>,
+		 Overflow Policy = Overflow::wrap>
+struct Fixed {
 
-	bool operator>(const int32_t other) const {
-		Fixed_q16 result;
-		return (raw > to_fixed(other)) ;
-	}
-	bool operator<(const int32_t other) const {
-		Fixed_q16 result;
-		return (raw < to_fixed(other));
-	}
+	static_assert(std::is_integral_v<Storage> && std::is_signed_v<Storage>, "Fixed storage must be a signed integer");
+	static_assert(IntBits >= 1 && FracBits >= 0, "Fixed needs a sign bit");
+	static_assert(IntBits + FracBits <= static_cast<int>(sizeof(Storage) * 8), "Q format does not fit storage type");
 
-	// bool operator>(const uint16_t other) const {
-	// 	Fixed_q16 result;
-	// 	return (raw > to_fixed(static_cast<int32_t>(other))) ;
-	// }
-	// bool operator<(const uint16_t other) const {
-	// 	Fixed_q16 result;
-	// 	return (raw < to_fixed(static_cast<int32_t>(other)));
-	// }
+	using storage_type = Storage;
+	using wide_type = fixed_detail::wide_t<Storage>;
 
-	bool operator>=(const int32_t other) const {
-		Fixed_q16 result;
-		return (raw >= to_fixed(other)) ;
-	}
-	bool operator<=(const int32_t other) const {
-		Fixed_q16 result;
-		return (raw <= to_fixed(other));
-	}
+	static constexpr int int_bits = IntBits;
+	static constexpr int frac_bits = FracBits;
+	static constexpr Overflow policy = Policy;
+	static constexpr wide_type one_raw = wide_type(1) << FracBits;
 
-	bool operator>=(const int16_t other) const {
-		Fixed_q16 result;
-		return (raw >= to_fixed(other)) ;
-	}
-	bool operator<=(const int16_t other) const {
-		Fixed_q16 result;
-		return (raw <= to_fixed(other));
-	}
+	Storage raw;
 
-	Fixed_q16& operator+=(const int32_t other) {
+	constexpr Fixed() : raw(0) {}
 
-		raw += to_fixed(other);
-		return *this;
-	}
-	Fixed_q16& operator-=(const int32_t other) {
+	template<typename Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+	constexpr Fixed(Int input) : raw(to_fixed(input)) {}
 
-		raw -= to_fixed(other);
-		return *this;
-	}
+	// Rounds to nearest. Usable on every platform, but keep it out of hot loops on
+	// MCUs without FPU - in constexpr context (literals, tables) it costs nothing.
+	template<typename Float, std::enable_if_t<std::is_floating_point_v<Float>, int> = 0>
+	constexpr Fixed(Float input) : raw(from_float(input)) {}
 
-	Fixed_q16& operator-=(const Fixed_q16& other) {
-		raw -= other.raw;
-		return *this;
-	}
-	Fixed_q16& operator+=(const Fixed_q16& other) {
-		raw += other.raw;
-		return *this;
-	}
+	// Mixed-format conversion, explicit because it can lose precision or range
+	template<int I2, int F2, typename S2, Overflow P2>
+	explicit constexpr Fixed(const Fixed<I2, F2, S2, P2>& other) : raw(convert(other.raw, F2)) {}
 
-	Fixed_q16 operator+(const uint32_t other) const {
-		Fixed_q16 result;
-		result.raw = raw + to_fixed(other);
-		return result;
-	}
-	Fixed_q16 operator-(const uint32_t other) const {
-		Fixed_q16 result;
-		result.raw = raw - to_fixed(other);
+	static constexpr Fixed from_raw(Storage value) {
+		Fixed result;
+		result.raw = value;
 		return result;
 	}
-	Fixed_q16 operator*(const uint32_t other) const {
-		Fixed_q16 result;
-		result.raw = raw * other;
-		return result;
+	static constexpr Fixed max() { return from_raw(std::numeric_limits<Storage>::max()); }
+	static constexpr Fixed min() { return from_raw(std::numeric_limits<Storage>::min()); }
+	static constexpr Fixed epsilon() { return from_raw(1); }
+
+	template<typename Int>
+	static constexpr Storage to_fixed(const Int input) {
+		return fixed_detail::narrow<Storage, Policy>(static_cast<wide_type>(input) * one_raw);
 	}
+	template<typename Float>
+	static constexpr Storage from_float(const Float input) {
+		Float scaled = input * static_cast<Float>(one_raw);
+		scaled += (scaled < 0) ? Float(-0.5) : Float(0.5);
+		if constexpr (Policy == Overflow::saturate) {
+			if (scaled >= static_cast<Float>(std::numeric_limits<Storage>::max())) return std::numeric_limits<Storage>::max();
+			if (scaled <= static_cast<Float>(std::numeric_limits<Storage>::min())) return std::numeric_limits<Storage>::min();
+		}
+		return static_cast<Storage>(static_cast<wide_type>(scaled));
+	}
+	template<typename S2>
+	static constexpr Storage convert(const S2 other_raw, const int other_frac) {
+		using Big = int64_t;
+		return fixed_detail::narrow<Storage, Policy>(fixed_detail::shift<Big>(other_raw, FracBits - other_frac));
+	}
+
+	// Floor towards -inf (arithmetic shift), same as the old Fixed_q16::to_int
+	constexpr int32_t to_int() const {
+		return static_cast<int32_t>(raw >> FracBits);
+	}
+	constexpr int32_t round_to_int() const {
+		return static_cast<int32_t>((static_cast<wide_type>(raw) + (one_raw >> 1)) >> FracBits);
+	}
+	constexpr float to_float() const {
+		return static_cast<float>(raw) / static_cast<float>(one_raw);
+	}
+
+	constexpr Fixed operator-() const {
+		return from_raw(fixed_detail::narrow<Storage, Policy>(-static_cast<wide_type>(raw)));
+	}
+
+	constexpr Fixed operator+(const Fixed& other) const {
+		return from_raw(fixed_detail::narrow<Storage, Policy>(static_cast<wide_type>(raw) + other.raw));
+	}
+	constexpr Fixed operator-(const Fixed& other) const {
+		return from_raw(fixed_detail::narrow<Storage, Policy>(static_cast<wide_type>(raw) - other.raw));
+	}
+	constexpr Fixed operator*(const Fixed& other) const {
+		return from_raw(fixed_detail::narrow<Storage, Policy>((static_cast<wide_type>(raw) * other.raw) >> FracBits));
+	}
+	constexpr Fixed operator/(const Fixed& other) const {
+		return from_raw(fixed_detail::narrow<Storage, Policy>((static_cast<wide_type>(raw) * one_raw) / other.raw));
+	}
+
+	// Integer operands - no conversion of the integer to fixed for * and /,
+	// so "x / 2" is a plain integer divide instead of a wide divide.
+	template<typename Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+	constexpr Fixed operator+(const Int other) const {
+		return from_raw(fixed_detail::narrow<Storage, Policy>(static_cast<wide_type>(raw) + static_cast<wide_type>(other) * one_raw));
+	}
+	template<typename Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+	constexpr Fixed operator-(const Int other) const {
+		return from_raw(fixed_detail::narrow<Storage, Policy>(static_cast<wide_type>(raw) - static_cast<wide_type>(other) * one_raw));
+	}
+	template<typename Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+	constexpr Fixed operator*(const Int other) const {
+		return from_raw(fixed_detail::narrow<Storage, Policy>(static_cast<int64_t>(raw) * static_cast<int64_t>(other)));
+	}
+	template<typename Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+	constexpr Fixed operator/(const Int other) const {
+		// 32-bit divide when both sides fit (a 64-bit divide is a library call on Cortex-M0+)
+		using Div = std::conditional_t<(sizeof(Int) < 4 || (sizeof(Int) == 4 && std::is_signed_v<Int>)) && sizeof(Storage) <= 4, int32_t, int64_t>;
+		// INT32_MIN / -1 overflows the 32-bit divide: negate in the wide type, which wraps or saturates
+		if constexpr (std::is_same_v<Div, int32_t> && std::is_signed_v<Int>) {
+			if (other == -1) return -*this;
+		}
+		return from_raw(fixed_detail::narrow<Storage, Policy>(static_cast<Div>(raw) / static_cast<Div>(other)));
+	}
+
+	// Arithmetic shift of the raw value: x >> 1 halves (rounding towards -inf) without a divide
+	constexpr Fixed operator>>(const int shift) const {
+		return from_raw(static_cast<Storage>(raw >> shift));
+	}
+	constexpr Fixed operator<<(const int shift) const {
+		return from_raw(fixed_detail::narrow<Storage, Policy>(static_cast<wide_type>(raw) * (wide_type(1) << shift)));
+	}
+
+	constexpr Fixed& operator+=(const Fixed& other) { return *this = *this + other; }
+	constexpr Fixed& operator-=(const Fixed& other) { return *this = *this - other; }
+	constexpr Fixed& operator*=(const Fixed& other) { return *this = *this * other; }
+	constexpr Fixed& operator/=(const Fixed& other) { return *this = *this / other; }
+
+	template<typename Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+	constexpr Fixed& operator+=(const Int other) { return *this = *this + other; }
+	template<typename Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+	constexpr Fixed& operator-=(const Int other) { return *this = *this - other; }
+	template<typename Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+	constexpr Fixed& operator*=(const Int other) { return *this = *this * other; }
+	template<typename Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+	constexpr Fixed& operator/=(const Int other) { return *this = *this / other; }
+
+	constexpr bool operator==(const Fixed& other) const { return raw == other.raw; }
+	constexpr bool operator!=(const Fixed& other) const { return raw != other.raw; }
+	constexpr bool operator<(const Fixed& other) const { return raw < other.raw; }
+	constexpr bool operator>(const Fixed& other) const { return raw > other.raw; }
+	constexpr bool operator<=(const Fixed& other) const { return raw <= other.raw; }
+	constexpr bool operator>=(const Fixed& other) const { return raw >= other.raw; }
+
+	// Integer comparisons are done in the wide type, so comparing a Q8.8 against
+	// 1000 does not overflow the way converting 1000 to Q8.8 would.
+	template<typename Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+	constexpr bool operator==(const Int other) const { return static_cast<int64_t>(raw) == static_cast<int64_t>(other) * one_raw; }
+	template<typename Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+	constexpr bool operator!=(const Int other) const { return !(*this == other); }
+	template<typename Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+	constexpr bool operator<(const Int other) const { return static_cast<int64_t>(raw) < static_cast<int64_t>(other) * one_raw; }
+	template<typename Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+	constexpr bool operator>(const Int other) const { return static_cast<int64_t>(raw) > static_cast<int64_t>(other) * one_raw; }
+	template<typename Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+	constexpr bool operator<=(const Int other) const { return !(*this > other); }
+	template<typename Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+	constexpr bool operator>=(const Int other) const { return !(*this < other); }
 };
 
+// Explicit format change, e.g. fixed_cast<Fixed_q8>(position)
+template<typename To, int I, int F, typename S, Overflow P>
+constexpr To fixed_cast(const Fixed<I, F, S, P>& from) {
+	return To(from);
+}
+
+template<int I, int F, typename S, Overflow P>
+constexpr Fixed<I, F, S, P> abs(const Fixed<I, F, S, P>& value) {
+	return value.raw < 0 ? -value : value;
+}
+
+// Formats used by the engine
+using Fixed_q16 = Fixed<16, 16>;	// positions, general math (±32767, 1/65536 step)
+using Fixed_q8  = Fixed<8, 8>;		// compact positions/velocities in large pools (±127)
+using Fixed_q24 = Fixed<24, 8>;		// large world coordinates (±8M)
+using Fixed_q15 = Fixed<1, 15>;		// normalized values, audio samples, sin/cos [-1, 1)
+
+using Fixed_q16_sat = Fixed<16, 16, int32_t, Overflow::saturate>;
+using Fixed_q8_sat  = Fixed<8, 8, int16_t, Overflow::saturate>;
+using Fixed_q15_sat = Fixed<1, 15, int16_t, Overflow::saturate>;
+
+// Literals: 1.5_q16, 3_q8, 0.25_q15 ... evaluated at compile time
+constexpr Fixed_q16 operator""_q16(long double value) { return Fixed_q16(value); }
+constexpr Fixed_q16 operator""_q16(unsigned long long value) { return Fixed_q16(value); }
+constexpr Fixed_q8  operator""_q8(long double value) { return Fixed_q8(value); }
+constexpr Fixed_q8  operator""_q8(unsigned long long value) { return Fixed_q8(value); }
+constexpr Fixed_q24 operator""_q24(long double value) { return Fixed_q24(value); }
+constexpr Fixed_q24 operator""_q24(unsigned long long value) { return Fixed_q24(value); }
+constexpr Fixed_q15 operator""_q15(long double value) { return Fixed_q15(value); }
+
+static_assert(sizeof(Fixed_q8) == 2 && sizeof(Fixed_q15) == 2, "16-bit formats must stay 2 bytes");
+static_assert(sizeof(Fixed_q16) == 4 && sizeof(Fixed_q24) == 4, "32-bit formats must stay 4 bytes");
+static_assert((1.5_q16).raw == 0x18000, "Q16.16 literal");
+static_assert((0.5_q15).raw == 0x4000, "Q1.15 literal");
+static_assert(Fixed_q8(fixed_cast<Fixed_q16>(2.25_q8)).raw == (2.25_q8).raw, "mixed format round trip");
+static_assert(Fixed_q8_sat(1000).raw == INT16_MAX, "saturating construction");
+
 #endif
@@ -0,0 +1,162 @@
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstring>
+#else
+    #include "pico/stdlib.h"
+#endif
+
+#include "random.h"
+
+void Random::Xoshiro128::jump() {
+
+	static const uint32_t JUMP[] = {0x8764000B, 0xF542D2D3, 0x6FA035C3, 0x77F2DB5B};
+
+	uint32_t j0 = 0, j1 = 0, j2 = 0, j3 = 0;
+	for (uint32_t word : JUMP) {
+		for (int bit = 0; bit < 32; bit++) {
+			if (word & (1u << bit)) {
+				j0 ^= s[0];
+				j1 ^= s[1];
+				j2 ^= s[2];
+				j3 ^= s[3];
+			}
+			next();
+		}
+	}
+	s[0] = j0;
+	s[1] = j1;
+	s[2] = j2;
+	s[3] = j3;
+}
+
+void Random::Xoshiro128_x4::seed(uint32_t seed) {
+
+	Xoshiro128 lane(seed);
+	for (int i = 0; i < LANES; i++) {
+		s0[i] = lane.s[0];
+		s1[i] = lane.s[1];
+		s2[i] = lane.s[2];
+		s3[i] = lane.s[3];
+		lane.jump();
+	}
+}
+
+namespace {
+
+	// One xoshiro128** step on lane i of the SoA state
+	inline uint32_t step_lane(uint32_t* s0, uint32_t* s1, uint32_t* s2, uint32_t* s3, int i) {
+		uint32_t result = Random::rotl(s1[i] * 5, 7) * 9;
+		uint32_t t = s1[i] << 9;
+		s2[i] ^= s0[i];
+		s3[i] ^= s1[i];
+		s1[i] ^= s2[i];
+		s0[i] ^= s3[i];
+		s2[i] ^= t;
+		s3[i] = Random::rotl(s3[i], 11);
+		return result;
+	}
+}
+
+#ifdef PLATFORM_DESKTOP
+// GCC/Clang vector extension: the four lanes are one SSE/NEON register.
+// (Auto-vectorization keeps the lanes in scalar registers for this loop.)
+typedef uint32_t u32x4 __attribute__((vector_size(16)));
+
+void Random::Xoshiro128_x4::fill(uint32_t* out, size_t count) {
+
+	static_assert(LANES == 4, "vector path assumes 4 lanes");
+	u32x4 a, b, c, d;
+	memcpy(&a, s0, sizeof(a));
+	memcpy(&b, s1, sizeof(b));
+	memcpy(&c, s2, sizeof(c));
+	memcpy(&d, s3, sizeof(d));
+
+	size_t i = 0;
+	for (; i + LANES <= count; i += LANES) {
+		u32x4 x = b * 5;
+		u32x4 result = ((x << 7) | (x >> 25)) * 9;
+		memcpy(out + i, &result, sizeof(result));
+		u32x4 t = b << 9;
+		c ^= a;
+		d ^= b;
+		b ^= c;
+		a ^= d;
+		c ^= t;
+		d = (d << 11) | (d >> 21);
+	}
+
+	memcpy(s0, &a, sizeof(a));
+	memcpy(s1, &b, sizeof(b));
+	memcpy(s2, &c, sizeof(c));
+	memcpy(s3, &d, sizeof(d));
+
+	for (int l = 0; i < count; i++, l++) {
+		out[i] = step_lane(s0, s1, s2, s3, l);
+	}
+}
+#else
+void Random::Xoshiro128_x4::fill(uint32_t* out, size_t count) {
+
+	size_t i = 0;
+	for (; i + LANES <= count; i += LANES) {
+		for (int l = 0; l < LANES; l++) {
+			out[i + l] = step_lane(s0, s1, s2, s3, l);
+		}
+	}
+	for (int l = 0; i < count; i++, l++) {
+		out[i] = step_lane(s0, s1, s2, s3, l);
+	}
+}
+#endif
+
+void Random::Xoshiro128_x4::fill_range(int32_t* out, size_t count, int32_t min, int32_t max) {
+
+	uint32_t range = static_cast<uint32_t>(max) - static_cast<uint32_t>(min) + 1u;
+	const uint32_t base = static_cast<uint32_t>(min);
+	if (range == 0) {	// full 32-bit range, raw bits are already uniform
+		fill(reinterpret_cast<uint32_t*>(out), count);
+		return;
+	}
+	uint32_t threshold = (0u - range) % range;
+
+	// Blocks: draw raw bits (vectorized), map them branch free (vectorized),
+	// and only walk the block again in the rare case something was rejected.
+	constexpr size_t BLOCK = 256;
+	uint32_t bits[BLOCK];
+	for (size_t start = 0; start < count; start += BLOCK) {
+		size_t n = (count - start < BLOCK) ? count - start : BLOCK;
+		fill(bits, n);
+
+		int32_t* block_out = out + start;
+		uint32_t rejected = 0;
+		for (size_t i = 0; i < n; i++) {
+			uint64_t m = static_cast<uint64_t>(bits[i]) * range;
+			block_out[i] = static_cast<int32_t>(base + static_cast<uint32_t>(m >> 32));
+			rejected |= static_cast<uint32_t>(static_cast<uint32_t>(m) < threshold);
+		}
+		if (!rejected) continue;
+
+		for (size_t i = 0; i < n; i++) {
+			uint64_t m = static_cast<uint64_t>(bits[i]) * range;
+			if (static_cast<uint32_t>(m) >= threshold) continue;
+			while (static_cast<uint32_t>(m) < threshold) {
+				m = static_cast<uint64_t>(step_lane(s0, s1, s2, s3, i % LANES)) * range;
+			}
+			block_out[i] = static_cast<int32_t>(base + static_cast<uint32_t>(m >> 32));
+		}
+	}
+}
+
+void Random::Xoshiro128_x4::fill_uniform(Fixed_q16* out, size_t count, Fixed_q16 min, Fixed_q16 max) {
+
+	static_assert(sizeof(Fixed_q16) == sizeof(uint32_t), "Fixed_q16 must be a plain int32");
+	uint32_t* bits = reinterpret_cast<uint32_t*>(out);
+	fill(bits, count);
+
+	uint32_t span = static_cast<uint32_t>(max.raw) - static_cast<uint32_t>(min.raw);
+	const uint32_t base = static_cast<uint32_t>(min.raw);
+	for (size_t i = 0; i < count; i++) {
+		out[i].raw = static_cast<int32_t>(base + static_cast<uint32_t>((static_cast<uint64_t>(bits[i]) * span) >> 32));
+	}
+}
@@ -0,0 +1,153 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+#else
+    #include "pico/stdlib.h"
+#endif
+#include "engine/math/fixed_point.h"
+
+// Small deterministic generators for hot loops.
+// Pure 32/64-bit integer math: same seed gives the same sequence on desktop and MCU (replays).
+// Both satisfy UniformRandomBitGenerator, so std:: distributions still work with them.
+
+namespace Random {
+
+	// splitmix32 - expands one seed word into well mixed state words
+	inline uint32_t splitmix32(uint32_t& state) {
+		uint32_t z = (state += 0x9E3779B9u);
+		z = (z ^ (z >> 16)) * 0x85EBCA6Bu;
+		z = (z ^ (z >> 13)) * 0xC2B2AE35u;
+		return z ^ (z >> 16);
+	}
+
+	inline uint32_t rotl(uint32_t x, int k) {
+		return (x << k) | (x >> (32 - k));
+	}
+
+	// Lemire's multiply-shift: unbiased value in [0, range) without a modulo in the common case
+	template<typename Generator>
+	inline uint32_t bounded(Generator& gen, uint32_t range) {
+		uint64_t m = static_cast<uint64_t>(gen.next()) * range;
+		uint32_t low = static_cast<uint32_t>(m);
+		if (low < range) {
+			uint32_t threshold = (0u - range) % range;
+			while (low < threshold) {
+				m = static_cast<uint64_t>(gen.next()) * range;
+				low = static_cast<uint32_t>(m);
+			}
+		}
+		return static_cast<uint32_t>(m >> 32);
+	}
+
+	// Common helpers shared by the generators
+	template<typename Derived>
+	struct Generator_base {
+
+		using result_type = uint32_t;
+		static constexpr result_type min() { return 0; }
+		static constexpr result_type max() { return UINT32_MAX; }
+		result_type operator()() { return self().next(); }
+
+		// [0, range)
+		uint32_t bounded(uint32_t range) { return Random::bounded(self(), range); }
+
+		// [min, max] inclusive. Span and offset are unsigned: max - min can exceed INT32_MAX.
+		int32_t range(int32_t min, int32_t max) {
+			uint32_t span = static_cast<uint32_t>(max) - static_cast<uint32_t>(min) + 1u;
+			if (span == 0) return static_cast<int32_t>(self().next());		// full 32-bit range
+			return static_cast<int32_t>(static_cast<uint32_t>(min) + Random::bounded(self(), span));
+		}
+
+		// [0, 1) with full Q16 resolution
+		Fixed_q16 uniform() { return Fixed_q16::from_raw(static_cast<int32_t>(self().next() >> 16)); }
+
+		// [min, max)
+		Fixed_q16 uniform(Fixed_q16 min, Fixed_q16 max) {
+			uint32_t span = static_cast<uint32_t>(max.raw) - static_cast<uint32_t>(min.raw);
+			return Fixed_q16::from_raw(static_cast<int32_t>(static_cast<uint32_t>(min.raw) + ((static_cast<uint64_t>(self().next()) * span) >> 32)));
+		}
+
+		bool chance(Fixed_q16 probability) { return uniform() < probability; }
+
+	private:
+		Derived& self() { return static_cast<Derived&>(*this); }
+	};
+
+	// xoshiro128** - 16 bytes of state, only 32-bit ops (fast on Cortex-M0+)
+	struct Xoshiro128 : Generator_base<Xoshiro128> {
+
+		uint32_t s[4];
+
+		explicit Xoshiro128(uint32_t seed = 1) { this->seed(seed); }
+
+		void seed(uint32_t seed) {
+			for (uint32_t& word : s) word = splitmix32(seed);
+		}
+
+		uint32_t next() {
+			uint32_t result = rotl(s[1] * 5, 7) * 9;
+			uint32_t t = s[1] << 9;
+			s[2] ^= s[0];
+			s[3] ^= s[1];
+			s[1] ^= s[2];
+			s[0] ^= s[3];
+			s[2] ^= t;
+			s[3] = rotl(s[3], 11);
+			return result;
+		}
+
+		// Advance 2^64 steps - gives non-overlapping streams from one seed
+		void jump();
+	};
+
+	// PCG32 (XSH RR) - 8 bytes state + stream id. Uses a 64-bit multiply, best on desktop/M7.
+	struct Pcg32 : Generator_base<Pcg32> {
+
+		uint64_t state = 0;
+		uint64_t increment = 1;
+
+		explicit Pcg32(uint64_t seed = 0x853C49E6748FEA9Bull, uint64_t stream = 0xDA3E39CB94B95BDBull) {
+			this->seed(seed, stream);
+		}
+
+		void seed(uint64_t seed, uint64_t stream = 0xDA3E39CB94B95BDBull) {
+			state = 0;
+			increment = (stream << 1) | 1u;
+			next();
+			state += seed;
+			next();
+		}
+
+		uint32_t next() {
+			uint64_t old = state;
+			state = old * 6364136223846793005ull + increment;
+			uint32_t xorshifted = static_cast<uint32_t>(((old >> 18) ^ old) >> 27);
+			uint32_t rot = static_cast<uint32_t>(old >> 59);
+			return (xorshifted >> rot) | (xorshifted << ((0u - rot) & 31));
+		}
+	};
+
+	// Four xoshiro128** lanes in SoA layout for bulk fills. Lane i is an independent
+	// stream (jumped 2^64 * i from the seed), output is lane interleaved: 0,1,2,3,0,1,...
+	// Lanes are independent; on desktop the four lanes run as one 128-bit vector.
+	struct Xoshiro128_x4 {
+
+		static constexpr int LANES = 4;
+		uint32_t s0[LANES], s1[LANES], s2[LANES], s3[LANES];
+
+		explicit Xoshiro128_x4(uint32_t seed = 1) { this->seed(seed); }
+
+		void seed(uint32_t seed);
+
+		void fill(uint32_t* out, size_t count);
+		// Unbiased values in [min, max] (Lemire, the rare rejected value is redrawn from its own lane)
+		void fill_range(int32_t* out, size_t count, int32_t min, int32_t max);
+		// Q16 values in [min, max)
+		void fill_uniform(Fixed_q16* out, size_t count, Fixed_q16 min, Fixed_q16 max);
+	};
+}
+
+#endif
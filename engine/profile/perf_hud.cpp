@@ -0,0 +1,363 @@
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstdio>
+    #include <cstring>
+    #include <sys/resource.h>
+#else
+    #include "pico/stdlib.h"
+    #include "stdio.h"
+    #include "cstring"
+    #include <malloc.h>
+#endif
+#include <algorithm>
+
+#include "framebuffer.h"
+#include "perf_hud.h"
+
+#ifndef PLATFORM_DESKTOP
+// pico-sdk linker script: sbrk hands out end..__StackLimit, core 0 runs on
+// __StackBottom..__StackTop (PICO_STACK_SIZE)
+extern "C" {
+	extern char end;
+	extern char __StackLimit;
+	extern char __StackBottom;
+	extern char __StackTop;
+}
+#endif
+
+namespace {
+
+	constexpr uint16_t rows(uint16_t r0, uint16_t r1, uint16_t r2, uint16_t r3, uint16_t r4) {
+		return static_cast<uint16_t>((r0 << 12) | (r1 << 9) | (r2 << 6) | (r3 << 3) | r4);
+	}
+
+	// ' ' to '_', the printable ASCII range without lowercase
+	constexpr uint16_t GLYPHS[64] = {
+		rows(0b000, 0b000, 0b000, 0b000, 0b000),	// ' '
+		rows(0b010, 0b010, 0b010, 0b000, 0b010),	// !
+		rows(0b101, 0b101, 0b000, 0b000, 0b000),	// "
+		rows(0b101, 0b111, 0b101, 0b111, 0b101),	// #
+		rows(0b011, 0b110, 0b010, 0b011, 0b110),	// $
+		rows(0b101, 0b001, 0b010, 0b100, 0b101),	// %
+		rows(0b010, 0b101, 0b010, 0b101, 0b011),	// &
+		rows(0b010, 0b010, 0b000, 0b000, 0b000),	// '
+		rows(0b001, 0b010, 0b010, 0b010, 0b001),	// (
+		rows(0b100, 0b010, 0b010, 0b010, 0b100),	// )
+		rows(0b000, 0b101, 0b010, 0b101, 0b000),	// *
+		rows(0b000, 0b010, 0b111, 0b010, 0b000),	// +
+		rows(0b000, 0b000, 0b000, 0b010, 0b100),	// ,
+		rows(0b000, 0b000, 0b111, 0b000, 0b000),	// -
+		rows(0b000, 0b000, 0b000, 0b000, 0b010),	// .
+		rows(0b001, 0b001, 0b010, 0b100, 0b100),	// /
+		rows(0b111, 0b101, 0b101, 0b101, 0b111),	// 0
+		rows(0b010, 0b110, 0b010, 0b010, 0b111),	// 1
+		rows(0b111, 0b001, 0b111, 0b100, 0b111),	// 2
+		rows(0b111, 0b001, 0b111, 0b001, 0b111),	// 3
+		rows(0b101, 0b101, 0b111, 0b001, 0b001),	// 4
+		rows(0b111, 0b100, 0b111, 0b001, 0b111),	// 5
+		rows(0b111, 0b100, 0b111, 0b101, 0b111),	// 6
+		rows(0b111, 0b001, 0b001, 0b001, 0b001),	// 7
+		rows(0b111, 0b101, 0b111, 0b101, 0b111),	// 8
+		rows(0b111, 0b101, 0b111, 0b001, 0b111),	// 9
+		rows(0b000, 0b010, 0b000, 0b010, 0b000),	// :
+		rows(0b000, 0b010, 0b000, 0b010, 0b100),	// ;
+		rows(0b001, 0b010, 0b100, 0b010, 0b001),	// <
+		rows(0b000, 0b111, 0b000, 0b111, 0b000),	// =
+		rows(0b100, 0b010, 0b001, 0b010, 0b100),	// >
+		rows(0b111, 0b001, 0b010, 0b000, 0b010),	// ?
+		rows(0b010, 0b101, 0b111, 0b100, 0b011),	// @
+		rows(0b010, 0b101, 0b111, 0b101, 0b101),	// A
+		rows(0b110, 0b101, 0b110, 0b101, 0b110),	// B
+		rows(0b011, 0b100, 0b100, 0b100, 0b011),	// C
+		rows(0b110, 0b101, 0b101, 0b101, 0b110),	// D
+		rows(0b111, 0b100, 0b110, 0b100, 0b111),	// E
+		rows(0b111, 0b100, 0b110, 0b100, 0b100),	// F
+		rows(0b011, 0b100, 0b101, 0b101, 0b011),	// G
+		rows(0b101, 0b101, 0b111, 0b101, 0b101),	// H
+		rows(0b111, 0b010, 0b010, 0b010, 0b111),	// I
+		rows(0b001, 0b001, 0b001, 0b101, 0b010),	// J
+		rows(0b101, 0b101, 0b110, 0b101, 0b101),	// K
+		rows(0b100, 0b100, 0b100, 0b100, 0b111),	// L
+		rows(0b101, 0b111, 0b111, 0b101, 0b101),	// M
+		rows(0b110, 0b101, 0b101, 0b101, 0b101),	// N
+		rows(0b010, 0b101, 0b101, 0b101, 0b010),	// O
+		rows(0b110, 0b101, 0b110, 0b100, 0b100),	// P
+		rows(0b010, 0b101, 0b101, 0b110, 0b011),	// Q
+		rows(0b110, 0b101, 0b110, 0b101, 0b101),	// R
+		rows(0b011, 0b100, 0b010, 0b001, 0b110),	// S
+		rows(0b111, 0b010, 0b010, 0b010, 0b010),	// T
+		rows(0b101, 0b101, 0b101, 0b101, 0b111),	// U
+		rows(0b101, 0b101, 0b101, 0b101, 0b010),	// V
+		rows(0b101, 0b101, 0b111, 0b111, 0b101),	// W
+		rows(0b101, 0b101, 0b010, 0b101, 0b101),	// X
+		rows(0b101, 0b101, 0b010, 0b010, 0b010),	// Y
+		rows(0b111, 0b001, 0b010, 0b100, 0b111),	// Z
+		rows(0b110, 0b100, 0b100, 0b100, 0b110),	// [
+		rows(0b100, 0b100, 0b010, 0b001, 0b001),	// '\'
+		rows(0b011, 0b001, 0b001, 0b001, 0b011),	// ]
+		rows(0b010, 0b101, 0b000, 0b000, 0b000),	// ^
+		rows(0b000, 0b000, 0b000, 0b000, 0b111),	// _
+	};
+
+	// Panel layout in font pixels
+	constexpr int PAD = 2;
+	constexpr int GRAPH_Y = PAD + Tiny_font::LINE_HEIGHT + 1;
+	constexpr int GRAPH_HEIGHT = 24;
+	constexpr int TEXT_Y = GRAPH_Y + GRAPH_HEIGHT + 2;
+
+	constexpr uint16_t PANEL_COLOR = 0x0000;
+	constexpr uint16_t TEXT_COLOR = 0xFFFF;
+	constexpr uint16_t LABEL_COLOR = 0x8410;
+	constexpr uint16_t TRANSFER_COLOR = 0x07FF;
+	constexpr uint16_t BUDGET_COLOR = 0x8410;
+	constexpr uint16_t FAST_COLOR = 0x07E0;
+	constexpr uint16_t SLOW_COLOR = 0xFFE0;
+	constexpr uint16_t LATE_COLOR = 0xF800;
+
+	// The display transfer, shown first
+#ifdef PLATFORM_DESKTOP
+	constexpr const char* TRANSFER_ZONE = "present";
+#else
+	constexpr const char* TRANSFER_ZONE = "flush";
+#endif
+
+	// snprintf without floats: the Pico formats a refresh in a few microseconds
+	class Line_writer {
+	public:
+		Line_writer(char* line, int columns) : out(line), capacity(columns) { out[0] = '\0'; }
+
+		// Left aligned, cut or padded to width when width > 0
+		void text(const char* text, int width = 0) {
+			int written = 0;
+			for (; text[written] && (width == 0 || written < width); written++) put(text[written]);
+			for (; written < width; written++) put(' ');
+		}
+
+		// thousandths as "12.34" with the given decimals, right aligned to width
+		void fixed(uint64_t thousandths, int decimals, int width = 0) {
+			uint64_t divisor = 1;
+			for (int i = decimals; i < 3; i++) divisor *= 10;
+			uint64_t value = (thousandths + divisor / 2) / divisor;
+			char digits[24];
+			int count = 0;
+			for (int i = 0; i < decimals; i++, value /= 10) digits[count++] = static_cast<char>('0' + value % 10);
+			if (decimals > 0) digits[count++] = '.';
+			do {
+				digits[count++] = static_cast<char>('0' + value % 10);
+				value /= 10;
+			} while (value > 0);
+			for (int i = count; i < width; i++) put(' ');
+			while (count > 0) put(digits[--count]);
+		}
+
+		// Bytes as "512B", "12.3K", "45.2M"
+		void bytes(uint64_t bytes) {
+			if (bytes < 1024) {
+				fixed(bytes * 1000, 0);
+				put('B');
+			} else if (bytes < 1024 * 1024) {
+				fixed(bytes * 1000 / 1024, bytes < 100 * 1024 ? 1 : 0);
+				put('K');
+			} else {
+				fixed(bytes * 1000 / (1024 * 1024), 1);
+				put('M');
+			}
+		}
+
+	private:
+		char* out;
+		int capacity;
+		int length = 0;
+
+		void put(char c) {
+			if (length == capacity) return;
+			out[length++] = c;
+			out[length] = '\0';
+		}
+	};
+
+#ifndef PLATFORM_DESKTOP
+	constexpr uint32_t STACK_PAINT = 0xC5A5C5A5;
+
+	// Fills the free part of the core 0 stack, everything below the caller's frame
+	void paint_stack() {
+		if (get_core_num() != 0) return;
+		uint32_t* stack_pointer;
+		__asm volatile ("mov %0, sp" : "=r"(stack_pointer));
+		for (uint32_t* word = reinterpret_cast<uint32_t*>(&__StackBottom); word < stack_pointer - 16; word++) {
+			*word = STACK_PAINT;
+		}
+	}
+
+	// Deepest the stack got since paint_stack(): the lowest word no longer holding the paint
+	uint32_t stack_high_water() {
+		const uint32_t* word = reinterpret_cast<const uint32_t*>(&__StackBottom);
+		const uint32_t* top = reinterpret_cast<const uint32_t*>(&__StackTop);
+		while (word < top && *word == STACK_PAINT) word++;
+		return static_cast<uint32_t>(top - word) * sizeof(uint32_t);
+	}
+#endif
+}
+
+uint16_t Tiny_font::glyph(char c) {
+	if (c >= 'a' && c <= 'z') c = static_cast<char>(c - 'a' + 'A');
+	if (c < ' ' || c > '_') c = '?';
+	return GLYPHS[c - ' '];
+}
+
+int Tiny_font::draw_text(int x, int y, const char* text, uint16_t color, int scale) {
+
+	const int start = x;
+	for (const char* c = text; *c; c++, x += ADVANCE * scale) {
+		if (*c == ' ') continue;
+		const uint16_t bits = glyph(*c);
+		const bool inside = x >= 0 && y >= 0 && x + GLYPH_WIDTH * scale <= DISPLAY_WIDTH && y + GLYPH_HEIGHT * scale <= DISPLAY_HEIGHT;
+		for (int row = 0; row < GLYPH_HEIGHT; row++) {
+			for (int column = 0; column < GLYPH_WIDTH; column++) {
+				if (!(bits & (0x4000 >> (row * GLYPH_WIDTH + column)))) continue;
+				if (inside && scale == 1) {
+					Framebuffer::back_buffer[(y + row) * DISPLAY_WIDTH + x + column] = color;
+				} else {
+					Framebuffer::draw_rectangle(y + row * scale, scale, x + column * scale, scale, color);
+				}
+			}
+		}
+	}
+	return x - start;
+}
+
+Perf_hud::Perf_hud(int scale, int x, int y) : scale(std::max(scale, 1)), origin_x(x), origin_y(y) {
+#ifndef PLATFORM_DESKTOP
+	paint_stack();
+#endif
+}
+
+int Perf_hud::width() const {
+	return (PAD * 2 + TEXT_COLUMNS * Tiny_font::ADVANCE) * scale;
+}
+
+int Perf_hud::height() const {
+	return (TEXT_Y + (TEXT_LINES - 1) * Tiny_font::LINE_HEIGHT - 1 + PAD) * scale;
+}
+
+void Perf_hud::set_visible(bool visible) {
+	// Refresh on the first visible frame, the lines are stale
+	if (visible && !shown) frames_to_refresh = 0;
+	shown = visible;
+}
+
+void Perf_hud::frame(bool toggle_combo) {
+
+	const Profiler::Ticks now = Profiler::now();
+	if (timing) {
+		newest = (newest + 1) % GRAPH_SAMPLES;
+		frame_us[newest] = static_cast<uint32_t>((now - last_frame) / Profiler::TICKS_PER_US);
+		samples = std::min(samples + 1, GRAPH_SAMPLES);
+	}
+	timing = true;
+	last_frame = now;
+
+	if (toggle_combo && !combo_down) set_visible(!shown);
+	combo_down = toggle_combo;
+	if (!shown) return;
+
+	PROFILE_ZONE("hud");
+	if (--frames_to_refresh <= 0) {
+		refresh();
+		frames_to_refresh = REFRESH_FRAMES;
+	}
+	draw();
+}
+
+void Perf_hud::refresh() {
+
+	uint64_t total_us = 0;
+	uint32_t max_us = 0;
+	for (int i = 0; i < samples; i++) {
+		const uint32_t us = frame_us[(newest - i + GRAPH_SAMPLES) % GRAPH_SAMPLES];
+		total_us += us;
+		max_us = std::max(max_us, us);
+	}
+	Line_writer frame_line(lines[0], TEXT_COLUMNS);
+	if (samples > 0 && total_us > 0) {
+		frame_line.fixed(total_us / samples, 2);
+		frame_line.text(" MS  ");
+		frame_line.fixed(uint64_t(samples) * 1000000 * 1000 / total_us, 0);
+		frame_line.text(" FPS  MAX ");
+		frame_line.fixed(max_us, 2);
+	}
+
+	Line_writer header(lines[1], TEXT_COLUMNS);
+	header.text("ZONE", 10);
+	header.text("  AVG MS  MAX MS");
+
+	// The transfer first, then the largest totals; "frame" is the graph already
+	Profiler::Zone_stats zones[Profiler::MAX_TOTALS_ZONES];
+	const uint32_t zone_count = Profiler::zone_totals(zones, Profiler::MAX_TOTALS_ZONES);
+	Profiler::clear();
+	int line = 2;
+	for (int pass = 0; pass < 2; pass++) {
+		for (uint32_t i = 0; i < zone_count && line < 2 + ZONE_LINES; i++) {
+			const bool transfer = strcmp(zones[i].name, TRANSFER_ZONE) == 0;
+			if (transfer != (pass == 0) || strcmp(zones[i].name, "frame") == 0) continue;
+			Line_writer zone_line(lines[line++], TEXT_COLUMNS);
+			zone_line.text(zones[i].name, 10);
+			zone_line.fixed(static_cast<uint64_t>(zones[i].avg_us), 2, 8);
+			zone_line.fixed(static_cast<uint64_t>(zones[i].max_us), 2, 8);
+		}
+	}
+	for (; line < 2 + ZONE_LINES; line++) lines[line][0] = '\0';
+
+	Line_writer memory(lines[TEXT_LINES - 1], TEXT_COLUMNS);
+#ifdef PLATFORM_DESKTOP
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) == 0) {
+		memory.text("PEAK RSS ");
+	#ifdef __APPLE__
+		memory.bytes(static_cast<uint64_t>(usage.ru_maxrss));
+	#else
+		memory.bytes(static_cast<uint64_t>(usage.ru_maxrss) * 1024);
+	#endif
+	}
+#else
+	// The arena only grows: what sbrk handed out is the heap high-water
+	memory.text("HEAP ");
+	memory.bytes(mallinfo().arena);
+	memory.text("/");
+	memory.bytes(static_cast<uint64_t>(&__StackLimit - &end));
+	memory.text(" STK ");
+	memory.bytes(stack_high_water());
+	memory.text("/");
+	memory.bytes(static_cast<uint64_t>(&__StackTop - &__StackBottom));
+#endif
+}
+
+void Perf_hud::draw() const {
+
+	auto rectangle = [this](int x, int y, int w, int h, uint16_t color) {
+		Framebuffer::draw_rectangle(origin_y + y * scale, h * scale, origin_x + x * scale, w * scale, color);
+	};
+	auto text = [this](int line_y, const char* line, uint16_t color) {
+		Tiny_font::draw_text(origin_x + PAD * scale, origin_y + line_y * scale, line, color, scale);
+	};
+
+	// Row copies, the panel is most of the pixels
+	Framebuffer::draw_rectangle_memset(origin_y, height(), origin_x, width(), PANEL_COLOR);
+	text(PAD, lines[0], TEXT_COLOR);
+
+	// Oldest sample on the left, full height is twice the budget
+	for (int i = 0; i < samples; i++) {
+		const uint32_t us = frame_us[(newest - samples + 1 + i + GRAPH_SAMPLES) % GRAPH_SAMPLES];
+		const int bar = static_cast<int>(std::min<uint64_t>(uint64_t(us) * GRAPH_HEIGHT / (2 * FRAME_BUDGET_US), GRAPH_HEIGHT));
+		const uint16_t color = us <= FRAME_BUDGET_US ? FAST_COLOR : us <= 2 * FRAME_BUDGET_US ? SLOW_COLOR : LATE_COLOR;
+		const int x = PAD + (GRAPH_SAMPLES - samples + i) * 2;
+		if (bar > 0) rectangle(x, GRAPH_Y + GRAPH_HEIGHT - bar, 2, bar, color);
+	}
+	rectangle(PAD, GRAPH_Y + GRAPH_HEIGHT / 2, GRAPH_SAMPLES * 2, 1, BUDGET_COLOR);
+
+	text(TEXT_Y, lines[1], LABEL_COLOR);
+	for (int line = 2; line < TEXT_LINES; line++) {
+		const bool transfer = line == 2 && strncmp(lines[line], TRANSFER_ZONE, strlen(TRANSFER_ZONE)) == 0;
+		text(TEXT_Y + (line - 1) * Tiny_font::LINE_HEIGHT, lines[line], transfer ? TRANSFER_COLOR : TEXT_COLOR);
+	}
+}
@@ -0,0 +1,98 @@
+#ifndef PERF_HUD_H
+#define PERF_HUD_H
+
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include "platform_desktop.h"
+#else
+    #include "pico/stdlib.h"
+    #include "display.h"
+#endif
+#include "profiler.h"
+
+// On-screen performance overlay, drawn into the back buffer on top of the finished scene:
+// frame time graph, per-zone profiler timings (the display transfer first), memory high-water
+// marks. Hidden until the toggle combo is pressed, a hidden HUD costs one clock read per frame.
+//
+//     Perf_hud hud;
+//     while (true) {
+//         ... scene ...
+//         ButtonState buttons = Buttons::button_polling();
+//         hud.frame(buttons.w && buttons.s);            // up + down together toggles it
+//         swap_buffers();
+//         send_to_display();
+//     }
+//
+// Frame times are the time between two frame() calls, so they include the flush. The zone
+// lines are refreshed every REFRESH_FRAMES frames from Profiler::zone_totals(), followed by
+// Profiler::clear(): while the HUD is visible it owns the profiler window, print_stats() then
+// covers the frames since the last refresh only.
+//
+// Memory: heap high-water (newlib arena) and core 0 stack high-water on the Pico. The stack is
+// painted with a pattern by the constructor and scanned for the deepest overwritten word, so
+// build the HUD early, from the main loop function. Desktop shows the peak resident set.
+//
+// The text uses Tiny_font, a 3x5 pixel font also usable for other debug output.
+
+namespace Tiny_font {
+
+	constexpr int GLYPH_WIDTH = 3;
+	constexpr int GLYPH_HEIGHT = 5;
+	constexpr int ADVANCE = 4;			// glyph and one column of space
+	constexpr int LINE_HEIGHT = 6;
+
+	// Rows top to bottom, 3 bits each, first row in bits 14..12, left column the high bit.
+	// Lowercase draws as uppercase, characters without a glyph as '?'.
+	uint16_t glyph(char c);
+
+	// Glyph pixels only, the background is left alone. Clipped to the screen, scale >= 1
+	// repeats every font pixel. Returns the width the text advanced.
+	int draw_text(int x, int y, const char* text, uint16_t color, int scale = 1);
+};
+
+class Perf_hud {
+public:
+	// Frame samples in the graph, two pixels each
+	static constexpr int GRAPH_SAMPLES = 56;
+	// A bar reaching the line above the graph middle is over budget (60 fps)
+	static constexpr uint32_t FRAME_BUDGET_US = 16667;
+	static constexpr int REFRESH_FRAMES = 30;
+	// Font pixels grow on big desktop windows so the text stays readable
+	static constexpr int DEFAULT_SCALE = DISPLAY_WIDTH / 320 > 1 ? DISPLAY_WIDTH / 320 : 1;
+
+	explicit Perf_hud(int scale = DEFAULT_SCALE, int x = 0, int y = 0);
+
+	// Once per frame, after the scene and before swap_buffers(). toggle_combo is the current
+	// state of the combo, the HUD flips on the press, not while it is held.
+	void frame(bool toggle_combo);
+
+	bool visible() const { return shown; }
+	void set_visible(bool visible);
+
+	// Panel size on screen, in display pixels
+	int width() const;
+	int height() const;
+
+private:
+	static constexpr int TEXT_COLUMNS = 28;
+	static constexpr int ZONE_LINES = 5;
+	static constexpr int TEXT_LINES = ZONE_LINES + 3;		// frame, zone header, zones, memory
+
+	int scale;
+	int origin_x;
+	int origin_y;
+	bool shown = false;
+	bool combo_down = false;
+	bool timing = false;						// last_frame is set
+	Profiler::Ticks last_frame = 0;
+	uint32_t frame_us[GRAPH_SAMPLES] = {};
+	int newest = 0;
+	int samples = 0;
+	int frames_to_refresh = 0;
+	char lines[TEXT_LINES][TEXT_COLUMNS + 1] = {};
+
+	void refresh();
+	void draw() const;
+};
+
+#endif
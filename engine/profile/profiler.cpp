@@ -0,0 +1,247 @@
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstdio>
+    #include <cstring>
+#else
+    #include "pico/stdlib.h"
+    #include "stdio.h"
+    #include "cstring"
+#endif
+#include <algorithm>
+#include <atomic>
+#include <type_traits>
+#include <vector>
+
+#include "profiler.h"
+
+using namespace Profiler;
+
+namespace {
+
+	constexpr uint32_t RING_MASK = PROFILE_RING_SIZE - 1;
+
+	struct Ring {
+		Event events[PROFILE_RING_SIZE];
+		std::atomic<uint32_t> head{0};		// events written, stored by the owner only
+		uint32_t first = 0;					// reader side: clear() moved the window here
+	};
+
+#ifdef PLATFORM_DESKTOP
+	// Allocated by the first record() of a thread, kept until exit (a trace can outlive it)
+	std::atomic<Ring*> rings[MAX_THREADS];
+	std::atomic<uint32_t> ring_count{0};
+	thread_local Ring* local_ring = nullptr;
+	thread_local bool local_registered = false;
+
+	Ring* thread_ring() {
+		if (local_registered) return local_ring;
+		local_registered = true;
+		uint32_t index = ring_count.fetch_add(1);
+		if (index >= MAX_THREADS) {
+			printf("[ERROR] profiler: more than %u threads, zones of the others are dropped\n", static_cast<unsigned>(MAX_THREADS));
+			return nullptr;
+		}
+		local_ring = new Ring();
+		rings[index].store(local_ring, std::memory_order_release);
+		return local_ring;
+	}
+
+	Ring* ring_at(uint32_t index) {
+		return rings[index].load(std::memory_order_acquire);
+	}
+#else
+	// One per core, the core is the thread
+	Ring rings[MAX_THREADS];
+
+	Ring* thread_ring() {
+		return &rings[get_core_num()];
+	}
+
+	Ring* ring_at(uint32_t index) {
+		return &rings[index];
+	}
+#endif
+
+	// Visits the events in the window of every ring, oldest first per ring
+	template<typename Visit>
+	void for_each_event(Visit&& visit) {
+		for (uint32_t thread = 0; thread < MAX_THREADS; thread++) {
+			Ring* ring = ring_at(thread);
+			if (!ring) continue;
+			const uint32_t head = ring->head.load(std::memory_order_acquire);
+			const uint32_t count = std::min<uint32_t>(head - ring->first, PROFILE_RING_SIZE);
+			for (uint32_t i = head - count; i != head; i++) visit(thread, ring->events[i & RING_MASK]);
+		}
+	}
+
+	float to_us(Ticks ticks) {
+		return static_cast<float>(ticks) / TICKS_PER_US;
+	}
+}
+
+void Profiler::record(const char* name, Ticks start, Ticks end) {
+
+	Ring* ring = thread_ring();
+	if (!ring) return;
+	const uint32_t head = ring->head.load(std::memory_order_relaxed);
+	ring->events[head & RING_MASK] = {name, start, end};
+	ring->head.store(head + 1, std::memory_order_release);
+}
+
+uint32_t Profiler::event_count() {
+	uint32_t count = 0;
+	for_each_event([&](uint32_t, const Event&) { count++; });
+	return count;
+}
+
+uint32_t Profiler::zone_stats(Zone_stats* out, uint32_t max_zones) {
+
+	// Zone names by address, merged by text when two translation units each have a copy
+	struct Sample {
+		uint32_t zone;
+		Ticks duration;
+	};
+	std::vector<const char*> names;
+	std::vector<Sample> samples;
+	samples.reserve(event_count());
+	for_each_event([&](uint32_t, const Event& event) {
+		uint32_t zone = 0;
+		while (zone < names.size() && names[zone] != event.name && strcmp(names[zone], event.name) != 0) zone++;
+		if (zone == names.size()) names.push_back(event.name);
+		samples.push_back({zone, static_cast<Ticks>(event.end - event.start)});
+	});
+
+	std::sort(samples.begin(), samples.end(), [](const Sample& a, const Sample& b) {
+		return a.zone != b.zone ? a.zone < b.zone : a.duration < b.duration;
+	});
+	std::vector<Zone_stats> zones;
+	for (size_t begin = 0; begin < samples.size();) {
+		size_t end = begin;
+		uint64_t total = 0;
+		while (end < samples.size() && samples[end].zone == samples[begin].zone) total += samples[end++].duration;
+		const uint32_t count = static_cast<uint32_t>(end - begin);
+		// Nearest rank: the smallest duration that at least 99% of the samples do not exceed
+		const size_t p99 = begin + (count * 99 + 99) / 100 - 1;
+		zones.push_back({names[samples[begin].zone], count, to_us(total), to_us(samples[begin].duration),
+			to_us(total) / count, to_us(samples[end - 1].duration), to_us(samples[p99].duration)});
+		begin = end;
+	}
+
+	std::sort(zones.begin(), zones.end(), [](const Zone_stats& a, const Zone_stats& b) { return a.total_us > b.total_us; });
+	std::copy_n(zones.begin(), std::min<size_t>(zones.size(), max_zones), out);
+	return static_cast<uint32_t>(zones.size());
+}
+
+uint32_t Profiler::zone_totals(Zone_stats* out, uint32_t max_zones) {
+
+	// Integer sums, float math per event is slow without an FPU
+	struct Totals {
+		const char* name;
+		uint32_t count;
+		Ticks total;
+		Ticks min;
+		Ticks max;
+	};
+	Totals totals[MAX_TOTALS_ZONES];
+	const uint32_t limit = std::min(max_zones, MAX_TOTALS_ZONES);
+	uint32_t zones = 0;
+	for_each_event([&](uint32_t, const Event& event) {
+		uint32_t zone = 0;
+		while (zone < zones && totals[zone].name != event.name && strcmp(totals[zone].name, event.name) != 0) zone++;
+		const Ticks duration = event.end - event.start;
+		if (zone == zones) {
+			if (zones == limit) return;
+			totals[zones++] = {event.name, 0, 0, duration, duration};
+		}
+		Totals& entry = totals[zone];
+		entry.count++;
+		entry.total += duration;
+		entry.min = std::min(entry.min, duration);
+		entry.max = std::max(entry.max, duration);
+	});
+
+	// Largest total first, a handful of entries
+	for (uint32_t i = 0; i < zones; i++) {
+		const Totals& entry = totals[i];
+		Zone_stats stats = {entry.name, entry.count, to_us(entry.total), to_us(entry.min),
+			to_us(entry.total) / entry.count, to_us(entry.max), to_us(entry.max)};
+		uint32_t slot = i;
+		for (; slot > 0 && out[slot - 1].total_us < stats.total_us; slot--) out[slot] = out[slot - 1];
+		out[slot] = stats;
+	}
+	return zones;
+}
+
+void Profiler::print_stats() {
+
+	Zone_stats zones[32];
+	uint32_t count = zone_stats(zones, 32);
+	printf("%-20s %7s %10s %10s %10s %10s %12s\n", "zone", "count", "min us", "avg us", "max us", "p99 us", "total us");
+	for (uint32_t i = 0; i < std::min<uint32_t>(count, 32); i++) {
+		const Zone_stats& zone = zones[i];
+		printf("%-20s %7u %10.1f %10.1f %10.1f %10.1f %12.0f\n", zone.name, static_cast<unsigned>(zone.count),
+			zone.min_us, zone.avg_us, zone.max_us, zone.p99_us, zone.total_us);
+	}
+	if (count > 32) printf("(%u more zones)\n", static_cast<unsigned>(count - 32));
+}
+
+bool Profiler::write_chrome_trace(FILE* out) {
+
+	// Timestamps from the oldest event, a float microsecond count keeps its precision
+	bool any = false;
+	Ticks base = 0;
+	for_each_event([&](uint32_t, const Event& event) {
+		// Signed difference: the Pico clock wraps
+		if (!any || static_cast<std::make_signed_t<Ticks>>(event.start - base) < 0) base = event.start;
+		any = true;
+	});
+
+	fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	bool first = true;
+	for (uint32_t thread = 0; thread < MAX_THREADS; thread++) {
+		if (!ring_at(thread)) continue;
+#ifdef PLATFORM_DESKTOP
+		fprintf(out, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"thread %u\"}}",
+			first ? "" : ",\n", static_cast<unsigned>(thread), static_cast<unsigned>(thread));
+#else
+		fprintf(out, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"core %u\"}}",
+			first ? "" : ",\n", static_cast<unsigned>(thread), static_cast<unsigned>(thread));
+#endif
+		first = false;
+	}
+	for_each_event([&](uint32_t thread, const Event& event) {
+		// Names are literals from the code, only quotes and backslashes need escaping
+		fprintf(out, ",\n{\"name\":\"");
+		for (const char* c = event.name; *c; c++) {
+			if (*c == '"' || *c == '\\') fputc('\\', out);
+			fputc(*c, out);
+		}
+		fprintf(out, "\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", static_cast<unsigned>(thread),
+			static_cast<double>(static_cast<Ticks>(event.start - base)) / TICKS_PER_US,
+			static_cast<double>(static_cast<Ticks>(event.end - event.start)) / TICKS_PER_US);
+	});
+	fprintf(out, "\n]}\n");
+	return !ferror(out);
+}
+
+#ifdef PLATFORM_DESKTOP
+bool Profiler::save_chrome_trace(const char* path) {
+
+	FILE* file = fopen(path, "w");
+	if (!file) {
+		printf("[ERROR] profiler: cannot create %s\n", path);
+		return false;
+	}
+	bool ok = write_chrome_trace(file);
+	ok = (fclose(file) == 0) && ok;
+	if (!ok) printf("[ERROR] profiler: cannot write %s\n", path);
+	return ok;
+}
+#endif
+
+void Profiler::clear() {
+	for (uint32_t thread = 0; thread < MAX_THREADS; thread++) {
+		Ring* ring = ring_at(thread);
+		if (ring) ring->first = ring->head.load(std::memory_order_acquire);
+	}
+}
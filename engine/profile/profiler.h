@@ -0,0 +1,130 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstdio>
+    #include <chrono>
+#else
+    #include "pico/stdlib.h"
+    #include "stdio.h"
+#endif
+
+// Where the frame time goes: PROFILE_ZONE("render") at the top of a block records the time
+// until the end of the block. Events go into a ring per thread (per core on the Pico), the
+// owner thread is the only writer, so recording takes no lock and never allocates: a zone
+// is two clock reads and one 12 / 24 byte store. When the ring is full the oldest events are
+// overwritten, stats and traces always cover the last PROFILE_RING_SIZE events per thread.
+//
+//     void update() {
+//         PROFILE_ZONE("update");
+//         { PROFILE_ZONE("logic"); ... }
+//         { PROFILE_ZONE("render"); ... }
+//     }
+//     ...
+//     Profiler::print_stats();                           // min / avg / max / p99 per zone
+//     Profiler::save_chrome_trace("trace.json");         // chrome://tracing, ui.perfetto.dev
+//
+// Clocks: steady_clock nanoseconds on desktop (rdtsc is not portable to arm64 macOS and
+// needs calibrating), time_us_32() microseconds on the Pico (the Cortex-M0+ has no DWT cycle
+// counter). Zones shorter than a microsecond show as 0 on the Pico.
+//
+// Stats and traces read the rings of the other threads while they may still record: call
+// them between frames, or accept that the oldest event of a busy thread can be torn.
+// -DPROFILE_ENABLED=0 compiles every PROFILE_ZONE out.
+
+#ifndef PROFILE_ENABLED
+	#define PROFILE_ENABLED 1
+#endif
+// Events per thread / core, power of two
+#ifndef PROFILE_RING_SIZE
+	#ifdef PLATFORM_DESKTOP
+		#define PROFILE_RING_SIZE 16384
+	#else
+		#define PROFILE_RING_SIZE 256
+	#endif
+#endif
+
+namespace Profiler {
+
+#ifdef PLATFORM_DESKTOP
+	using Ticks = uint64_t;
+	constexpr uint32_t TICKS_PER_US = 1000;
+	// Threads that can record, later ones are ignored
+	constexpr uint32_t MAX_THREADS = 16;
+
+	inline Ticks now() {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+#else
+	using Ticks = uint32_t;			// wraps after 71 minutes, durations stay right
+	constexpr uint32_t TICKS_PER_US = 1;
+	constexpr uint32_t MAX_THREADS = 2;
+
+	inline Ticks now() {
+		return time_us_32();
+	}
+#endif
+	static_assert((PROFILE_RING_SIZE & (PROFILE_RING_SIZE - 1)) == 0, "PROFILE_RING_SIZE must be a power of two");
+
+	struct Event {
+		const char* name;			// string literal, compared by address first
+		Ticks start;
+		Ticks end;
+	};
+
+	struct Zone_stats {
+		const char* name;
+		uint32_t count;
+		float total_us;
+		float min_us;
+		float avg_us;
+		float max_us;
+		float p99_us;
+	};
+
+	// What PROFILE_ZONE records, also for spans that are not a block (DMA start to done)
+	void record(const char* name, Ticks start, Ticks end);
+
+	// Events in the rings of every thread
+	uint32_t event_count();
+	// One entry per zone name over the events in the rings, largest total first. Returns the
+	// zones found, out gets the first max_zones of them.
+	uint32_t zone_stats(Zone_stats* out, uint32_t max_zones);
+	// zone_stats for every frame: one pass, no sort and no allocation, p99_us is max_us.
+	// Zones past the first max_zones names met (at most MAX_TOTALS_ZONES) are left out.
+	constexpr uint32_t MAX_TOTALS_ZONES = 16;
+	uint32_t zone_totals(Zone_stats* out, uint32_t max_zones);
+	void print_stats();
+
+	// Chrome trace event JSON (complete "X" events, one track per thread / core)
+	bool write_chrome_trace(FILE* out);
+#ifdef PLATFORM_DESKTOP
+	bool save_chrome_trace(const char* path);
+#endif
+
+	// Starts a new window: stats and traces ignore everything recorded before
+	void clear();
+
+	class Zone {
+	public:
+		explicit Zone(const char* zone_name) : name(zone_name), start(now()) {}
+		~Zone() { record(name, start, now()); }
+		Zone(const Zone&) = delete;
+		Zone& operator=(const Zone&) = delete;
+
+	private:
+		const char* name;
+		Ticks start;
+	};
+};
+
+#if PROFILE_ENABLED
+	#define PROFILE_ZONE_JOIN(a, b) a##b
+	#define PROFILE_ZONE_VARIABLE(line) PROFILE_ZONE_JOIN(profile_zone_, line)
+	#define PROFILE_ZONE(name) Profiler::Zone PROFILE_ZONE_VARIABLE(__LINE__)(name)
+#else
+	#define PROFILE_ZONE(name) ((void)0)
+#endif
+
+#endif
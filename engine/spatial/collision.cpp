@@ -0,0 +1,199 @@
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdio>
+#else
+    #include "pico/stdlib.h"
+    #include "stdio.h"
+#endif
+#include <algorithm>
+
+#include "collision.h"
+
+using namespace Collision;
+
+Vec2_q16 Collision::diamond_axis(const Shape& diamond) {
+	// Edge from (half_w, 0) to (0, half_h), its outward normal is (half_h, half_w)
+	return Fixed_math::normalize(Vec2_q16{diamond.half_h, diamond.half_w});
+}
+
+namespace {
+
+	// Half length of the shape projected on the unit axis (ax, ay), both >= 0
+	Fixed_q16 project_radius(const Shape& s, Fixed_q16 ax, Fixed_q16 ay) {
+		Fixed_q16 rx = s.half_w * ax;
+		Fixed_q16 ry = s.half_h * ay;
+		if (s.type == Shape_type::box) return rx + ry;
+		return rx > ry ? rx : ry;
+	}
+
+	// One SAT axis. Keeps the axis with the smallest overlap (first one wins a tie,
+	// axes are always tested in the same order so the result is deterministic).
+	bool test_axis(const Shape& a, const Shape& b, Fixed_q16 nx, Fixed_q16 ny, Contact& contact) {
+		Fixed_q16 ax = abs(nx);
+		Fixed_q16 ay = abs(ny);
+		Fixed_q16 distance = (b.x - a.x) * nx + (b.y - a.y) * ny;
+		Fixed_q16 overlap = project_radius(a, ax, ay) + project_radius(b, ax, ay) - abs(distance);
+		if (overlap <= 0) return false;
+
+		if (overlap < contact.depth) {
+			contact.depth = overlap;
+			contact.normal_x = distance < 0 ? -nx : nx;
+			contact.normal_y = distance < 0 ? -ny : ny;
+		}
+		return true;
+	}
+
+	bool collide_axes(const Shape& a, const Vec2_q16& axis_a, const Shape& b, const Vec2_q16& axis_b, Contact& contact) {
+
+		contact.depth = Fixed_q16::max();
+
+		// Box axes are shared by both shapes' bounding boxes
+		if (!test_axis(a, b, 1, 0, contact)) return false;
+		if (!test_axis(a, b, 0, 1, contact)) return false;
+
+		if (a.type == Shape_type::diamond) {
+			if (!test_axis(a, b, axis_a.x, axis_a.y, contact)) return false;
+			if (!test_axis(a, b, axis_a.x, -axis_a.y, contact)) return false;
+		}
+		if (b.type == Shape_type::diamond && (a.type != Shape_type::diamond || axis_a.x != axis_b.x || axis_a.y != axis_b.y)) {
+			if (!test_axis(a, b, axis_b.x, axis_b.y, contact)) return false;
+			if (!test_axis(a, b, axis_b.x, -axis_b.y, contact)) return false;
+		}
+		return true;
+	}
+}
+
+bool Collision::collide(const Shape& a, const Shape& b, Contact& contact) {
+
+	if (!overlap(a, b)) return false;
+	Vec2_q16 axis_a = a.type == Shape_type::diamond ? diamond_axis(a) : Vec2_q16{};
+	Vec2_q16 axis_b = b.type == Shape_type::diamond ? diamond_axis(b) : Vec2_q16{};
+	return collide_axes(a, axis_a, b, axis_b, contact);
+}
+
+void Collision_world::set(uint32_t id, const Shape& shape, bool is_static) {
+
+	if (id == NONE) {
+		printf("[ERROR] Collision_world: invalid id\n");
+		return;
+	}
+	Vec2_q16 axis = shape.type == Shape_type::diamond ? diamond_axis(shape) : Vec2_q16{};
+
+	if (contains(id)) {
+		Body& body = bodies[index_of[id]];
+		body.shape = shape;
+		body.axis = axis;
+		body.is_static = is_static;
+		return;
+	}
+
+	if (id >= index_of.size()) index_of.resize(id + 1, NONE);
+	index_of[id] = static_cast<uint32_t>(bodies.size());
+	order.push_back(static_cast<uint32_t>(bodies.size()));
+	bodies.push_back({id, shape, axis, is_static});
+}
+
+void Collision_world::move_to(uint32_t id, Fixed_q16 x, Fixed_q16 y) {
+
+	if (!contains(id)) return;
+	Body& body = bodies[index_of[id]];
+	body.shape.x = x;
+	body.shape.y = y;
+}
+
+void Collision_world::remove(uint32_t id) {
+
+	if (!contains(id)) return;
+
+	// Swap with the last body, then fix the sweep order (removed entry out, last index renamed)
+	uint32_t index = index_of[id];
+	uint32_t last = static_cast<uint32_t>(bodies.size() - 1);
+	bodies[index] = bodies[last];
+	index_of[bodies[index].id] = index;
+	bodies.pop_back();
+	index_of[id] = NONE;
+
+	size_t out = 0;
+	for (uint32_t i : order) {
+		if (i == index) continue;
+		order[out++] = (i == last) ? index : i;
+	}
+	order.resize(out);
+}
+
+void Collision_world::sort_order() {
+
+	// Insertion sort: bodies move a little per frame, so the order from the last
+	// step is almost sorted and this is close to O(n). Ties are broken by id.
+	for (size_t i = 1; i < order.size(); i++) {
+		uint32_t current = order[i];
+		const Body& body = bodies[current];
+		Fixed_q16 left = body.shape.left();
+		size_t j = i;
+		while (j > 0) {
+			const Body& previous = bodies[order[j - 1]];
+			Fixed_q16 previous_left = previous.shape.left();
+			if (previous_left < left || (previous_left == left && previous.id < body.id)) break;
+			order[j] = order[j - 1];
+			j--;
+		}
+		order[j] = current;
+	}
+}
+
+std::span<const Contact> Collision_world::step() {
+
+	contacts.clear();
+	pairs_tested = 0;
+	sort_order();
+
+	for (size_t i = 0; i < order.size(); i++) {
+		const Body& a = bodies[order[i]];
+		Fixed_q16 right = a.shape.right();
+
+		for (size_t j = i + 1; j < order.size(); j++) {
+			const Body& b = bodies[order[j]];
+			if (b.shape.left() >= right) break;				// nothing further right can overlap a
+			if (a.is_static && b.is_static) continue;
+			if (a.shape.top() >= b.shape.bottom() || b.shape.top() >= a.shape.bottom()) continue;
+
+			pairs_tested++;
+			// Always test with the lower id first so the normal has one canonical direction
+			const Body& first = a.id < b.id ? a : b;
+			const Body& second = a.id < b.id ? b : a;
+			Contact contact;
+			if (collide_axes(first.shape, first.axis, second.shape, second.axis, contact)) {
+				contact.a = first.id;
+				contact.b = second.id;
+				contacts.push_back(contact);
+			}
+		}
+	}
+
+	std::sort(contacts.begin(), contacts.end(), [](const Contact& l, const Contact& r) {
+		return l.a != r.a ? l.a < r.a : l.b < r.b;
+	});
+	return contacts;
+}
+
+void Collision_world::resolve() {
+
+	for (const Contact& contact : contacts) {
+		Body& a = bodies[index_of[contact.a]];
+		Body& b = bodies[index_of[contact.b]];
+		if (a.is_static && b.is_static) continue;
+
+		Fixed_q16 push = (a.is_static || b.is_static) ? contact.depth : (contact.depth >> 1);
+		Fixed_q16 push_x = contact.normal_x * push;
+		Fixed_q16 push_y = contact.normal_y * push;
+		if (!a.is_static) {
+			a.shape.x -= push_x;
+			a.shape.y -= push_y;
+		}
+		if (!b.is_static) {
+			b.shape.x += push_x;
+			b.shape.y += push_y;
+		}
+	}
+}
@@ -0,0 +1,115 @@
+#ifndef COLLISION_H
+#define COLLISION_H
+
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+#else
+    #include "pico/stdlib.h"
+#endif
+#include <vector>
+#include <span>
+#include "engine/math/fixed_point.h"
+#include "engine/math/fixed_math.h"
+
+// 2D collision in Fixed_q16, integer math only: same input gives the same contacts
+// (same order, same bits) on desktop and MCU.
+//
+// Shapes are center + half extents:
+//  box     - axis aligned rectangle
+//  diamond - iso tile outline, |dx| / half_w + |dy| / half_h <= 1 (half_w = 2 * half_h for 2:1 tiles)
+// Narrowphase is SAT on the shape axes, broadphase is sweep and prune on x.
+
+namespace Collision {
+
+	enum class Shape_type : uint8_t { box, diamond };
+
+	struct Shape {
+		Shape_type type = Shape_type::box;
+		Fixed_q16 x = 0;
+		Fixed_q16 y = 0;
+		Fixed_q16 half_w = 0;
+		Fixed_q16 half_h = 0;
+
+		static Shape box(Fixed_q16 left, Fixed_q16 top, Fixed_q16 width, Fixed_q16 height) {
+			Fixed_q16 half_w = width >> 1;
+			Fixed_q16 half_h = height >> 1;
+			return {Shape_type::box, left + half_w, top + half_h, half_w, half_h};
+		}
+		static Shape diamond(Fixed_q16 center_x, Fixed_q16 center_y, Fixed_q16 half_w, Fixed_q16 half_h) {
+			return {Shape_type::diamond, center_x, center_y, half_w, half_h};
+		}
+
+		Fixed_q16 left() const { return x - half_w; }
+		Fixed_q16 right() const { return x + half_w; }
+		Fixed_q16 top() const { return y - half_h; }
+		Fixed_q16 bottom() const { return y + half_h; }
+	};
+
+	// normal is a unit vector pointing from a to b, depth is how far b has to move along it
+	struct Contact {
+		uint32_t a = 0;
+		uint32_t b = 0;
+		Fixed_q16 normal_x = 0;
+		Fixed_q16 normal_y = 0;
+		Fixed_q16 depth = 0;
+	};
+
+	// Bounding boxes overlap (touching edges do not count)
+	inline bool overlap(const Shape& a, const Shape& b) {
+		return a.left() < b.right() && b.left() < a.right() && a.top() < b.bottom() && b.top() < a.bottom();
+	}
+
+	// Unit normal of the diamond edge in the (+x, +y) quadrant, the other edge is (x, -y)
+	Vec2_q16 diamond_axis(const Shape& diamond);
+
+	// Exact test, fills contact.normal / depth (a and b ids are left to the caller)
+	bool collide(const Shape& a, const Shape& b, Contact& contact);
+
+	// Push a out of b (b static)
+	inline void separate(Shape& a, const Contact& contact) {
+		a.x -= contact.normal_x * contact.depth;
+		a.y -= contact.normal_y * contact.depth;
+	}
+}
+
+// Bodies by dense id (entity id / component index). step() runs the broadphase and the
+// narrowphase and returns contacts sorted by (a, b) with a < b; static pairs are skipped.
+class Collision_world {
+public:
+	void set(uint32_t id, const Collision::Shape& shape, bool is_static = false);
+	void move_to(uint32_t id, Fixed_q16 x, Fixed_q16 y);
+	void remove(uint32_t id);
+
+	bool contains(uint32_t id) const { return id < index_of.size() && index_of[id] != NONE; }
+	const Collision::Shape& shape(uint32_t id) const { return bodies[index_of[id]].shape; }
+	size_t size() const { return bodies.size(); }
+
+	std::span<const Collision::Contact> step();
+
+	// Moves dynamic bodies out of the contacts of the last step (split half/half between two dynamic bodies)
+	void resolve();
+
+	// Broadphase pairs tested in the last step
+	size_t pair_count() const { return pairs_tested; }
+
+private:
+	static constexpr uint32_t NONE = UINT32_MAX;
+
+	struct Body {
+		uint32_t id;
+		Collision::Shape shape;
+		Vec2_q16 axis;		// diamond only
+		bool is_static;
+	};
+
+	std::vector<Body> bodies;
+	std::vector<uint32_t> index_of;		// id -> index in bodies
+	std::vector<uint32_t> order;		// body indices sorted by left edge, kept between steps
+	std::vector<Collision::Contact> contacts;
+	size_t pairs_tested = 0;
+
+	void sort_order();
+};
+
+#endif
@@ -0,0 +1,443 @@
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdio>
+#else
+    #include "pico/stdlib.h"
+    #include "stdio.h"
+#endif
+
+#include "pathfinding.h"
+
+namespace {
+
+	// E, SE, S, SW, W, NW, N, NE - opposite direction is (d + 4) & 7
+	constexpr int DIR_X[8] = {1, 1, 0, -1, -1, -1, 0, 1};
+	constexpr int DIR_Y[8] = {0, 1, 1, 1, 0, -1, -1, -1};
+
+	constexpr uint32_t NONE = UINT32_MAX;
+
+	int sign(int v) { return (v > 0) - (v < 0); }
+	int abs_int(int v) { return v < 0 ? -v : v; }
+
+	// Exact cost of an obstacle free 8 direction move, also the A* heuristic
+	uint32_t octile(int x0, int y0, int x1, int y1) {
+		int dx = abs_int(x1 - x0);
+		int dy = abs_int(y1 - y0);
+		int high = dx > dy ? dx : dy;
+		int low = dx > dy ? dy : dx;
+		return Pathfinder::COST_STRAIGHT * high + (Pathfinder::COST_DIAGONAL - Pathfinder::COST_STRAIGHT) * low;
+	}
+
+	// Diagonal steps need both side tiles free
+	bool can_step(const Nav_grid& grid, int x, int y, int dx, int dy) {
+		if (!grid.is_tile_walkable(x + dx, y + dy)) return false;
+		if (dx != 0 && dy != 0) return grid.is_tile_walkable(x + dx, y) && grid.is_tile_walkable(x, y + dy);
+		return true;
+	}
+}
+
+/*
+	NAV GRID
+*/
+Nav_grid::Nav_grid(uint16_t width, uint16_t height) : w(width), h(height) {
+	uint32_t tiles = static_cast<uint32_t>(width) * height;
+	bits.assign((tiles + 31) / 32, 0xFFFFFFFFu);
+}
+
+void Nav_grid::set_walkable(int tile_x, int tile_y, bool walkable) {
+	if (tile_x < 0 || tile_y < 0 || tile_x >= w || tile_y >= h) {
+		printf("[ERROR] set_walkable: tile out of bound\n");
+		return;
+	}
+	uint32_t i = static_cast<uint32_t>(tile_y) * w + tile_x;
+	if (walkable) bits[i >> 5] |= 1u << (i & 31);
+	else bits[i >> 5] &= ~(1u << (i & 31));
+}
+
+/*
+	OPEN LIST
+*/
+bool Pathfinder::Open_list::push(uint32_t g, uint32_t h, uint32_t index) {
+
+	if (heap.size() >= capacity) return false;
+
+	// sift up
+	Open_node node = {g + h, static_cast<uint16_t>(h), static_cast<uint16_t>(index)};
+	size_t i = heap.size();
+	heap.push_back(node);
+	while (i > 0) {
+		size_t up = (i - 1) / 2;
+		if (!(node < heap[up])) break;
+		heap[i] = heap[up];
+		i = up;
+	}
+	heap[i] = node;
+	return true;
+}
+
+Pathfinder::Open_node Pathfinder::Open_list::pop() {
+
+	Open_node top = heap[0];
+	Open_node last = heap.back();
+	heap.pop_back();
+	if (heap.empty()) return top;
+
+	// sift down
+	size_t i = 0;
+	size_t size = heap.size();
+	while (true) {
+		size_t child = 2 * i + 1;
+		if (child >= size) break;
+		if (child + 1 < size && heap[child + 1] < heap[child]) child++;
+		if (!(heap[child] < last)) break;
+		heap[i] = heap[child];
+		i = child;
+	}
+	heap[i] = last;
+	return top;
+}
+
+/*
+	PATHFINDER
+*/
+Pathfinder::Pathfinder(uint16_t max_width, uint16_t max_height, uint32_t open_capacity) :
+	max_tiles(static_cast<uint32_t>(max_width) * max_height), open(open_capacity) {
+
+	if (max_tiles > 65536) {
+		printf("[ERROR] Pathfinder: map larger than 256x256 tiles\n");
+		max_tiles = 0;
+	}
+	g.assign(max_tiles, 0);
+	parent.assign(max_tiles, 0);
+	closed.assign((max_tiles + 31) / 32, 0);
+	seen.assign((max_tiles + 31) / 32, 0);
+}
+
+bool Pathfinder::begin(const Nav_grid& grid, Tile_point start, Tile_point goal) {
+
+	expanded = 0;
+	open.clear();
+	if (static_cast<uint32_t>(grid.width()) * grid.height() > max_tiles) return false;
+	if (!grid.is_tile_walkable(start.x, start.y) || !grid.is_tile_walkable(goal.x, goal.y)) return false;
+
+	uint32_t words = (static_cast<uint32_t>(grid.width()) * grid.height() + 31) / 32;
+	for (uint32_t i = 0; i < words; i++) {
+		closed[i] = 0;
+		seen[i] = 0;
+	}
+	return true;
+}
+
+// New or cheaper way to index: store it and queue it. False only when the open list is full.
+bool Pathfinder::relax(uint32_t index, uint32_t from, uint32_t cost, uint32_t h) {
+
+	if (test_bit(seen, index) && g[index] <= cost) return true;
+
+	set_bit(seen, index);
+	g[index] = cost;
+	parent[index] = static_cast<uint16_t>(from);
+	return open.push(cost, h, index);
+}
+
+void Pathfinder::build_path(const Nav_grid& grid, uint32_t goal_index, std::vector<Tile_point>& path) const {
+
+	// Parents are neighbours (A*) or jump points on a straight / diagonal line (JPS),
+	// walk the chain backwards and fill in the tiles between the points.
+	path.clear();
+	const int w = grid.width();
+	uint32_t index = goal_index;
+	int x = index % w;
+	int y = index / w;
+	path.push_back({static_cast<int16_t>(x), static_cast<int16_t>(y)});
+
+	while (index != origin) {
+		index = parent[index];
+		int px = index % w;
+		int py = index / w;
+		int dx = sign(px - x);
+		int dy = sign(py - y);
+		while (x != px || y != py) {
+			x += dx;
+			y += dy;
+			path.push_back({static_cast<int16_t>(x), static_cast<int16_t>(y)});
+		}
+	}
+
+	// reverse to start -> goal
+	for (size_t i = 0, j = path.size() - 1; i < j; i++, j--) {
+		Tile_point t = path[i];
+		path[i] = path[j];
+		path[j] = t;
+	}
+}
+
+Path_status Pathfinder::find_path(const Nav_grid& grid, Tile_point start, Tile_point goal, std::vector<Tile_point>& path) {
+
+	path.clear();
+	if (!begin(grid, start, goal)) return Path_status::invalid;
+
+	const int w = grid.width();
+	const uint32_t goal_index = static_cast<uint32_t>(goal.y) * w + goal.x;
+	const uint32_t start_index = static_cast<uint32_t>(start.y) * w + start.x;
+
+	set_bit(seen, start_index);
+	g[start_index] = 0;
+	origin = start_index;
+	open.push(0, octile(start.x, start.y, goal.x, goal.y), start_index);
+
+	while (!open.empty()) {
+		uint32_t index = open.pop().index;
+		if (test_bit(closed, index)) continue;		// stale duplicate (no decrease-key)
+		set_bit(closed, index);
+		expanded++;
+
+		if (index == goal_index) {
+			build_path(grid, goal_index, path);
+			return Path_status::found;
+		}
+
+		int x = index % w;
+		int y = index / w;
+		for (int d = 0; d < 8; d++) {
+			if (!can_step(grid, x, y, DIR_X[d], DIR_Y[d])) continue;
+			int nx = x + DIR_X[d];
+			int ny = y + DIR_Y[d];
+			uint32_t next = static_cast<uint32_t>(ny) * w + nx;
+			if (test_bit(closed, next)) continue;
+
+			uint32_t cost = g[index] + ((d & 1) ? COST_DIAGONAL : COST_STRAIGHT);
+			if (!relax(next, index, cost, octile(nx, ny, goal.x, goal.y))) return Path_status::open_list_full;
+		}
+	}
+	return Path_status::no_path;
+}
+
+// Walk from (x, y) in direction (dx, dy) until something interesting: the goal, a tile with
+// a forced neighbour, or (diagonal) a tile from which a straight jump finds one.
+// Returns the tile index or NONE when the walk hits a wall.
+uint32_t Pathfinder::jump(const Nav_grid& grid, int x, int y, int dx, int dy, Tile_point goal) const {
+
+	const int w = grid.width();
+	while (true) {
+		x += dx;
+		y += dy;
+		if (!grid.is_tile_walkable(x, y)) return NONE;
+		if (x == goal.x && y == goal.y) return static_cast<uint32_t>(y) * w + x;
+
+		if (dx != 0 && dy != 0) {
+			if (jump(grid, x, y, dx, 0, goal) != NONE || jump(grid, x, y, 0, dy, goal) != NONE)
+				return static_cast<uint32_t>(y) * w + x;
+		} else if (dx != 0) {
+			// a side opens up that was blocked one tile back
+			if ((grid.is_tile_walkable(x, y - 1) && !grid.is_tile_walkable(x - dx, y - 1)) ||
+			    (grid.is_tile_walkable(x, y + 1) && !grid.is_tile_walkable(x - dx, y + 1)))
+				return static_cast<uint32_t>(y) * w + x;
+		} else {
+			if ((grid.is_tile_walkable(x - 1, y) && !grid.is_tile_walkable(x - 1, y - dy)) ||
+			    (grid.is_tile_walkable(x + 1, y) && !grid.is_tile_walkable(x + 1, y - dy)))
+				return static_cast<uint32_t>(y) * w + x;
+		}
+
+		// no corner cutting: the next diagonal step needs both sides free
+		if (!grid.is_tile_walkable(x + dx, y) || !grid.is_tile_walkable(x, y + dy)) return NONE;
+	}
+}
+
+Path_status Pathfinder::find_path_jps(const Nav_grid& grid, Tile_point start, Tile_point goal, std::vector<Tile_point>& path) {
+
+	path.clear();
+	if (!begin(grid, start, goal)) return Path_status::invalid;
+
+	const int w = grid.width();
+	const uint32_t goal_index = static_cast<uint32_t>(goal.y) * w + goal.x;
+	const uint32_t start_index = static_cast<uint32_t>(start.y) * w + start.x;
+
+	set_bit(seen, start_index);
+	g[start_index] = 0;
+	origin = start_index;
+	open.push(0, octile(start.x, start.y, goal.x, goal.y), start_index);
+
+	int dirs_x[8], dirs_y[8];
+	while (!open.empty()) {
+		uint32_t index = open.pop().index;
+		if (test_bit(closed, index)) continue;
+		set_bit(closed, index);
+		expanded++;
+
+		if (index == goal_index) {
+			build_path(grid, goal_index, path);
+			return Path_status::found;
+		}
+
+		int x = index % w;
+		int y = index / w;
+
+		// Pruned neighbour directions (no corner cutting variant of JPS)
+		int count = 0;
+		if (index == origin) {
+			for (int d = 0; d < 8; d++) {
+				if (can_step(grid, x, y, DIR_X[d], DIR_Y[d])) {
+					dirs_x[count] = DIR_X[d];
+					dirs_y[count++] = DIR_Y[d];
+				}
+			}
+		} else {
+			int dx = sign(x - static_cast<int>(parent[index] % w));
+			int dy = sign(y - static_cast<int>(parent[index] / w));
+			auto add = [&](int ax, int ay) { dirs_x[count] = ax; dirs_y[count++] = ay; };
+
+			if (dx != 0 && dy != 0) {
+				bool open_y = grid.is_tile_walkable(x, y + dy);
+				bool open_x = grid.is_tile_walkable(x + dx, y);
+				if (open_y) add(0, dy);
+				if (open_x) add(dx, 0);
+				if (open_x && open_y && grid.is_tile_walkable(x + dx, y + dy)) add(dx, dy);
+			} else if (dx != 0) {
+				bool next = grid.is_tile_walkable(x + dx, y);
+				bool down = grid.is_tile_walkable(x, y + 1);
+				bool up = grid.is_tile_walkable(x, y - 1);
+				if (next) {
+					add(dx, 0);
+					if (down && grid.is_tile_walkable(x + dx, y + 1)) add(dx, 1);
+					if (up && grid.is_tile_walkable(x + dx, y - 1)) add(dx, -1);
+				}
+				if (down) add(0, 1);
+				if (up) add(0, -1);
+			} else {
+				bool next = grid.is_tile_walkable(x, y + dy);
+				bool right = grid.is_tile_walkable(x + 1, y);
+				bool left = grid.is_tile_walkable(x - 1, y);
+				if (next) {
+					add(0, dy);
+					if (right && grid.is_tile_walkable(x + 1, y + dy)) add(1, dy);
+					if (left && grid.is_tile_walkable(x - 1, y + dy)) add(-1, dy);
+				}
+				if (right) add(1, 0);
+				if (left) add(-1, 0);
+			}
+		}
+
+		for (int n = 0; n < count; n++) {
+			uint32_t jump_point = jump(grid, x, y, dirs_x[n], dirs_y[n], goal);
+			if (jump_point == NONE || test_bit(closed, jump_point)) continue;
+
+			int jx = jump_point % w;
+			int jy = jump_point / w;
+			uint32_t cost = g[index] + octile(x, y, jx, jy);
+			if (!relax(jump_point, index, cost, octile(jx, jy, goal.x, goal.y))) return Path_status::open_list_full;
+		}
+	}
+	return Path_status::no_path;
+}
+
+Path_status Pathfinder::build_flow_field(const Nav_grid& grid, Tile_point goal, Flow_field& field) {
+
+	field.width = grid.width();
+	field.height = grid.height();
+	field.direction.assign(static_cast<uint32_t>(field.width) * field.height, Flow_field::UNREACHABLE);
+	if (!begin(grid, goal, goal)) return Path_status::invalid;
+
+	const int w = grid.width();
+	const uint32_t goal_index = static_cast<uint32_t>(goal.y) * w + goal.x;
+	set_bit(seen, goal_index);
+	g[goal_index] = 0;
+	origin = goal_index;
+	field.direction[goal_index] = Flow_field::GOAL;
+	open.push(0, 0, goal_index);
+
+	while (!open.empty()) {
+		uint32_t index = open.pop().index;
+		if (test_bit(closed, index)) continue;
+		set_bit(closed, index);
+		expanded++;
+
+		int x = index % w;
+		int y = index / w;
+		for (int d = 0; d < 8; d++) {
+			if (!can_step(grid, x, y, DIR_X[d], DIR_Y[d])) continue;
+			uint32_t next = static_cast<uint32_t>(y + DIR_Y[d]) * w + (x + DIR_X[d]);
+			if (test_bit(closed, next)) continue;
+
+			uint32_t cost = g[index] + ((d & 1) ? COST_DIAGONAL : COST_STRAIGHT);
+			if (test_bit(seen, next) && g[next] <= cost) continue;
+			// moves are symmetric, the way back is the opposite direction
+			field.direction[next] = static_cast<uint8_t>((d + 4) & 7);
+			if (!relax(next, index, cost, 0)) return Path_status::open_list_full;
+		}
+	}
+	return Path_status::found;
+}
+
+Tile_point Flow_field::next(Tile_point tile) const {
+
+	if (tile.x < 0 || tile.y < 0 || tile.x >= width || tile.y >= height) return tile;
+	uint8_t d = direction[static_cast<uint32_t>(tile.y) * width + tile.x];
+	if (d >= GOAL) return tile;
+	return {static_cast<int16_t>(tile.x + DIR_X[d]), static_cast<int16_t>(tile.y + DIR_Y[d])};
+}
+
+/*
+	PATH CACHE
+*/
+Path_cache::Path_cache(uint32_t entries) : entries(entries) {}
+
+const std::vector<Tile_point>* Path_cache::find(Tile_point start, Tile_point goal) {
+
+	for (Entry& entry : entries) {
+		if (entry.valid && entry.start == start && entry.goal == goal) {
+			entry.last_used = ++clock;
+			hits++;
+			return &entry.path;
+		}
+	}
+	misses++;
+	return nullptr;
+}
+
+void Path_cache::store(Tile_point start, Tile_point goal, const std::vector<Tile_point>& path) {
+
+	if (entries.empty()) return;
+
+	// free entry first, least recently used otherwise
+	Entry* target = &entries[0];
+	for (Entry& entry : entries) {
+		if (!entry.valid) {
+			target = &entry;
+			break;
+		}
+		if (entry.last_used < target->last_used) target = &entry;
+	}
+	target->start = start;
+	target->goal = goal;
+	target->path.assign(path.begin(), path.end());	// reuses the entry's buffer
+	target->last_used = ++clock;
+	target->valid = true;
+}
+
+void Path_cache::tile_changed(int tile_x, int tile_y, bool walkable) {
+
+	if (walkable) {
+		clear();
+		return;
+	}
+	// A path is broken by a tile on it, or by a corner tile of one of its diagonal steps
+	auto is_tile = [&](int x, int y) { return x == tile_x && y == tile_y; };
+	for (Entry& entry : entries) {
+		if (!entry.valid) continue;
+		const std::vector<Tile_point>& path = entry.path;
+		for (size_t i = 0; i < path.size(); i++) {
+			bool broken = is_tile(path[i].x, path[i].y);
+			if (i > 0 && path[i].x != path[i - 1].x && path[i].y != path[i - 1].y)
+				broken = broken || is_tile(path[i].x, path[i - 1].y) || is_tile(path[i - 1].x, path[i].y);
+			if (broken) {
+				entry.valid = false;
+				break;
+			}
+		}
+	}
+}
+
+void Path_cache::clear() {
+	for (Entry& entry : entries) entry.valid = false;
+}
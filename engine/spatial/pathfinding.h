@@ -0,0 +1,154 @@
+#ifndef PATHFINDING_H
+#define PATHFINDING_H
+
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+#else
+    #include "pico/stdlib.h"
+#endif
+#include <vector>
+
+// Navigation on the iso tile map (tile coordinates, x east / y north like World_space).
+// 8 directions, diagonal moves never cut a blocked corner. Costs: straight 5, diagonal 7 (~5 * sqrt(2)).
+//
+// RAM per searched tile: g cost (4 B) + parent (2 B) + closed/seen bits, i.e. 24 KB for 64x64.
+// g is 32 bit: a winding route on a 256x256 map can cost far more than 0xFFFF.
+// Maps up to 256x256 (tile index fits uint16_t, all 65536 values are tiles: the start is
+// recognised by its index, not by a parent marker). Nothing is allocated after construction.
+
+struct Tile_point {
+	int16_t x = 0;
+	int16_t y = 0;
+
+	bool operator==(const Tile_point&) const = default;
+};
+
+// Walkable bits, one per tile
+class Nav_grid {
+public:
+	Nav_grid(uint16_t width, uint16_t height);
+
+	uint16_t width() const { return w; }
+	uint16_t height() const { return h; }
+
+	bool is_tile_walkable(int tile_x, int tile_y) const {
+		if (tile_x < 0 || tile_y < 0 || tile_x >= w || tile_y >= h) return false;
+		uint32_t i = static_cast<uint32_t>(tile_y) * w + tile_x;
+		return (bits[i >> 5] >> (i & 31)) & 1u;
+	}
+	void set_walkable(int tile_x, int tile_y, bool walkable);
+
+private:
+	uint16_t w;
+	uint16_t h;
+	std::vector<uint32_t> bits;
+};
+
+enum class Path_status : uint8_t {
+	found,
+	no_path,
+	open_list_full,		// raise open_capacity
+	invalid				// start / goal blocked or outside the map, map larger than the pathfinder
+};
+
+// Direction per tile towards one goal, for many agents sharing it
+struct Flow_field {
+	static constexpr uint8_t GOAL = 8;
+	static constexpr uint8_t UNREACHABLE = 0xFF;
+
+	uint16_t width = 0;
+	uint16_t height = 0;
+	std::vector<uint8_t> direction;		// 0..7 (E, SE, S, SW, W, NW, N, NE), GOAL or UNREACHABLE
+
+	// Next tile on the way to the goal (tile itself at the goal or when unreachable)
+	Tile_point next(Tile_point tile) const;
+};
+
+class Pathfinder {
+public:
+	static constexpr uint16_t COST_STRAIGHT = 5;
+	static constexpr uint16_t COST_DIAGONAL = 7;
+
+	// Largest map this instance can search, open_capacity = binary heap size (8 B per entry)
+	Pathfinder(uint16_t max_width, uint16_t max_height, uint32_t open_capacity);
+
+	// Plain A*, path is every tile from start to goal (both included)
+	Path_status find_path(const Nav_grid& grid, Tile_point start, Tile_point goal, std::vector<Tile_point>& path);
+	// Jump point search: same path cost as A*, far fewer heap operations on open maps
+	Path_status find_path_jps(const Nav_grid& grid, Tile_point start, Tile_point goal, std::vector<Tile_point>& path);
+	// Dijkstra from the goal over the whole map
+	Path_status build_flow_field(const Nav_grid& grid, Tile_point goal, Flow_field& field);
+
+	// Nodes taken from the open list by the last search
+	uint32_t nodes_expanded() const { return expanded; }
+
+private:
+	struct Open_node {
+		uint32_t f;
+		uint16_t h;			// ties on f go to the node closer to the goal (far fewer expansions on open maps)
+		uint16_t index;
+
+		bool operator<(const Open_node& other) const { return f < other.f || (f == other.f && h < other.h); }
+	};
+
+	// Fixed capacity min-heap on (f, h)
+	class Open_list {
+	public:
+		explicit Open_list(uint32_t capacity) : capacity(capacity) { heap.reserve(capacity); }
+		bool push(uint32_t g, uint32_t h, uint32_t index);
+		Open_node pop();
+		bool empty() const { return heap.empty(); }
+		void clear() { heap.clear(); }
+	private:
+		uint32_t capacity;
+		std::vector<Open_node> heap;
+	};
+
+	uint32_t max_tiles;
+	std::vector<uint32_t> g;
+	std::vector<uint16_t> parent;		// valid for seen tiles other than origin
+	uint32_t origin = 0;				// tile the last search started from
+	std::vector<uint32_t> closed;		// bit per tile
+	std::vector<uint32_t> seen;			// bit per tile, g / parent are valid
+	Open_list open;
+	uint32_t expanded = 0;
+
+	bool begin(const Nav_grid& grid, Tile_point start, Tile_point goal);
+	bool relax(uint32_t index, uint32_t from, uint32_t cost, uint32_t h);
+	uint32_t jump(const Nav_grid& grid, int x, int y, int dx, int dy, Tile_point goal) const;
+	void build_path(const Nav_grid& grid, uint32_t goal_index, std::vector<Tile_point>& path) const;
+
+	static bool test_bit(const std::vector<uint32_t>& set, uint32_t i) { return (set[i >> 5] >> (i & 31)) & 1u; }
+	static void set_bit(std::vector<uint32_t>& set, uint32_t i) { set[i >> 5] |= 1u << (i & 31); }
+};
+
+// Last paths by (start, goal), least recently used entry is replaced.
+// Tell it about map edits: a blocked tile drops the paths through it or past it on a diagonal
+// step (no corner cutting), an opened tile drops everything (any path might have a new shortcut).
+class Path_cache {
+public:
+	explicit Path_cache(uint32_t entries = 16);
+
+	const std::vector<Tile_point>* find(Tile_point start, Tile_point goal);
+	void store(Tile_point start, Tile_point goal, const std::vector<Tile_point>& path);
+
+	void tile_changed(int tile_x, int tile_y, bool walkable);
+	void clear();
+
+	uint32_t hits = 0;
+	uint32_t misses = 0;
+
+private:
+	struct Entry {
+		Tile_point start;
+		Tile_point goal;
+		std::vector<Tile_point> path;
+		uint32_t last_used = 0;
+		bool valid = false;
+	};
+	std::vector<Entry> entries;
+	uint32_t clock = 0;
+};
+
+#endif
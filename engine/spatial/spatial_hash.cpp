@@ -0,0 +1,206 @@
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+    #include <cstdio>
+#else
+    #include "pico/stdlib.h"
+    #include "stdio.h"
+#endif
+
+#include "spatial_hash.h"
+
+Spatial_hash::Spatial_hash(int cell_shift, uint32_t bucket_count, uint32_t capacity) : shift(16 + cell_shift) {
+
+	if (bucket_count > MAX_BUCKETS) {
+		printf("[ERROR] Spatial_hash: %u buckets, clamped to %u\n", static_cast<unsigned>(bucket_count), static_cast<unsigned>(MAX_BUCKETS));
+		bucket_count = MAX_BUCKETS;
+	}
+	uint32_t buckets = 1;
+	while (buckets < bucket_count) buckets <<= 1;
+	bucket_mask = buckets - 1;
+	bucket_head.assign(buckets, NONE);
+
+	reserve(capacity);
+}
+
+void Spatial_hash::reserve(uint32_t capacity) {
+
+	if (capacity > MAX_ID + 1) {
+		printf("[ERROR] Spatial_hash: capacity %u, clamped to %u\n", static_cast<unsigned>(capacity), static_cast<unsigned>(MAX_ID + 1));
+		capacity = MAX_ID + 1;
+	}
+	if (capacity <= cell_x.size()) return;
+	cell_x.resize(capacity, FREE);
+	cell_y.resize(capacity, 0);
+	pos_x.resize(capacity, 0);
+	pos_y.resize(capacity, 0);
+	next.resize(capacity, NONE);
+	prev.resize(capacity, NONE);
+}
+
+void Spatial_hash::link(uint32_t id) {
+
+	uint32_t& head = bucket_head[bucket_of(cell_x[id], cell_y[id])];
+	prev[id] = NONE;
+	next[id] = head;
+	if (head != NONE) prev[head] = id;
+	head = id;
+}
+
+void Spatial_hash::unlink(uint32_t id) {
+
+	if (prev[id] != NONE) next[prev[id]] = next[id];
+	else bucket_head[bucket_of(cell_x[id], cell_y[id])] = next[id];
+	if (next[id] != NONE) prev[next[id]] = prev[id];
+}
+
+void Spatial_hash::insert(uint32_t id, const World_space& position) {
+
+	if (id > MAX_ID) {
+		printf("[ERROR] Spatial_hash: invalid id %u (max %u)\n", static_cast<unsigned>(id), static_cast<unsigned>(MAX_ID));
+		return;
+	}
+	if (id >= cell_x.size()) {
+		// grow geometrically so inserting ids in order stays amortized O(1)
+		uint32_t capacity = cell_x.size() < 64 ? 64 : static_cast<uint32_t>(cell_x.size());
+		while (capacity <= id) capacity *= 2;		// id <= MAX_ID: stops at 2^24 at most
+		reserve(capacity);
+	}
+	if (cell_x[id] != FREE) {
+		update(id, position);
+		return;
+	}
+
+	pos_x[id] = position.x.raw;
+	pos_y[id] = position.y.raw;
+	cell_x[id] = to_cell(position.x.raw);
+	cell_y[id] = to_cell(position.y.raw);
+	link(id);
+	count++;
+}
+
+void Spatial_hash::update(uint32_t id, const World_space& position) {
+
+	if (!contains(id)) {
+		insert(id, position);
+		return;
+	}
+
+	pos_x[id] = position.x.raw;
+	pos_y[id] = position.y.raw;
+
+	int32_t cx = to_cell(position.x.raw);
+	int32_t cy = to_cell(position.y.raw);
+	if (cx == cell_x[id] && cy == cell_y[id]) return;
+
+	unlink(id);
+	cell_x[id] = cx;
+	cell_y[id] = cy;
+	link(id);
+}
+
+void Spatial_hash::remove(uint32_t id) {
+
+	if (!contains(id)) return;
+	unlink(id);
+	cell_x[id] = FREE;
+	count--;
+}
+
+void Spatial_hash::clear() {
+
+	bucket_head.assign(bucket_head.size(), NONE);
+	cell_x.assign(cell_x.size(), FREE);
+	count = 0;
+}
+
+template<typename Filter>
+void Spatial_hash::gather(int32_t cx0, int32_t cy0, int32_t cx1, int32_t cy1, Filter&& inside) {
+
+	results.clear();
+
+	// Cells of the range can share a bucket, so an id is only reported from its own cell.
+	// Ranges with more cells than buckets walk every bucket once instead.
+	uint64_t cells = static_cast<uint64_t>(cx1 - cx0 + 1) * static_cast<uint64_t>(cy1 - cy0 + 1);
+	if (cells > bucket_head.size()) {
+		for (uint32_t head : bucket_head) {
+			for (uint32_t id = head; id != NONE; id = next[id]) {
+				if (cell_x[id] >= cx0 && cell_x[id] <= cx1 && cell_y[id] >= cy0 && cell_y[id] <= cy1 && inside(id))
+					results.push_back(id);
+			}
+		}
+		return;
+	}
+
+	for (int32_t cy = cy0; cy <= cy1; cy++) {
+		for (int32_t cx = cx0; cx <= cx1; cx++) {
+			for (uint32_t id = bucket_head[bucket_of(cx, cy)]; id != NONE; id = next[id]) {
+				if (cell_x[id] == cx && cell_y[id] == cy && inside(id))
+					results.push_back(id);
+			}
+		}
+	}
+}
+
+std::span<const uint32_t> Spatial_hash::query_rect(Fixed_q16 min_x, Fixed_q16 min_y, Fixed_q16 max_x, Fixed_q16 max_y) {
+
+	const int32_t x0 = min_x.raw, y0 = min_y.raw, x1 = max_x.raw, y1 = max_y.raw;
+	if (x0 > x1 || y0 > y1) {
+		results.clear();
+		return results;
+	}
+
+	gather(to_cell(x0), to_cell(y0), to_cell(x1), to_cell(y1), [&](uint32_t id) {
+		return pos_x[id] >= x0 && pos_x[id] <= x1 && pos_y[id] >= y0 && pos_y[id] <= y1;
+	});
+	return results;
+}
+
+std::span<const uint32_t> Spatial_hash::query_radius(Fixed_q16 center_x, Fixed_q16 center_y, Fixed_q16 radius) {
+
+	if (radius.raw < 0) {
+		results.clear();
+		return results;
+	}
+
+	// Bounding square clamped to int32, the distance test is done in int64
+	const int64_t cx = center_x.raw, cy = center_y.raw, r = radius.raw;
+	auto clamp = [](int64_t v) { return static_cast<int32_t>(v < INT32_MIN ? INT32_MIN : (v > INT32_MAX ? INT32_MAX : v)); };
+	const int64_t r2 = r * r;
+
+	gather(to_cell(clamp(cx - r)), to_cell(clamp(cy - r)), to_cell(clamp(cx + r)), to_cell(clamp(cy + r)), [&](uint32_t id) {
+		int64_t dx = pos_x[id] - cx;
+		int64_t dy = pos_y[id] - cy;
+		return dx * dx + dy * dy <= r2;
+	});
+	return results;
+}
+
+std::span<const uint32_t> Spatial_hash::query_screen_rect(int16_t min_x, int16_t min_y, int16_t max_x, int16_t max_y, const Camera& cam) {
+
+	if (min_x > max_x || min_y > max_y) {
+		results.clear();
+		return results;
+	}
+
+	// The screen rect is a diamond on the ground plane. With u = x - y and v = (x + y) / 2
+	// (world_to_screen before the floor), pixel rows/columns cover u in [u0, u1), v in [v0, v1).
+	// x = v + u / 2, y = v - u / 2 gives the world bounding box of the diamond.
+	const int64_t u0 = static_cast<int64_t>(min_x - cam.offset_x) << 16;
+	const int64_t u1 = static_cast<int64_t>(max_x + 1 - cam.offset_x) << 16;
+	const int64_t v0 = static_cast<int64_t>(min_y - cam.offset_y) << 16;
+	const int64_t v1 = static_cast<int64_t>(max_y + 1 - cam.offset_y) << 16;
+	auto clamp = [](int64_t v) { return static_cast<int32_t>(v < INT32_MIN ? INT32_MIN : (v > INT32_MAX ? INT32_MAX : v)); };
+
+	const int32_t offset_x = cam.offset_x;
+	const int32_t offset_y = cam.offset_y;
+
+	// Exact test is the same projection as world_to_screen
+	gather(to_cell(clamp(v0 + (u0 >> 1))), to_cell(clamp(v0 - (u1 >> 1))),
+	       to_cell(clamp(v1 + (u1 >> 1))), to_cell(clamp(v1 - (u0 >> 1))), [&](uint32_t id) {
+		int32_t sx = ((pos_x[id] - pos_y[id]) >> 16) + offset_x;
+		int32_t sy = (((pos_x[id] + pos_y[id]) >> 1) >> 16) + offset_y;
+		return sx >= min_x && sx <= max_x && sy >= min_y && sy <= max_y;
+	});
+	return results;
+}
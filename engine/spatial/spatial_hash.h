@@ -0,0 +1,84 @@
+#ifndef SPATIAL_HASH_H
+#define SPATIAL_HASH_H
+
+#ifdef PLATFORM_DESKTOP
+    #include <cstdint>
+    #include <cstddef>
+#else
+    #include "pico/stdlib.h"
+#endif
+#include <vector>
+#include <span>
+#include "engine/math/fixed_point.h"
+#include "engine/isometric/iso_math.h"
+
+// Spatial hash over the ground plane (World_space x/y, z is ignored).
+// Cells are 2^cell_shift world units square, cell (cx, cy) is hashed into a power of two
+// bucket table, so the world has no bounds and negative coordinates just work.
+// Every bucket is an intrusive doubly linked list over per id arrays: moving an entity to
+// another cell is O(1) and nothing is allocated after the id arrays have grown.
+//
+// Ids are dense indices (entity id or component index), the per id arrays are sized by the
+// largest id seen. Query results are a span into an internal buffer, valid until the next query.
+
+class Spatial_hash {
+public:
+	static constexpr uint32_t NONE = UINT32_MAX;
+	// Largest id and bucket table: the per id arrays take 24 bytes per id up to the largest id,
+	// larger ids are rejected, larger bucket counts are clamped
+	static constexpr uint32_t MAX_ID = (1u << 24) - 1;
+	static constexpr uint32_t MAX_BUCKETS = 1u << 24;
+
+	// cell_shift 5 = 32x32 world units per cell, bucket_count is rounded up to a power of two
+	explicit Spatial_hash(int cell_shift = 5, uint32_t bucket_count = 4096, uint32_t capacity = 0);
+
+	void reserve(uint32_t capacity);
+
+	void insert(uint32_t id, const World_space& position);
+	// Cheap when the entity stays in its cell (position is stored, no relinking)
+	void update(uint32_t id, const World_space& position);
+	void remove(uint32_t id);
+	void clear();
+
+	bool contains(uint32_t id) const { return id < cell_x.size() && cell_x[id] != FREE; }
+	size_t size() const { return count; }
+
+	// Inclusive world rect on the ground plane
+	std::span<const uint32_t> query_rect(Fixed_q16 min_x, Fixed_q16 min_y, Fixed_q16 max_x, Fixed_q16 max_y);
+	// dx^2 + dy^2 <= radius^2
+	std::span<const uint32_t> query_radius(Fixed_q16 center_x, Fixed_q16 center_y, Fixed_q16 radius);
+	std::span<const uint32_t> query_radius(const World_space& center, Fixed_q16 radius) {
+		return query_radius(center.x, center.y, radius);
+	}
+	// Entities whose ground point projects into the inclusive screen rect (culling).
+	// Grow the rect by the sprite size / height on the caller side.
+	std::span<const uint32_t> query_screen_rect(int16_t min_x, int16_t min_y, int16_t max_x, int16_t max_y, const Camera& cam);
+
+private:
+	int shift;				// 16 + cell_shift: raw Q16 -> cell coordinate
+	uint32_t bucket_mask;
+	size_t count = 0;
+
+	std::vector<uint32_t> bucket_head;
+
+	// Per id (SoA), cell_x == FREE marks an unused id
+	static constexpr int32_t FREE = INT32_MIN;
+	std::vector<int32_t> cell_x, cell_y;
+	std::vector<int32_t> pos_x, pos_y;		// raw Q16, kept next to the links for the exact tests
+	std::vector<uint32_t> next, prev;
+
+	std::vector<uint32_t> results;
+
+	int32_t to_cell(int32_t raw) const { return raw >> shift; }
+	uint32_t bucket_of(int32_t cx, int32_t cy) const {
+		return ((static_cast<uint32_t>(cx) * 0x9E3779B1u) ^ (static_cast<uint32_t>(cy) * 0x85EBCA77u)) & bucket_mask;
+	}
+
+	void link(uint32_t id);
+	void unlink(uint32_t id);
+
+	template<typename Filter>
+	void gather(int32_t cx0, int32_t cy0, int32_t cx1, int32_t cy1, Filter&& inside);
+};
+
+#endif
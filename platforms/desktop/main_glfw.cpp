@@ -7,20 +7,43 @@
 #include <cstdlib>
 #include <ctime>
 #include <thread>
+#include <filesystem>
+#include <map>
 #include <chrono>
+#include <algorithm>
+#include <cstring>
 
 #define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
 #include <glad/glad.h>
 
 #include "framebuffer.h"
+#include "framebuffer_indexed.h"
+#include "strip_renderer.h"
 #include "iso_math.h"
 #include "fixed_point.h"
+#include "fixed_math.h"
+#include "random.h"
+#include "spatial_hash.h"
+#include "collision.h"
+#include "pathfinding.h"
+#include "animation.h"
+#include "particles.h"
+#include "asset_pack.h"
+#include "level_stream.h"
+#include "block_device.h"
+#include "sector_cache.h"
+#include "fat32.h"
+#include "hot_assets.h"
+#include "profiler.h"
+#include "perf_hud.h"
+#include "tools/asset_packer/lz_compress.h"
 #include "entity.hpp"
 
 #include "assets/skeleton_alpha.h"
 #include "assets/wizard.h"
 #include "assets/wizard2.h"
+#include "assets/characters_atlas.h"
 
 #define RECT_WIDTH 2
 #define RECT_HEIGHT 2
@@ -34,14 +57,16 @@ GLuint g_texture = 0;
 // Forward declaration
 void present_frame();
 
-static std::mt19937 rng(std::random_device{}());
+// xoshiro128**: 16 bytes of state instead of mt19937's 2.5 KB, seedable for replays
+static Random::Xoshiro128 rng(std::random_device{}());
 
 int random_int_distr(int min, int max) {
 	std::uniform_int_distribution<int> dist(min, max);
 	return dist(rng);
 }
+// Unbiased [min, max] (Lemire multiply-shift, no modulo)
 int random_int_modulo(int min, int max) {
-	return min + (rng() % (max - min + 1));
+	return rng.range(min, max);
 }
 
 void fps_counter() {
@@ -239,13 +264,13 @@ void sprite_test() {
 	fill_with_color(COLORS[3].value);
 	// draw_sprite(DISPLAY_HEIGHT/2 - 25/2, 43, DISPLAY_WIDTH/2 - 25/2, 59, skeleton_data);
 
-	draw_sprite_alpha(2, skeleton_alpha_height, 2, skeleton_alpha_width, skeleton_alpha_data);
-	draw_sprite_alpha(2, skeleton_alpha_height, DISPLAY_WIDTH - skeleton_alpha_width, skeleton_alpha_width, skeleton_alpha_data);
+	draw_sprite_planes(skeleton_alpha_sprite, 2, 2);
+	draw_sprite_planes(skeleton_alpha_sprite, DISPLAY_WIDTH - skeleton_alpha_width, 2);
 
-	draw_sprite_alpha(DISPLAY_HEIGHT/2 - skeleton_alpha_height/2, skeleton_alpha_height, DISPLAY_WIDTH/2 - skeleton_alpha_width/2, skeleton_alpha_width, skeleton_alpha_data);
+	draw_sprite_planes(skeleton_alpha_sprite, DISPLAY_WIDTH/2 - skeleton_alpha_width/2, DISPLAY_HEIGHT/2 - skeleton_alpha_height/2);
 
-	draw_sprite_alpha(DISPLAY_HEIGHT - skeleton_alpha_height, skeleton_alpha_height, 2, skeleton_alpha_width, skeleton_alpha_data);
-	draw_sprite_alpha(DISPLAY_HEIGHT - skeleton_alpha_height, skeleton_alpha_height, DISPLAY_WIDTH - skeleton_alpha_width, skeleton_alpha_width, skeleton_alpha_data);
+	draw_sprite_planes(skeleton_alpha_sprite, 2, DISPLAY_HEIGHT - skeleton_alpha_height);
+	draw_sprite_planes(skeleton_alpha_sprite, DISPLAY_WIDTH - skeleton_alpha_width, DISPLAY_HEIGHT - skeleton_alpha_height);
 
 	swap_buffers();
 	while (!glfwWindowShouldClose(g_window)) {
@@ -257,7 +282,7 @@ void movement_tracking_test_sprite_skeleton() {
 
 	Entity sprite_coord = {DISPLAY_HEIGHT/2 - skeleton_alpha_height/2, skeleton_alpha_height, DISPLAY_WIDTH/2 - skeleton_alpha_width/2, skeleton_alpha_width};
 	fill_with_color(COLORS[3].value);
-	draw_sprite_alpha(sprite_coord.y.to_int(), sprite_coord.height, sprite_coord.x.to_int(), sprite_coord.width, skeleton_alpha_data);
+	draw_sprite_planes(skeleton_alpha_sprite, sprite_coord.x.to_int(), sprite_coord.y.to_int());
 	swap_buffers();
 	present_frame();
 
@@ -266,7 +291,7 @@ void movement_tracking_test_sprite_skeleton() {
 		glfwPollEvents();
 		if (handle_movement(sprite_coord)) {
 			fill_with_color(COLORS[3].value);
-			draw_sprite_alpha(sprite_coord.y.to_int(), sprite_coord.height, sprite_coord.x.to_int(), sprite_coord.width, skeleton_alpha_data);
+			draw_sprite_planes(skeleton_alpha_sprite, sprite_coord.x.to_int(), sprite_coord.y.to_int());
 			fps_counter();
 			swap_buffers();
 			present_frame();
@@ -279,8 +304,8 @@ void movement_tracking_test_sprite_wizard() {
 	Entity wizard2 = {DISPLAY_HEIGHT/2 - wizard2_height/2, wizard2_height, DISPLAY_WIDTH/2 - wizard2_width/2, wizard2_width};
 
 	fill_with_color(COLORS[4].value);
-	draw_sprite_alpha(wizard.y.to_int(), wizard.height, wizard.x.to_int(), wizard.width, wizard_data);
-	draw_sprite_alpha(wizard2.y.to_int(), wizard2.height, wizard2.x.to_int(), wizard2.width, wizard2_data);
+	draw_sprite_planes(wizard_sprite, wizard.x.to_int(), wizard.y.to_int());
+	draw_sprite_planes(wizard2_sprite, wizard2.x.to_int(), wizard2.y.to_int());
 
 	swap_buffers();
 	present_frame();
@@ -289,9 +314,9 @@ void movement_tracking_test_sprite_wizard() {
 
 		glfwPollEvents();
 		fill_with_color(COLORS[4].value);
-		draw_sprite_alpha(wizard.y.to_int(), wizard.height, wizard.x.to_int(), wizard.width, wizard_data);
+		draw_sprite_planes(wizard_sprite, wizard.x.to_int(), wizard.y.to_int());
 		handle_movement(wizard2);
-		draw_sprite_alpha(wizard2.y.to_int(), wizard2.height, wizard2.x.to_int(), wizard2.width, wizard2_data);
+		draw_sprite_planes(wizard2_sprite, wizard2.x.to_int(), wizard2.y.to_int());
 		fps_counter();
 		swap_buffers();
 		present_frame();
@@ -329,8 +354,2923 @@ void diamond_outline_test() {
 
 void world_to_screen_test() {
 
+	Camera cam = {DISPLAY_WIDTH / 2, DISPLAY_HEIGHT / 4};
+	const size_t count = 100000;
+	std::vector<Fixed_q16> x(count), y(count), z(count);
+	std::vector<World_space> world(count);
+	for (size_t i = 0; i < count; i++) {
+		x[i] = Fixed_q16::from_raw(random_int_modulo(-500 << 16, 500 << 16));
+		y[i] = Fixed_q16::from_raw(random_int_modulo(-500 << 16, 500 << 16));
+		z[i] = Fixed_q16::from_raw(random_int_modulo(0, 64 << 16));
+		world[i] = {x[i], y[i], z[i]};
+	}
+
+	// Batch must match scalar exactly, screen_to_world(z) must invert world_to_screen
+	std::vector<Screen_space> screen(count);
+	world_to_screen(x.data(), y.data(), z.data(), count, cam, screen.data());
+	size_t mismatches = 0, roundtrip_errors = 0;
+	for (size_t i = 0; i < count; i++) {
+		Screen_space s = world_to_screen(world[i], cam);
+		if (s.x != screen[i].x || s.y != screen[i].y) mismatches++;
+
+		World_space back = screen_to_world(s, cam, world[i].z);
+		Screen_space again = world_to_screen(back, cam);
+		if (again.x != s.x || again.y != s.y) roundtrip_errors++;
+	}
+	printf("[%s] batch vs scalar mismatches: %zu\n", mismatches == 0 ? "PASS" : "FAIL", mismatches);
+	printf("[%s] screen_to_world(z) round trip errors: %zu\n", roundtrip_errors == 0 ? "PASS" : "FAIL", roundtrip_errors);
+
+	// Far out coordinates overflow Q16.16: the batch wraps like the scalar Fixed_q16 math
+	const size_t far_count = 10000;
+	std::vector<Fixed_q16> far_x(far_count), far_y(far_count), far_z(far_count), back_x(far_count), back_y(far_count);
+	std::vector<Screen_space> far_screen(far_count), points(far_count);
+	for (size_t i = 0; i < far_count; i++) {
+		far_x[i] = Fixed_q16::from_raw(random_int_modulo(INT32_MIN / 2, INT32_MAX / 2) * 2);
+		far_y[i] = Fixed_q16::from_raw(random_int_modulo(INT32_MIN / 2, INT32_MAX / 2) * 2);
+		far_z[i] = Fixed_q16::from_raw(random_int_modulo(INT32_MIN / 2, INT32_MAX / 2) * 2);
+		points[i] = {static_cast<int16_t>(random_int_modulo(INT16_MIN, INT16_MAX)), static_cast<int16_t>(random_int_modulo(INT16_MIN, INT16_MAX))};
+	}
+	const Fixed_q16 far_height = Fixed_q16::from_raw(INT32_MAX - 5);
+	world_to_screen(far_x.data(), far_y.data(), far_z.data(), far_count, cam, far_screen.data());
+	screen_to_world(points.data(), far_count, cam, far_height, back_x.data(), back_y.data());
+	size_t far_mismatches = 0;
+	for (size_t i = 0; i < far_count; i++) {
+		Screen_space s = world_to_screen(World_space{far_x[i], far_y[i], far_z[i]}, cam);
+		World_space w = screen_to_world(points[i], cam, far_height);
+		if (s.x != far_screen[i].x || s.y != far_screen[i].y || w.x != back_x[i] || w.y != back_y[i]) far_mismatches++;
+	}
+	printf("[%s] far out batch vs scalar mismatches: %zu\n", far_mismatches == 0 ? "PASS" : "FAIL", far_mismatches);
+
+	const int frames = 200;
+	volatile int32_t sink = 0;
+	auto measure = [&](auto&& body) {
+		auto start = std::chrono::steady_clock::now();
+		for (int f = 0; f < frames; f++) body();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+	};
+
+	// Old path: (x + y) / 2 went through Fixed_q16::operator/ (64-bit divide).
+	// The divisor is read through volatile so the compiler cannot turn it into a shift.
+	static volatile int32_t two_raw = 2 << 16;
+	double divide_ms = measure([&] {
+		Fixed_q16 two = Fixed_q16::from_raw(two_raw);
+		for (size_t i = 0; i < count; i++) {
+			Fixed_q16 sx = world[i].x - world[i].y;
+			Fixed_q16 sy = (world[i].x + world[i].y) / two - world[i].z;
+			screen[i].x = sx.to_int() + cam.offset_x;
+			screen[i].y = sy.to_int() + cam.offset_y;
+		}
+		sink = sink + screen[count - 1].y;
+	});
+	double scalar_ms = measure([&] {
+		for (size_t i = 0; i < count; i++) screen[i] = world_to_screen(world[i], cam);
+		sink = sink + screen[count - 1].y;
+	});
+	double batch_ms = measure([&] {
+		world_to_screen(x.data(), y.data(), z.data(), count, cam, screen.data());
+		sink = sink + screen[count - 1].y;
+	});
+	printf("[BENCH] %zu points per frame: divide %.3f ms, scalar shift %.3f ms, SoA batch %.3f ms\n",
+		count, divide_ms, scalar_ms, batch_ms);
+}
+
+void fixed_math_accuracy_test() {
+
+	double sin_err = 0, cos_err = 0;
+	for (int a = 0; a < 65536; a++) {
+		double radians = a * 2.0 * M_PI / 65536.0;
+		sin_err = fmax(sin_err, fabs(Fixed_math::sin(static_cast<Fixed_math::Angle>(a)).to_float() - sin(radians)));
+		cos_err = fmax(cos_err, fabs(Fixed_math::cos(static_cast<Fixed_math::Angle>(a)).to_float() - cos(radians)));
+	}
+
+	double atan2_err = 0;
+	for (int i = 0; i < 100000; i++) {
+		Fixed_q16 y = Fixed_q16::from_raw(random_int_modulo(-100000000, 100000000));
+		Fixed_q16 x = Fixed_q16::from_raw(random_int_modulo(-100000000, 100000000));
+		double err = fabs(Fixed_math::atan2(y, x).to_float() - atan2(y.to_float(), x.to_float()));
+		if (err > M_PI) err = 2.0 * M_PI - err;	// -pi and pi are the same angle
+		atan2_err = fmax(atan2_err, err);
+	}
+
+	double sqrt_err = 0, recip_err = 0, normalize_err = 0;
+	for (int i = 0; i < 100000; i++) {
+		Fixed_q16 value = Fixed_q16::from_raw(random_int_modulo(2, INT32_MAX - 1));
+		sqrt_err = fmax(sqrt_err, fabs(Fixed_math::sqrt(value).to_float() - sqrt(value.to_float())));
+		// compare raw against the exactly rounded 2^32 / raw
+		recip_err = fmax(recip_err, fabs(Fixed_math::reciprocal(value).raw - 4294967296.0 / value.raw));
+
+		Vec2_q16 v = {Fixed_q16::from_raw(random_int_modulo(-100000000, 100000000)), Fixed_q16::from_raw(random_int_modulo(-100000000, 100000000))};
+		Vec2_q16 n = Fixed_math::normalize(v);
+		double len = hypot(v.x.to_float(), v.y.to_float());
+		if (len > 0) normalize_err = fmax(normalize_err, fabs(n.x.to_float() - v.x.to_float() / len));
+	}
+
+	// Q16.16 step is 1.5e-5
+	printf("[%s] sin max err %.2e\n", sin_err < 5e-5 ? "PASS" : "FAIL", sin_err);
+	printf("[%s] cos max err %.2e\n", cos_err < 5e-5 ? "PASS" : "FAIL", cos_err);
+	printf("[%s] atan2 max err %.2e rad\n", atan2_err < 5e-5 ? "PASS" : "FAIL", atan2_err);
+	printf("[%s] sqrt max err %.2e\n", sqrt_err < 2e-5 ? "PASS" : "FAIL", sqrt_err);
+	printf("[%s] reciprocal max err %.2f lsb\n", recip_err <= 1.0 ? "PASS" : "FAIL", recip_err);
+	printf("[%s] normalize max err %.2e\n", normalize_err < 1e-4 ? "PASS" : "FAIL", normalize_err);
+
+	// Most negative value / -1 does not fit: wraps or saturates like the other overflows, no trap
+	volatile int minus_one = -1;
+	Fixed_q16 wrapped = Fixed_q16::from_raw(INT32_MIN) / minus_one;
+	Fixed_q16_sat saturated = Fixed_q16_sat::from_raw(INT32_MIN) / minus_one;
+	Fixed_q16 negated = Fixed_q16(5) / minus_one;
+	bool min_div_ok = wrapped.raw == INT32_MIN && saturated.raw == INT32_MAX && negated == -5;
+	printf("[%s] min / -1 wraps to %d, saturates to %d\n", min_div_ok ? "PASS" : "FAIL", static_cast<int>(wrapped.raw), static_cast<int>(saturated.raw));
+}
+
+void fixed_math_benchmark() {
+
+	const int iterations = 10000000;
+	volatile float float_sink = 0;
+	volatile int32_t fixed_sink = 0;
+
+	auto measure = [](auto&& body) {
+		auto start = std::chrono::steady_clock::now();
+		body();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	};
+
+	double sinf_ms = measure([&] { for (int i = 0; i < iterations; i++) float_sink = float_sink + sinf(i * 0.001f); });
+	double sin_ms = measure([&] { for (int i = 0; i < iterations; i++) fixed_sink = fixed_sink + Fixed_math::sin(static_cast<Fixed_math::Angle>(i * 10)).raw; });
+	double sqrtf_ms = measure([&] { for (int i = 0; i < iterations; i++) float_sink = float_sink + sqrtf(i * 0.37f); });
+	double sqrt_ms = measure([&] { for (int i = 0; i < iterations; i++) fixed_sink = fixed_sink + Fixed_math::sqrt(Fixed_q16::from_raw(i * 213)).raw; });
+	double atan2f_ms = measure([&] { for (int i = 0; i < iterations; i++) float_sink = float_sink + atan2f(i * 0.01f - 50.0f, 13.0f); });
+	double atan2_ms = measure([&] { for (int i = 0; i < iterations; i++) fixed_sink = fixed_sink + Fixed_math::atan2(Fixed_q16::from_raw(i * 65 - 3276800), Fixed_q16(13)).raw; });
+	double divf_ms = measure([&] { for (int i = 1; i <= iterations; i++) float_sink = float_sink + 1.0f / (i * 0.37f); });
+	double recip_ms = measure([&] { for (int i = 1; i <= iterations; i++) fixed_sink = fixed_sink + Fixed_math::reciprocal(Fixed_q16::from_raw(i * 213)).raw; });
+
+	// Desktop has an FPU, so float wins here - the soft-float numbers come from the Pico build
+	printf("[BENCH] %d calls (ms): sinf %.1f / sin %.1f, sqrtf %.1f / sqrt %.1f, atan2f %.1f / atan2 %.1f, 1.0f/x %.1f / reciprocal %.1f\n",
+		iterations, sinf_ms, sin_ms, sqrtf_ms, sqrt_ms, atan2f_ms, atan2_ms, divf_ms, recip_ms);
+}
+
+void random_test() {
+
+	// Known answers: reference xoshiro128** with state {1, 2, 3, 4}, pcg32-demo (seed 42, stream 54)
+	Random::Xoshiro128 xoshiro;
+	xoshiro.s[0] = 1; xoshiro.s[1] = 2; xoshiro.s[2] = 3; xoshiro.s[3] = 4;
+	uint32_t x0 = xoshiro.next();
+	Random::Pcg32 pcg(42, 54);
+	uint32_t p0 = pcg.next();
+	uint32_t p1 = pcg.next();
+	printf("[%s] xoshiro128** reference output %u\n", x0 == 11520 ? "PASS" : "FAIL", x0);
+	printf("[%s] pcg32 reference output %08x %08x\n", (p0 == 0xa15c02b7 && p1 == 0x7b47f409) ? "PASS" : "FAIL", p0, p1);
+
+	// Lane 0 of the bulk generator is the scalar stream
+	Random::Xoshiro128 scalar(1234);
+	Random::Xoshiro128_x4 bulk(1234);
+	uint32_t block[64];
+	bulk.fill(block, 64);
+	bool lanes_match = true;
+	for (int i = 0; i < 64; i += Random::Xoshiro128_x4::LANES) lanes_match &= (block[i] == scalar.next());
+	printf("[%s] bulk lane 0 == scalar stream\n", lanes_match ? "PASS" : "FAIL");
+
+	// Bounded output stays in range and hits every value
+	Random::Xoshiro128 gen(99);
+	int histogram[7] = {};
+	bool in_range = true;
+	for (int i = 0; i < 700000; i++) {
+		int v = gen.range(-3, 3);
+		in_range &= (v >= -3 && v <= 3);
+		if (in_range) histogram[v + 3]++;
+	}
+	int min_bucket = *std::min_element(histogram, histogram + 7);
+	int max_bucket = *std::max_element(histogram, histogram + 7);
+	printf("[%s] range(-3, 3) buckets %d..%d of 100000 expected\n", (in_range && min_bucket > 98000 && max_bucket < 102000) ? "PASS" : "FAIL", min_bucket, max_bucket);
+
+	Fixed_q16 u = gen.uniform(Fixed_q16(-2), Fixed_q16(5));
+	printf("[%s] uniform(-2, 5) = %f\n", (u >= -2 && u < 5) ? "PASS" : "FAIL", u.to_float());
+
+	// Spans over INT32_MAX: both halves of the range come up, the full range is not stuck at min
+	int wide_low = 0, full_low = 0, bulk_low = 0;
+	bool wide_in_range = true;
+	for (int i = 0; i < 1000; i++) {
+		int32_t wide = gen.range(-2000000000, 2000000000);
+		wide_in_range &= (wide >= -2000000000 && wide <= 2000000000);
+		wide_low += wide < 0;
+		full_low += gen.range(INT32_MIN, INT32_MAX) < 0;
+	}
+	std::vector<int32_t> bulk_wide(1000);
+	Random::Xoshiro128_x4 bulk_gen(5);
+	bulk_gen.fill_range(bulk_wide.data(), bulk_wide.size(), INT32_MIN, INT32_MAX);
+	for (int32_t v : bulk_wide) bulk_low += v < 0;
+	bool wide_ok = wide_in_range && wide_low > 400 && wide_low < 600 && full_low > 400 && full_low < 600 && bulk_low > 400 && bulk_low < 600;
+	printf("[%s] wide ranges: negative %d / %d / %d of 1000\n", wide_ok ? "PASS" : "FAIL", wide_low, full_low, bulk_low);
+}
+
+void random_benchmark() {
+
+	const int iterations = 10000000;
+	const int range = DISPLAY_WIDTH;
+	volatile uint32_t sink = 0;
+	std::vector<int32_t> bulk_out(iterations);
+
+	auto measure = [](auto&& body) {
+		auto start = std::chrono::steady_clock::now();
+		body();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	};
+
+	std::mt19937 mt(1);
+	Random::Xoshiro128 xoshiro(1);
+	Random::Pcg32 pcg(1);
+	Random::Xoshiro128_x4 bulk(1);
+
+	// Every variant writes into the same array, like filling particle positions
+	int32_t* out = bulk_out.data();
+	double mt_modulo_ms = measure([&] { for (int i = 0; i < iterations; i++) out[i] = mt() % range; sink = out[iterations - 1]; });
+	double mt_distr_ms = measure([&] {
+		std::uniform_int_distribution<int> dist(0, range - 1);
+		for (int i = 0; i < iterations; i++) out[i] = dist(mt);
+		sink = out[iterations - 1];
+	});
+	double xoshiro_ms = measure([&] { for (int i = 0; i < iterations; i++) out[i] = xoshiro.bounded(range); sink = out[iterations - 1]; });
+	double pcg_ms = measure([&] { for (int i = 0; i < iterations; i++) out[i] = pcg.bounded(range); sink = out[iterations - 1]; });
+	double bulk_ms = measure([&] { bulk.fill_range(out, iterations, 0, range - 1); sink = out[iterations - 1]; });
+
+	printf("[BENCH] %d values in [0, %d) (ms): mt19937 %% %.1f, mt19937 + distribution %.1f, xoshiro128** %.1f, pcg32 %.1f, x4 bulk fill %.1f\n",
+		iterations, range, mt_modulo_ms, mt_distr_ms, xoshiro_ms, pcg_ms, bulk_ms);
+	printf("[BENCH] state size (bytes): mt19937 %zu, xoshiro128** %zu, pcg32 %zu\n", sizeof(std::mt19937), sizeof(Random::Xoshiro128), sizeof(Random::Pcg32));
+}
+
+void spatial_hash_test() {
+
+	Spatial_hash grid(5, 1024);
+	Random::Xoshiro128 gen(7);
+	const uint32_t count = 20000;
+	std::vector<World_space> world(count);
+	for (uint32_t i = 0; i < count; i++) {
+		world[i] = {Fixed_q16::from_raw(gen.range(-2000 << 16, 2000 << 16)), Fixed_q16::from_raw(gen.range(-2000 << 16, 2000 << 16))};
+		grid.insert(i, world[i]);
+	}
+	// Move everything, drop every 10th entity
+	for (uint32_t i = 0; i < count; i++) {
+		if (i % 10 == 0) {
+			grid.remove(i);
+			continue;
+		}
+		world[i].x += Fixed_q16::from_raw(gen.range(-64 << 16, 64 << 16));
+		world[i].y += Fixed_q16::from_raw(gen.range(-64 << 16, 64 << 16));
+		grid.update(i, world[i]);
+	}
+
+	auto compare = [&](std::span<const uint32_t> found, auto&& inside) {
+		std::vector<uint32_t> got(found.begin(), found.end());
+		std::vector<uint32_t> expected;
+		for (uint32_t i = 0; i < count; i++)
+			if (i % 10 != 0 && inside(world[i])) expected.push_back(i);
+		std::sort(got.begin(), got.end());
+		return got == expected;
+	};
+
+	Camera cam = {DISPLAY_WIDTH / 2, DISPLAY_HEIGHT / 4};
+	int failures = 0;
+	for (int q = 0; q < 200; q++) {
+		Fixed_q16 cx = Fixed_q16::from_raw(gen.range(-2000 << 16, 2000 << 16));
+		Fixed_q16 cy = Fixed_q16::from_raw(gen.range(-2000 << 16, 2000 << 16));
+		// Up to 2000 units so the large range (all buckets) path is hit too
+		Fixed_q16 r = Fixed_q16::from_raw(gen.range(0, (q % 20 == 0 ? 2000 : 100) << 16));
+
+		bool rect_ok = compare(grid.query_rect(cx - r, cy - r, cx + r, cy + r), [&](const World_space& w) {
+			return w.x >= cx - r && w.x <= cx + r && w.y >= cy - r && w.y <= cy + r;
+		});
+		bool radius_ok = compare(grid.query_radius(cx, cy, r), [&](const World_space& w) {
+			int64_t dx = w.x.raw - cx.raw, dy = w.y.raw - cy.raw;
+			return dx * dx + dy * dy <= static_cast<int64_t>(r.raw) * r.raw;
+		});
+		cam.offset_x = gen.range(-1000, 1000);
+		cam.offset_y = gen.range(-1000, 1000);
+		bool screen_ok = compare(grid.query_screen_rect(0, 0, DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1, cam), [&](const World_space& w) {
+			Screen_space s = world_to_screen(w, cam);
+			return s.x >= 0 && s.x < DISPLAY_WIDTH && s.y >= 0 && s.y < DISPLAY_HEIGHT;
+		});
+		if (!rect_ok || !radius_ok || !screen_ok) failures++;
+	}
+	printf("[%s] rect/radius/screen queries vs brute force, %d of 200 differ\n", failures == 0 ? "PASS" : "FAIL", failures);
+	printf("[%s] size after removes: %zu\n", grid.size() == count - count / 10 ? "PASS" : "FAIL", grid.size());
+
+	// Ids and bucket counts past the maximum are rejected or clamped, not grown forever
+	printf("  expected errors:\n");
+	size_t before = grid.size();
+	grid.insert(0x80000000u, world[1]);
+	grid.insert(Spatial_hash::NONE - 1, world[1]);
+	Spatial_hash huge(5, 0x80000001u);
+	huge.insert(Spatial_hash::MAX_ID, world[1]);
+	bool limits_ok = grid.size() == before && !grid.contains(0x80000000u) && huge.contains(Spatial_hash::MAX_ID);
+	printf("[%s] ids over MAX_ID rejected, bucket count clamped\n", limits_ok ? "PASS" : "FAIL");
+}
+
+void spatial_hash_benchmark() {
+
+	// 100k entities wandering in a 4096 x 4096 world, every frame: move + update all,
+	// 256 neighbour queries (radius 48) and one screen culling query
+	const uint32_t count = 100000;
+	const int frames = 30;
+	const int queries = 256;
+	const Fixed_q16 radius = 48;
+	const int32_t half_world = 2048 << 16;
+	Camera cam = {DISPLAY_WIDTH / 2, DISPLAY_HEIGHT / 4};
+
+	Random::Xoshiro128 gen(1);
+	std::vector<World_space> world(count);
+	std::vector<Fixed_q16> vx(count), vy(count);
+	for (uint32_t i = 0; i < count; i++) {
+		world[i] = {Fixed_q16::from_raw(gen.range(-half_world, half_world)), Fixed_q16::from_raw(gen.range(-half_world, half_world))};
+		vx[i] = gen.uniform(Fixed_q16(-2), Fixed_q16(2));
+		vy[i] = gen.uniform(Fixed_q16(-2), Fixed_q16(2));
+	}
+	std::vector<World_space> centers(queries);
+	for (auto& c : centers) c = world[gen.bounded(count)];
+
+	auto move = [&] {
+		for (uint32_t i = 0; i < count; i++) {
+			world[i].x += vx[i];
+			world[i].y += vy[i];
+			if (world[i].x.raw < -half_world || world[i].x.raw > half_world) vx[i] = -vx[i];
+			if (world[i].y.raw < -half_world || world[i].y.raw > half_world) vy[i] = -vy[i];
+		}
+	};
+	auto measure = [&](auto&& body) {
+		auto start = std::chrono::steady_clock::now();
+		for (int f = 0; f < frames; f++) body();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+	};
+
+	volatile size_t sink = 0;
+	std::vector<uint32_t> found;
+	found.reserve(count);
+
+	double brute_ms = measure([&] {
+		move();
+		const int64_t r2 = static_cast<int64_t>(radius.raw) * radius.raw;
+		for (const World_space& c : centers) {
+			found.clear();
+			for (uint32_t i = 0; i < count; i++) {
+				int64_t dx = world[i].x.raw - c.x.raw, dy = world[i].y.raw - c.y.raw;
+				if (dx * dx + dy * dy <= r2) found.push_back(i);
+			}
+			sink = sink + found.size();
+		}
+		found.clear();
+		for (uint32_t i = 0; i < count; i++) {
+			Screen_space s = world_to_screen(world[i], cam);
+			if (s.x >= 0 && s.x < DISPLAY_WIDTH && s.y >= 0 && s.y < DISPLAY_HEIGHT) found.push_back(i);
+		}
+		sink = sink + found.size();
+	});
+
+	Spatial_hash grid(5, 1 << 16, count);
+	for (uint32_t i = 0; i < count; i++) grid.insert(i, world[i]);
+	double update_ms = 0;
+	double grid_ms = measure([&] {
+		auto start = std::chrono::steady_clock::now();
+		move();
+		for (uint32_t i = 0; i < count; i++) grid.update(i, world[i]);
+		update_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		for (const World_space& c : centers) sink = sink + grid.query_radius(c, radius).size();
+		sink = sink + grid.query_screen_rect(0, 0, DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1, cam).size();
+	});
+
+	printf("[BENCH] %u moving entities, %d radius queries + 1 screen query per frame: brute force %.2f ms, spatial hash %.2f ms (move + update %.2f ms)\n",
+		count, queries, brute_ms, grid_ms, update_ms / frames);
+}
+
+// Deterministic scene shared with the Pico build: same seed + body count gives the same checksum
+struct Collision_scene {
+	Collision_world world;
+	std::vector<Vec2_q16> velocity;
+	Fixed_q16 size;
+};
+
+void collision_scene_init(Collision_scene& scene, uint32_t bodies, uint32_t seed) {
+
+	Random::Xoshiro128 gen(seed);
+	// ~24 x 24 units of room per body, so the density is the same for every body count
+	scene.size = Fixed_q16(static_cast<int32_t>(Fixed_math::isqrt(bodies)) * 24);
+	scene.velocity.assign(bodies, Vec2_q16{});
+
+	// Static iso tiles (diamond, 2:1) on a coarse grid
+	uint32_t id = bodies;
+	for (Fixed_q16 ty = 32; ty < scene.size; ty += 96) {
+		for (Fixed_q16 tx = 32; tx < scene.size; tx += 96) {
+			scene.world.set(id++, Collision::Shape::diamond(tx, ty, 16, 8), true);
+		}
+	}
+	for (uint32_t i = 0; i < bodies; i++) {
+		Fixed_q16 x = gen.uniform(Fixed_q16(0), scene.size);
+		Fixed_q16 y = gen.uniform(Fixed_q16(0), scene.size);
+		Fixed_q16 side = Fixed_q16(gen.range(6, 12));
+		scene.world.set(i, Collision::Shape::box(x, y, side, side));
+		scene.velocity[i] = {gen.uniform(Fixed_q16(-1), Fixed_q16(1)), gen.uniform(Fixed_q16(-1), Fixed_q16(1))};
+	}
+}
+
+// One frame: move, bounce off the scene border, collide, push apart. Returns the contact count.
+size_t collision_scene_step(Collision_scene& scene, uint32_t& checksum) {
+
+	for (uint32_t i = 0; i < scene.velocity.size(); i++) {
+		const Collision::Shape& shape = scene.world.shape(i);
+		Vec2_q16& v = scene.velocity[i];
+		if (shape.x < 0 || shape.x > scene.size) v.x = -v.x;
+		if (shape.y < 0 || shape.y > scene.size) v.y = -v.y;
+		scene.world.move_to(i, shape.x + v.x, shape.y + v.y);
+	}
+
+	auto contacts = scene.world.step();
+	// FNV-1a over the raw contact data
+	for (const Collision::Contact& c : contacts) {
+		for (uint32_t word : {c.a, c.b, static_cast<uint32_t>(c.normal_x.raw), static_cast<uint32_t>(c.normal_y.raw), static_cast<uint32_t>(c.depth.raw)}) {
+			checksum = (checksum ^ word) * 16777619u;
+		}
+	}
+	scene.world.resolve();
+	return contacts.size();
+}
+
+void collision_test() {
+
+	using namespace Collision;
+	Contact contact;
+
+	// Box overlapping 2 units from the left: push along -x
+	bool box_ok = collide(Shape::box(0, 0, 10, 10), Shape::box(8, 1, 10, 10), contact)
+		&& contact.normal_x == 1 && contact.normal_y == 0 && contact.depth == 2;
+	printf("[%s] box vs box normal (%f, %f) depth %f\n", box_ok ? "PASS" : "FAIL",
+		contact.normal_x.to_float(), contact.normal_y.to_float(), contact.depth.to_float());
+
+	// Box in the bounding box corner of a diamond but outside the diamond itself
+	Shape tile = Shape::diamond(0, 0, 16, 8);
+	bool corner_ok = !collide(Shape::box(10, 5, 4, 4), tile, contact);
+	bool edge_ok = collide(Shape::box(6, 2, 4, 4), tile, contact) && contact.normal_x < 0 && contact.normal_y < 0;
+	printf("[%s] box vs diamond: corner miss %d, edge hit normal (%f, %f) depth %f\n", corner_ok && edge_ok ? "PASS" : "FAIL",
+		corner_ok, contact.normal_x.to_float(), contact.normal_y.to_float(), contact.depth.to_float());
+
+	// Broadphase must find exactly the contacts of the O(n^2) test
+	Collision_scene scene;
+	collision_scene_init(scene, 500, 3);
+	uint32_t checksum = 2166136261u;
+	for (int f = 0; f < 10; f++) collision_scene_step(scene, checksum);
+	auto contacts = scene.world.step();
+	size_t expected = 0;
+	for (uint32_t a = 0; a < scene.world.size(); a++) {
+		for (uint32_t b = a + 1; b < scene.world.size(); b++) {
+			if (a >= 500 && b >= 500) continue;	// static pairs are skipped
+			if (collide(scene.world.shape(a), scene.world.shape(b), contact)) expected++;
+		}
+	}
+	printf("[%s] sweep and prune contacts %zu, brute force %zu\n", contacts.size() == expected ? "PASS" : "FAIL", contacts.size(), expected);
+
+	// Same seed, same contacts
+	uint32_t first = 2166136261u, second = 2166136261u;
+	Collision_scene run_a, run_b;
+	collision_scene_init(run_a, 1000, 1);
+	collision_scene_init(run_b, 1000, 1);
+	for (int f = 0; f < 60; f++) {
+		collision_scene_step(run_a, first);
+		collision_scene_step(run_b, second);
+	}
+	printf("[%s] deterministic replay checksum %08x (1000 bodies, seed 1, 60 frames, compare with the Pico build)\n",
+		first == second ? "PASS" : "FAIL", first);
+}
+
+void collision_benchmark() {
+
+	const int frames = 120;
+	for (uint32_t bodies : {1000u, 4000u, 10000u}) {
+		Collision_scene scene;
+		collision_scene_init(scene, bodies, 1);
+		uint32_t checksum = 2166136261u;
+		size_t contacts = 0;
+
+		auto start = std::chrono::steady_clock::now();
+		for (int f = 0; f < frames; f++) contacts += collision_scene_step(scene, checksum);
+		double frame_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+
+		printf("[BENCH] %u dynamic + %zu static bodies: %.3f ms per frame (%.1f%% of a 60 fps frame), %zu contacts per frame, %zu pairs tested\n",
+			bodies, scene.world.size() - bodies, frame_ms, frame_ms / 16.667 * 100.0, contacts / frames, scene.world.pair_count());
+	}
 }
 
+void collision_movement_test() {
+	// WASD box against a few iso tiles
+	Entity rect = {DISPLAY_HEIGHT/2 - 12/2, 12, 8, 12, 0xFFE0};
+	Collision_world world;
+	const int tiles[][2] = {{60, 40}, {92, 56}, {124, 72}, {60, 100}, {124, 30}};
+	uint32_t id = 1;
+	for (auto& t : tiles) world.set(id++, Collision::Shape::diamond(t[0], t[1], 16, 8), true);
+	world.set(0, Collision::Shape::box(rect.x, rect.y, rect.width, rect.height));
+
+	while (!glfwWindowShouldClose(g_window)) {
+		glfwPollEvents();
+		handle_movement(rect);
+
+		world.set(0, Collision::Shape::box(rect.x, rect.y, rect.width, rect.height));
+		world.step();
+		world.resolve();
+		rect.x = world.shape(0).left();
+		rect.y = world.shape(0).top();
+
+		fill_with_color(0x0000);
+		for (auto& t : tiles) draw_diamond_outline(t[0], t[1], 16, 8, COLORS[6].value);
+		draw_rectangle_memset(rect.y.to_int(), rect.height, rect.x.to_int(), rect.width, rect.color);
+		fps_counter();
+		swap_buffers();
+		present_frame();
+	}
+}
+
+// Random blocks plus a few long walls with gaps, same generator as the Pico build
+void nav_grid_random(Nav_grid& grid, uint32_t seed, int blocked_percent) {
+
+	Random::Xoshiro128 gen(seed);
+	for (int y = 0; y < grid.height(); y++)
+		for (int x = 0; x < grid.width(); x++)
+			grid.set_walkable(x, y, gen.bounded(100) >= static_cast<uint32_t>(blocked_percent));
+
+	for (int wall = 0; wall < grid.width() / 16; wall++) {
+		int x = gen.range(0, grid.width() - 1);
+		for (int y = 0; y < grid.height(); y++)
+			if (gen.bounded(8) != 0) grid.set_walkable(x, y, false);
+	}
+}
+
+Tile_point random_walkable_tile(const Nav_grid& grid, Random::Xoshiro128& gen) {
+	while (true) {
+		Tile_point t = {static_cast<int16_t>(gen.bounded(grid.width())), static_cast<int16_t>(gen.bounded(grid.height()))};
+		if (grid.is_tile_walkable(t.x, t.y)) return t;
+	}
+}
+
+// Sum of step costs, 0xFFFFFFFF for a step that is not a legal move
+uint32_t path_cost(const Nav_grid& grid, const std::vector<Tile_point>& path) {
+	uint32_t cost = 0;
+	for (size_t i = 1; i < path.size(); i++) {
+		int dx = path[i].x - path[i - 1].x;
+		int dy = path[i].y - path[i - 1].y;
+		bool diagonal = dx != 0 && dy != 0;
+		bool legal = abs(dx) <= 1 && abs(dy) <= 1 && (dx != 0 || dy != 0) && grid.is_tile_walkable(path[i].x, path[i].y) &&
+			(!diagonal || (grid.is_tile_walkable(path[i - 1].x + dx, path[i - 1].y) && grid.is_tile_walkable(path[i - 1].x, path[i - 1].y + dy)));
+		if (!legal) return UINT32_MAX;
+		cost += diagonal ? Pathfinder::COST_DIAGONAL : Pathfinder::COST_STRAIGHT;
+	}
+	return cost;
+}
+
+void pathfinding_test() {
+
+	Nav_grid grid(64, 64);
+	Pathfinder finder(64, 64, 2048);
+	Flow_field field;
+	std::vector<Tile_point> astar_path, jps_path;
+	Random::Xoshiro128 gen(11);
+
+	int mismatches = 0, flow_errors = 0, found = 0, queries = 0;
+	for (int map = 0; map < 20; map++) {
+		nav_grid_random(grid, map, 10 + map);
+		for (int q = 0; q < 50; q++, queries++) {
+			Tile_point start = random_walkable_tile(grid, gen);
+			Tile_point goal = random_walkable_tile(grid, gen);
+			Path_status a = finder.find_path(grid, start, goal, astar_path);
+			Path_status j = finder.find_path_jps(grid, start, goal, jps_path);
+			if (a != j) {
+				mismatches++;
+				continue;
+			}
+			if (a != Path_status::found) continue;
+			found++;
+
+			// JPS must be optimal too, both must be legal step by step
+			uint32_t cost = path_cost(grid, astar_path);
+			if (cost == UINT32_MAX || cost != path_cost(grid, jps_path) || !(astar_path.front() == start) || !(jps_path.back() == goal))
+				mismatches++;
+
+			// Following the flow field costs the same as the A* path
+			finder.build_flow_field(grid, goal, field);
+			std::vector<Tile_point> flow_path = {start};
+			while (!(flow_path.back() == goal) && flow_path.size() < 64 * 64) flow_path.push_back(field.next(flow_path.back()));
+			if (path_cost(grid, flow_path) != cost) flow_errors++;
+		}
+	}
+	printf("[%s] A* vs JPS: %d of %d queries differ (%d paths found)\n", mismatches == 0 ? "PASS" : "FAIL", mismatches, queries, found);
+	printf("[%s] flow field paths with a different cost: %d\n", flow_errors == 0 ? "PASS" : "FAIL", flow_errors);
+
+	// Cache: hit, then blocking a tile on the path drops it, opening a tile drops everything
+	Path_cache cache(4);
+	grid = Nav_grid(64, 64);
+	Tile_point start = {2, 2}, goal = {60, 2};
+	finder.find_path_jps(grid, start, goal, jps_path);
+	cache.store(start, goal, jps_path);
+	finder.find_path_jps(grid, {0, 0}, {5, 5}, astar_path);
+	cache.store({0, 0}, {5, 5}, astar_path);
+	bool hit = cache.find(start, goal) != nullptr;
+	grid.set_walkable(30, 2, false);
+	cache.tile_changed(30, 2, false);
+	bool dropped = cache.find(start, goal) == nullptr && cache.find({0, 0}, {5, 5}) != nullptr;
+	grid.set_walkable(30, 2, true);
+	cache.tile_changed(30, 2, true);
+	bool cleared = cache.find({0, 0}, {5, 5}) == nullptr;
+	printf("[%s] path cache: hit %d, blocked tile drops path %d, opened tile clears %d\n", hit && dropped && cleared ? "PASS" : "FAIL", hit, dropped, cleared);
+
+	// A blocked corner tile of a diagonal step breaks the path too
+	cache.clear();
+	const std::vector<Tile_point> diagonal = {{0, 0}, {1, 1}, {2, 2}, {3, 3}};
+	cache.store({0, 0}, {3, 3}, diagonal);
+	cache.tile_changed(5, 0, false);
+	bool kept = cache.find({0, 0}, {3, 3}) != nullptr;
+	cache.tile_changed(1, 0, false);
+	bool corner_dropped = cache.find({0, 0}, {3, 3}) == nullptr;
+	printf("[%s] path cache: far tile keeps path %d, blocked corner drops it %d\n", kept && corner_dropped ? "PASS" : "FAIL", kept, corner_dropped);
+
+	// 256x256: the last tile (index 65535) is a parent like any other
+	Nav_grid corner_grid(256, 256);
+	for (int y = 0; y < 256; y++) {
+		for (int x = 0; x < 256; x++) corner_grid.set_walkable(x, y, (y == 255 && x >= 250) || (x == 255 && y >= 250));
+	}
+	Pathfinder big_finder(256, 256, 1024);
+	Tile_point corner_start = {250, 255}, corner_goal = {255, 250};
+	bool astar_ok = big_finder.find_path(corner_grid, corner_start, corner_goal, astar_path) == Path_status::found &&
+		astar_path.size() == 11 && astar_path.front() == corner_start && astar_path.back() == corner_goal;
+	bool jps_ok = big_finder.find_path_jps(corner_grid, corner_start, corner_goal, jps_path) == Path_status::found &&
+		jps_path.size() == 11 && jps_path.front() == corner_start && jps_path.back() == corner_goal;
+	printf("[%s] path through tile (255, 255): A* %d, JPS %d\n", astar_ok && jps_ok ? "PASS" : "FAIL", astar_ok, jps_ok);
+
+	// Serpentine over the whole 256x256 map: the path costs more than 0xFFFF
+	Nav_grid maze(256, 256);
+	for (int y = 1; y < 256; y += 2) {
+		for (int x = 0; x < 256; x++) maze.set_walkable(x, y, x == ((y / 2) % 2 ? 0 : 255));
+	}
+	Tile_point maze_start = {0, 0}, maze_goal = {0, 254};
+	astar_ok = big_finder.find_path(maze, maze_start, maze_goal, astar_path) == Path_status::found;
+	jps_ok = big_finder.find_path_jps(maze, maze_start, maze_goal, jps_path) == Path_status::found;
+	uint32_t maze_cost = astar_ok ? path_cost(maze, astar_path) : 0;
+	bool long_ok = astar_ok && jps_ok && maze_cost > 0xFFFF && maze_cost == path_cost(maze, jps_path);
+	printf("[%s] long route: A* %d, JPS %d, cost %u\n", long_ok ? "PASS" : "FAIL", astar_ok, jps_ok, maze_cost);
+}
+
+void pathfinding_benchmark() {
+
+	for (int blocked : {5, 20})
+	for (uint16_t size : {uint16_t(64), uint16_t(256)}) {
+		Nav_grid grid(size, size);
+		nav_grid_random(grid, 1, blocked);
+		Pathfinder finder(size, size, size * 64);
+		Path_cache cache(16);
+		Flow_field field;
+		std::vector<Tile_point> path;
+
+		const int queries = 200;
+		Random::Xoshiro128 gen(5);
+		std::vector<Tile_point> starts(queries), goals(queries);
+		for (int q = 0; q < queries; q++) {
+			starts[q] = random_walkable_tile(grid, gen);
+			goals[q] = random_walkable_tile(grid, gen);
+		}
+
+		auto measure = [&](auto&& body) {
+			auto start = std::chrono::steady_clock::now();
+			body();
+			return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / queries;
+		};
+
+		uint64_t astar_nodes = 0, jps_nodes = 0;
+		double astar_us = measure([&] {
+			for (int q = 0; q < queries; q++) {
+				finder.find_path(grid, starts[q], goals[q], path);
+				astar_nodes += finder.nodes_expanded();
+			}
+		});
+		double jps_us = measure([&] {
+			for (int q = 0; q < queries; q++) {
+				finder.find_path_jps(grid, starts[q], goals[q], path);
+				jps_nodes += finder.nodes_expanded();
+			}
+		});
+		// 16 agents walking to 16 goals again and again: only the first request searches
+		double cached_us = measure([&] {
+			for (int q = 0; q < queries; q++) {
+				int k = q % 16;
+				if (cache.find(starts[k], goals[k]) == nullptr) {
+					finder.find_path_jps(grid, starts[k], goals[k], path);
+					cache.store(starts[k], goals[k], path);
+				}
+			}
+		});
+		double flow_us = measure([&] {
+			for (int q = 0; q < queries; q++) finder.build_flow_field(grid, goals[q], field);
+		});
+
+		printf("[BENCH] %ux%u map, %d%% blocked, per query: A* %.1f us (%llu nodes), JPS %.1f us (%llu nodes), cached %.2f us, flow field %.1f us\n",
+			size, size, blocked, astar_us, static_cast<unsigned long long>(astar_nodes / queries), jps_us,
+			static_cast<unsigned long long>(jps_nodes / queries), cached_us, flow_us);
+	}
+}
+
+// SpritePixel copy of a generated sprite (planes), for the blits that take SpritePixel
+static std::vector<SpritePixel> unpack_sprite(const Sprite_planes& sprite) {
+	std::vector<SpritePixel> pixels(sprite.width * sprite.height);
+	for (size_t i = 0; i < pixels.size(); i++) pixels[i] = {sprite.color[i], sprite.alpha[i]};
+	return pixels;
+}
+
+static const std::vector<SpritePixel> wizard_pixels = unpack_sprite(wizard_sprite);
+static const std::vector<SpritePixel> wizard2_pixels = unpack_sprite(wizard2_sprite);
+static const std::vector<SpritePixel> skeleton_alpha_pixels = unpack_sprite(skeleton_alpha_sprite);
+
+struct Atlas_test_sprite {
+	uint16_t frame;
+	uint16_t width;
+	uint16_t height;
+	const SpritePixel* data;
+	const Sprite_planes* planes;
+};
+
+static const Atlas_test_sprite atlas_test_sprites[] = {
+	{characters_frame_wizard, wizard_width, wizard_height, wizard_pixels.data(), &wizard_sprite},
+	{characters_frame_wizard2, wizard2_width, wizard2_height, wizard2_pixels.data(), &wizard2_sprite},
+	{characters_frame_skeleton_alpha, skeleton_alpha_width, skeleton_alpha_height, skeleton_alpha_pixels.data(), &skeleton_alpha_sprite},
+};
+
+void sprite_atlas_test() {
+
+	std::vector<uint16_t> expected(DISPLAY_WIDTH * DISPLAY_HEIGHT);
+	int mismatches = 0;
+
+	// Fully on screen: trimmed frame + offset gives the same pixels as the original sprite
+	for (const Atlas_test_sprite& sprite : atlas_test_sprites) {
+		fill_with_color(COLORS[3].value);
+		draw_sprite_alpha(40, sprite.height, 50, sprite.width, sprite.data);
+		std::copy(back_buffer, back_buffer + DISPLAY_WIDTH * DISPLAY_HEIGHT, expected.begin());
+
+		fill_with_color(COLORS[3].value);
+		draw_sprite_region(characters_atlas, sprite.frame, 50, 40);
+		mismatches += !std::equal(expected.begin(), expected.end(), back_buffer);
+	}
+	printf("[%s] atlas frames match the separate sprites (%d mismatches)\n", mismatches == 0 ? "PASS" : "FAIL", mismatches);
+
+	// Partly off screen on every edge: visible part matches the sprite drawn at (50, 40) shifted
+	const int positions[][2] = {{-20, -15}, {DISPLAY_WIDTH - 30, -15}, {-20, DISPLAY_HEIGHT - 25}, {DISPLAY_WIDTH - 30, DISPLAY_HEIGHT - 25}};
+	int clip_mismatches = 0;
+	for (const Atlas_test_sprite& sprite : atlas_test_sprites) {
+		fill_with_color(COLORS[3].value);
+		draw_sprite_alpha(40, sprite.height, 50, sprite.width, sprite.data);
+		std::copy(back_buffer, back_buffer + DISPLAY_WIDTH * DISPLAY_HEIGHT, expected.begin());
+
+		for (const auto& position : positions) {
+			int x = position[0];
+			int y = position[1];
+			fill_with_color(COLORS[3].value);
+			draw_sprite_region(characters_atlas, sprite.frame, x, y);
+			for (int row = 0; row < DISPLAY_HEIGHT; row++) {
+				for (int col = 0; col < DISPLAY_WIDTH; col++) {
+					int sx = col - x, sy = row - y;
+					bool inside = sx >= 0 && sy >= 0 && sx < sprite.width && sy < sprite.height;
+					uint16_t want = inside ? expected[(40 + sy) * DISPLAY_WIDTH + 50 + sx] : COLORS[3].value;
+					clip_mismatches += back_buffer[row * DISPLAY_WIDTH + col] != want;
+				}
+			}
+		}
+	}
+	// Fully off screen and bad frame ids draw nothing
+	fill_with_color(COLORS[3].value);
+	draw_sprite_region(characters_atlas, characters_frame_wizard, -100, 10);
+	draw_sprite_region(characters_atlas, characters_frame_wizard, DISPLAY_WIDTH, 10);
+	printf("  expected errors:\n");
+	draw_sprite_region(characters_atlas, characters_frame_count, 10, 10);
+	clip_mismatches += std::count(back_buffer, back_buffer + DISPLAY_WIDTH * DISPLAY_HEIGHT, COLORS[3].value) != DISPLAY_WIDTH * DISPLAY_HEIGHT;
+	printf("[%s] clipped atlas blits (%d wrong pixels)\n", clip_mismatches == 0 ? "PASS" : "FAIL", clip_mismatches);
+}
+
+void sprite_atlas_benchmark() {
+
+	const int sprites = 2000;
+	const int frames = 50;
+	Random::Xoshiro128 gen(3);
+	std::vector<int> xs(sprites), ys(sprites), kinds(sprites);
+	for (int i = 0; i < sprites; i++) {
+		xs[i] = gen.range(0, DISPLAY_WIDTH - 64);
+		ys[i] = gen.range(0, DISPLAY_HEIGHT - 64);
+		kinds[i] = gen.range(0, 2);
+	}
+
+	auto measure = [&](auto&& body) {
+		auto start = std::chrono::steady_clock::now();
+		for (int f = 0; f < frames; f++) body();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+	};
+
+	double separate_ms = measure([&] {
+		for (int i = 0; i < sprites; i++) {
+			const Atlas_test_sprite& sprite = atlas_test_sprites[kinds[i]];
+			draw_sprite_alpha(ys[i], sprite.height, xs[i], sprite.width, sprite.data);
+		}
+	});
+	double planes_ms = measure([&] {
+		for (int i = 0; i < sprites; i++) draw_sprite_planes(*atlas_test_sprites[kinds[i]].planes, xs[i], ys[i]);
+	});
+	double atlas_ms = measure([&] {
+		for (int i = 0; i < sprites; i++) draw_sprite_region(characters_atlas, atlas_test_sprites[kinds[i]].frame, xs[i], ys[i]);
+	});
+
+	size_t separate_pixels = wizard_width * wizard_height + wizard2_width * wizard2_height + skeleton_alpha_width * skeleton_alpha_height;
+	size_t atlas_bytes = characters_atlas.width * characters_atlas.height * 3 + characters_frame_count * sizeof(Atlas_frame);
+	printf("[BENCH] %d sprites per frame: separate %.2f ms, planes %.2f ms, atlas %.2f ms; data %zu B separate, %zu B planes, %zu B atlas\n",
+		sprites, separate_ms, planes_ms, atlas_ms, separate_pixels * sizeof(SpritePixel), separate_pixels * 3, atlas_bytes);
+}
+
+void sprite_planes_test() {
+
+	int failures = 0;
+	auto expect = [&](bool ok, const char* what) {
+		if (!ok && failures++ < 10) printf("[FAIL] %s\n", what);
+	};
+	std::vector<uint16_t> expected(DISPLAY_WIDTH * DISPLAY_HEIGHT);
+	auto same_pixels = [&](auto&& reference, auto&& planes) {
+		fill_with_color(COLORS[3].value);
+		reference();
+		std::copy(back_buffer, back_buffer + DISPLAY_WIDTH * DISPLAY_HEIGHT, expected.begin());
+		fill_with_color(COLORS[3].value);
+		planes();
+		return std::equal(expected.begin(), expected.end(), back_buffer);
+	};
+
+	Sprite_transform flip;
+	flip.flip_x = true;
+	flip.flip_y = true;
+	Sprite_transform rotate;
+	rotate.angle = Fixed_math::to_angle(Fixed_math::PI / 5);
+	rotate.scale_x = Fixed_q16(1.5);
+	Sprite_transform stretch;
+	stretch.scale_y = Fixed_q16(2.25);
+
+	// Same pixels as the SpritePixel blits, on screen and clipped on every edge
+	const int positions[][2] = {{50, 40}, {-20, -15}, {DISPLAY_WIDTH - 30, -15}, {-20, DISPLAY_HEIGHT - 25}, {DISPLAY_WIDTH - 30, DISPLAY_HEIGHT - 25}};
+	for (const Atlas_test_sprite& s : atlas_test_sprites) {
+		for (const auto& p : positions) {
+			const int x = p[0], y = p[1];
+			expect(same_pixels([&] { draw_sprite_alpha(y, s.height, x, s.width, s.data); },
+				[&] { draw_sprite_planes(*s.planes, x, y); }), "draw_sprite_planes matches draw_sprite_alpha");
+			for (const Sprite_transform* t : {&flip, &rotate, &stretch}) {
+				expect(same_pixels([&] { draw_sprite_transformed(x, y, s.width, s.height, s.data, *t); },
+					[&] { draw_sprite_transformed(*s.planes, x, y, *t); }), "transformed planes match transformed SpritePixel");
+			}
+		}
+	}
+
+	// Strip renderer, planes against SpritePixel commands
+	Strip_renderer strips(DISPLAY_WIDTH, DISPLAY_HEIGHT, 16, 64);
+	std::vector<uint16_t> frames[2];
+	for (int layout = 0; layout < 2; layout++) {
+		strips.begin(COLORS[4].value);
+		for (int i = 0; i < 12; i++) {
+			const Atlas_test_sprite& s = atlas_test_sprites[i % 3];
+			const int x = i * 29 - 40, y = i * 23 - 30;
+			if (layout == 0) strips.draw_sprite_alpha(x, y, s.width, s.height, s.data);
+			else strips.draw_sprite_planes(*s.planes, x, y);
+		}
+		frames[layout].assign(DISPLAY_WIDTH * DISPLAY_HEIGHT, 0);
+		strips.render([&](uint16_t y, uint16_t count, uint16_t* pixels) {
+			std::copy(pixels, pixels + DISPLAY_WIDTH * count, &frames[layout][y * DISPLAY_WIDTH]);
+		});
+	}
+	expect(frames[0] == frames[1], "strip planes match strip SpritePixel");
+
+	// 3 bytes per pixel, one copy in the program
+	expect(sizeof(wizard_color) + sizeof(wizard_alpha) == size_t(wizard_width) * wizard_height * 3, "3 bytes per pixel");
+	printf("[%s] sprite planes (%d failures)\n", failures == 0 ? "PASS" : "FAIL", failures);
+}
+
+// Clips over the characters atlas: walk (loop), bounce (ping-pong), die (once)
+static const Animation_frame anim_walk_frames[] = {
+	{characters_frame_wizard, Fixed_q16(0.1)},
+	{characters_frame_wizard2, Fixed_q16(0.1)},
+};
+static const Animation_frame anim_bounce_frames[] = {
+	{characters_frame_wizard, Fixed_q16(0.1)},
+	{characters_frame_wizard2, Fixed_q16(0.1)},
+	{characters_frame_skeleton_alpha, Fixed_q16(0.1)},
+};
+static const Animation_frame anim_die_frames[] = {
+	{characters_frame_wizard2, Fixed_q16(0.1)},
+	{characters_frame_skeleton_alpha, Fixed_q16(0.2)},
+};
+static const Animation_clip anim_clips[] = {
+	{anim_walk_frames, 2, Animation_mode::loop},
+	{anim_bounce_frames, 3, Animation_mode::ping_pong},
+	{anim_die_frames, 2, Animation_mode::once},
+};
+enum : uint16_t { ANIM_WALK, ANIM_BOUNCE, ANIM_DIE };
+
+void animation_test() {
+
+	Animation_system animations(anim_clips);
+	const Fixed_q16 dt(0.05);
+	const uint16_t W = characters_frame_wizard, W2 = characters_frame_wizard2, S = characters_frame_skeleton_alpha;
+
+	// Atlas frame after each update
+	const uint16_t walk_expected[] = {W, W2, W2, W, W, W2, W2, W};
+	const uint16_t bounce_expected[] = {W, W2, W2, S, S, W2, W2, W, W, W2, W2, S};
+	const uint16_t die_expected[] = {W2, S, S, S, S, S, S};
+	animations.play(0, ANIM_WALK);
+	animations.play(1, ANIM_BOUNCE);
+	animations.play(2, ANIM_DIE);
+
+	bool walk_ok = true, bounce_ok = true, die_ok = true;
+	for (int step = 0; step < 12; step++) {
+		animations.update(dt);
+		if (step < 8) walk_ok &= animations.atlas_frame(0) == walk_expected[step];
+		bounce_ok &= animations.atlas_frame(1) == bounce_expected[step];
+		if (step < 7) die_ok &= animations.atlas_frame(2) == die_expected[step] && animations.finished(2) == (step >= 5);
+	}
+	printf("[%s] loop %d, ping-pong %d, once %d\n", walk_ok && bounce_ok && die_ok ? "PASS" : "FAIL", walk_ok, bounce_ok, die_ok);
+
+	// One long step lands on the same frame as many short ones (whole cycles are skipped)
+	bool long_ok = true;
+	for (uint16_t clip : {ANIM_WALK, ANIM_BOUNCE, ANIM_DIE}) {
+		for (int steps : {7, 2000, 2001}) {
+			animations.play(10, clip);
+			for (int s = 0; s < steps; s++) animations.update(dt);
+			Animation_system single(anim_clips);
+			single.play(0, clip);
+			single.update(Fixed_q16::from_raw(dt.raw * steps));
+			long_ok &= single.atlas_frame(0) == animations.atlas_frame(10);
+		}
+	}
+	printf("[%s] long dt matches stepped updates\n", long_ok ? "PASS" : "FAIL");
+
+	// Remove swaps the last animation in, the rest keep their state
+	Animation_system removal(anim_clips);
+	for (uint32_t id = 0; id < 5; id++) removal.play(id, ANIM_BOUNCE);
+	removal.update(dt * 3);
+	removal.remove(1);
+	removal.update(dt * 2);
+	bool removed_ok = !removal.contains(1) && removal.size() == 4;
+	for (uint32_t id : {0u, 2u, 3u, 4u}) removed_ok &= removal.contains(id) && removal.atlas_frame(id) == S;
+	removal.play(1, ANIM_WALK);
+	removed_ok &= removal.size() == 5 && removal.atlas_frame(1) == W;
+	printf("[%s] remove / replay keeps the other animations\n", removed_ok ? "PASS" : "FAIL");
+}
+
+void animation_benchmark() {
+
+	const uint32_t entities = 10000;
+	const int frames = 1000;
+	const Fixed_q16 dt = Fixed_q16(1) / 60;
+
+	// Clips with different frame lengths so entities change frames on different updates
+	std::vector<std::vector<Animation_frame>> frame_lists;
+	std::vector<Animation_clip> clips;
+	for (int c = 0; c < 8; c++) {
+		std::vector<Animation_frame> list;
+		for (int f = 0; f < 4 + c; f++) list.push_back({static_cast<uint16_t>(f % characters_frame_count), Fixed_q16(0.05 + 0.01 * c)});
+		frame_lists.push_back(std::move(list));
+	}
+	for (int c = 0; c < 8; c++) {
+		Animation_mode mode = c % 3 == 0 ? Animation_mode::ping_pong : Animation_mode::loop;
+		clips.push_back({frame_lists[c].data(), static_cast<uint16_t>(frame_lists[c].size()), mode});
+	}
+
+	Animation_system animations(clips);
+	Random::Xoshiro128 gen(4);
+	for (uint32_t id = 0; id < entities; id++) animations.play(id, static_cast<uint16_t>(gen.range(0, 7)));
+
+	// Update + what the render queue reads
+	uint32_t checksum = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (int f = 0; f < frames; f++) {
+		animations.update(dt);
+		for (uint16_t atlas_frame : animations.atlas_frames()) checksum += atlas_frame;
+	}
+	double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+
+	printf("[BENCH] %u animations: %.3f ms per frame (%.1f ns per entity), checksum %u\n",
+		entities, ms, ms * 1e6 / entities, checksum);
+}
+
+void indexed_framebuffer_test() {
+
+	namespace Indexed = Indexed_framebuffer;
+	const int pixels = DISPLAY_WIDTH * DISPLAY_HEIGHT;
+	Random::Xoshiro128 gen(6);
+
+	uint16_t colors[9];
+	for (int i = 0; i < 9; i++) colors[i] = COLORS[i].value;
+	Indexed::set_palette(0, colors, 9);
+
+	// Sprite with a transparent border and holes
+	const int sprite_w = 37, sprite_h = 23;
+	std::vector<uint8_t> sprite_pixels(sprite_w * sprite_h);
+	for (int i = 0; i < sprite_w * sprite_h; i++) sprite_pixels[i] = gen.bounded(4) == 0 ? Indexed::TRANSPARENT : 1 + gen.bounded(8);
+	Indexed_sprite sprite = {sprite_w, sprite_h, sprite_pixels.data()};
+
+	// Random rects and sprites, partly off screen, against a per pixel reference
+	std::vector<uint8_t> expected(pixels, 4);
+	Indexed::fill_with_color(4);
+	for (int n = 0; n < 200; n++) {
+		int x = gen.range(-60, DISPLAY_WIDTH + 10);
+		int y = gen.range(-60, DISPLAY_HEIGHT + 10);
+		bool is_sprite = n % 2;
+		int w = is_sprite ? sprite_w : gen.range(0, 80);
+		int h = is_sprite ? sprite_h : gen.range(0, 80);
+		uint8_t color = 1 + gen.bounded(8);
+		if (is_sprite) Indexed::draw_sprite(sprite, x, y);
+		else Indexed::draw_rectangle(x, y, w, h, color);
+
+		for (int row = 0; row < h; row++)
+			for (int col = 0; col < w; col++) {
+				int px = x + col, py = y + row;
+				if (px < 0 || py < 0 || px >= DISPLAY_WIDTH || py >= DISPLAY_HEIGHT) continue;
+				uint8_t value = is_sprite ? sprite_pixels[row * sprite_w + col] : color;
+				if (is_sprite && value == Indexed::TRANSPARENT) continue;
+				expected[py * DISPLAY_WIDTH + px] = value;
+			}
+	}
+	bool draw_ok = std::equal(expected.begin(), expected.end(), Indexed::back_buffer);
+	printf("[%s] clipped rects and sprites match the reference\n", draw_ok ? "PASS" : "FAIL");
+
+	// Expansion goes through the palette, rotating it recolors without redrawing
+	Indexed::swap_buffers();
+	std::vector<uint16_t> rgb(pixels);
+	Indexed::expand(rgb.data());
+	bool expand_ok = true;
+	for (int i = 0; i < pixels; i++) expand_ok &= rgb[i] == COLORS[expected[i]].value;
+
+	Indexed::rotate_palette(1, 8);
+	Indexed::expand(rgb.data());
+	bool rotate_ok = Indexed::palette[0] == COLORS[0].value && Indexed::palette[1] == COLORS[8].value;
+	for (int i = 0; i < pixels; i++) {
+		uint8_t index = expected[i];
+		rotate_ok &= rgb[i] == COLORS[index == 1 ? 8 : index - 1].value;
+	}
+	printf("[%s] palette expand %d, rotate %d\n", expand_ok && rotate_ok ? "PASS" : "FAIL", expand_ok, rotate_ok);
+
+	// 4bpp sprites: odd width, odd and even clipping, banks into the 256 entries
+	std::vector<uint8_t> nibbles(sprite_w * sprite_h);
+	std::vector<uint8_t> packed(((sprite_w + 1) / 2) * sprite_h, 0);
+	for (int row = 0; row < sprite_h; row++)
+		for (int col = 0; col < sprite_w; col++) {
+			uint8_t value = gen.bounded(4) == 0 ? 0 : 1 + gen.bounded(15);
+			nibbles[row * sprite_w + col] = value;
+			packed[row * ((sprite_w + 1) / 2) + col / 2] |= (col & 1) ? value : value << 4;
+		}
+	Indexed_sprite_4bpp sprite_4bpp = {sprite_w, sprite_h, packed.data()};
+
+	std::fill(expected.begin(), expected.end(), 4);
+	Indexed::fill_with_color(4);
+	for (int n = 0; n < 200; n++) {
+		int x = gen.range(-60, DISPLAY_WIDTH + 10);
+		int y = gen.range(-60, DISPLAY_HEIGHT + 10);
+		uint8_t bank = static_cast<uint8_t>(gen.bounded(16) * 16);
+		Indexed::draw_sprite(sprite_4bpp, x, y, bank);
+
+		for (int row = 0; row < sprite_h; row++)
+			for (int col = 0; col < sprite_w; col++) {
+				int px = x + col, py = y + row;
+				if (px < 0 || py < 0 || px >= DISPLAY_WIDTH || py >= DISPLAY_HEIGHT) continue;
+				uint8_t value = nibbles[row * sprite_w + col];
+				if (value) expected[py * DISPLAY_WIDTH + px] = bank + value;
+			}
+	}
+	bool draw_4bpp_ok = std::equal(expected.begin(), expected.end(), Indexed::back_buffer);
+	printf("[%s] clipped 4bpp sprites with banks match the reference\n", draw_4bpp_ok ? "PASS" : "FAIL");
+
+	// Far off screen: x + width does not fit an int, nothing may be drawn
+	Indexed::draw_sprite(sprite_4bpp, INT32_MAX - 2, 0, 16);
+	Indexed::draw_sprite(sprite_4bpp, 0, INT32_MAX - 2, 16);
+	Indexed::draw_sprite(sprite_4bpp, INT32_MIN, INT32_MIN, 16);
+	Indexed::draw_rectangle(INT32_MAX - 2, INT32_MAX - 2, 100, 100, 9);
+	Indexed::set_pixel(-65536 + 5, 3, 9);			// a uint16_t x would wrap to 5
+	Indexed::set_pixel(3, -65536 + 5, 9);
+	Indexed::set_pixel(-1, -1, 9);
+	bool far_ok = std::equal(expected.begin(), expected.end(), Indexed::back_buffer);
+	printf("[%s] sprites, rectangles and pixels far off screen draw nothing\n", far_ok ? "PASS" : "FAIL");
+}
+
+void indexed_framebuffer_benchmark() {
+
+	namespace Indexed = Indexed_framebuffer;
+	const int frames = 50;
+	const int sprites = 2000;
+	Random::Xoshiro128 gen(7);
+
+	std::vector<uint8_t> indexed_pixels(32 * 32);
+	std::vector<uint16_t> rgb_pixels(32 * 32);
+	for (int i = 0; i < 32 * 32; i++) {
+		indexed_pixels[i] = 1 + gen.bounded(8);
+		rgb_pixels[i] = COLORS[indexed_pixels[i]].value;
+	}
+	Indexed_sprite sprite = {32, 32, indexed_pixels.data()};
+	std::vector<uint8_t> packed_pixels(16 * 32);
+	for (int i = 0; i < 16 * 32; i++) packed_pixels[i] = static_cast<uint8_t>(indexed_pixels[i * 2] << 4 | indexed_pixels[i * 2 + 1]);
+	Indexed_sprite_4bpp sprite_4bpp = {32, 32, packed_pixels.data()};
+	std::vector<int> xs(sprites), ys(sprites);
+	for (int i = 0; i < sprites; i++) {
+		xs[i] = gen.range(0, DISPLAY_WIDTH - 32);
+		ys[i] = gen.range(0, DISPLAY_HEIGHT - 32);
+	}
+
+	auto measure = [&](auto&& body) {
+		auto start = std::chrono::steady_clock::now();
+		for (int f = 0; f < frames; f++) body();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+	};
+
+	double rgb_ms = measure([&] {
+		fill_with_color(COLORS[4].value);
+		for (int i = 0; i < sprites; i++) {
+			for (int row = 0; row < 32; row++) {
+				uint16_t* dst = &back_buffer[(ys[i] + row) * DISPLAY_WIDTH + xs[i]];
+				for (int col = 0; col < 32; col++) {
+					uint16_t pixel = rgb_pixels[row * 32 + col];
+					if (pixel == 0x1FF8) continue;		// transparency key, like draw_sprite
+					dst[col] = pixel;
+				}
+			}
+		}
+	});
+	double indexed_ms = measure([&] {
+		Indexed::fill_with_color(4);
+		for (int i = 0; i < sprites; i++) Indexed::draw_sprite(sprite, xs[i], ys[i]);
+	});
+	// Odd positions included: the 4bpp blit starts on either nibble
+	double packed_ms = measure([&] {
+		Indexed::fill_with_color(4);
+		for (int i = 0; i < sprites; i++) Indexed::draw_sprite(sprite_4bpp, xs[i], ys[i]);
+	});
+	double expand_ms = measure([&] { Indexed::expand(back_buffer); });
+
+	printf("[BENCH] %dx%d, %d 32x32 sprites: RGB565 %.2f ms, 8bpp %.2f ms, 4bpp %.2f ms, + expand %.2f ms; buffers %u KB vs %u KB\n",
+		DISPLAY_WIDTH, DISPLAY_HEIGHT, sprites, rgb_ms, indexed_ms, packed_ms, expand_ms,
+		2 * DISPLAY_WIDTH * DISPLAY_HEIGHT * 2 / 1024, 2 * DISPLAY_WIDTH * DISPLAY_HEIGHT / 1024);
+	printf("[BENCH] sprite data per 32x32: RGB565+Alpha8 %d B, 8bpp %d B, 4bpp %d B\n", 32 * 32 * 3, 32 * 32, 16 * 32);
+}
+
+void palette_cycling_test() {
+
+	namespace Indexed = Indexed_framebuffer;
+
+	// 16 shade ramp, diagonal stripes cycle through it
+	uint16_t ramp[16];
+	for (int i = 0; i < 16; i++) ramp[i] = static_cast<uint16_t>(((i * 2) << 11) | ((i * 4) << 5) | 31);
+	Indexed::set_palette(1, ramp, 16);
+
+	for (int y = 0; y < DISPLAY_HEIGHT; y++)
+		for (int x = 0; x < DISPLAY_WIDTH; x++)
+			Indexed::set_pixel(x, y, 1 + ((x + y) / 16) % 16);
+	Indexed::swap_buffers();
+
+	while (!glfwWindowShouldClose(g_window)) {
+		glfwPollEvents();
+		Indexed::rotate_palette(1, 16);
+		Indexed::expand(back_buffer);
+		fps_counter();
+		swap_buffers();
+		present_frame();
+		std::this_thread::sleep_for(50ms);
+	}
+}
+
+// Same scene drawn immediately and through a Strip_renderer: rects, alpha sprites, clipped atlas frames
+template<typename Draw_rect, typename Draw_sprite, typename Draw_region>
+void strip_scene(uint32_t seed, int count, Draw_rect&& rect, Draw_sprite&& sprite, Draw_region&& region) {
+	Random::Xoshiro128 gen(seed);
+	for (int i = 0; i < count; i++) {
+		switch (gen.bounded(3)) {
+			case 0: {
+				int w = gen.range(1, 100), h = gen.range(1, 100);
+				rect(gen.range(0, DISPLAY_WIDTH - w), gen.range(0, DISPLAY_HEIGHT - h), w, h, COLORS[gen.bounded(9)].value);
+				break;
+			}
+			case 1: {
+				const Atlas_test_sprite& s = atlas_test_sprites[gen.bounded(3)];
+				sprite(gen.range(0, DISPLAY_WIDTH - s.width), gen.range(0, DISPLAY_HEIGHT - s.height), s.width, s.height, s.data);
+				break;
+			}
+			default:
+				region(gen.bounded(characters_frame_count), gen.range(-64, DISPLAY_WIDTH), gen.range(-64, DISPLAY_HEIGHT));
+		}
+	}
+}
+
+void strip_renderer_test() {
+
+	fill_with_color(COLORS[4].value);
+	strip_scene(8, 300,
+		[](int x, int y, int w, int h, uint16_t color) { draw_rectangle_memset(y, h, x, w, color); },
+		[](int x, int y, int w, int h, const SpritePixel* data) { draw_sprite_alpha(y, h, x, w, data); },
+		[](uint16_t frame, int x, int y) { draw_sprite_region(characters_atlas, frame, x, y); });
+	std::vector<uint16_t> expected(back_buffer, back_buffer + DISPLAY_WIDTH * DISPLAY_HEIGHT);
+
+	for (uint16_t lines : {uint16_t(1), uint16_t(7), uint16_t(16), uint16_t(64), DISPLAY_HEIGHT}) {
+		Strip_renderer strips(DISPLAY_WIDTH, DISPLAY_HEIGHT, lines, 512);
+		strips.begin(COLORS[4].value);
+		strip_scene(8, 300,
+			[&](int x, int y, int w, int h, uint16_t color) { strips.draw_rectangle(x, y, w, h, color); },
+			[&](int x, int y, int w, int h, const SpritePixel* data) { strips.draw_sprite_alpha(x, y, w, h, data); },
+			[&](uint16_t frame, int x, int y) { strips.draw_sprite_region(characters_atlas, frame, x, y); });
+
+		// Display simulation: every strip lands at its address window
+		std::vector<uint16_t> display(DISPLAY_WIDTH * DISPLAY_HEIGHT, 0);
+		uint32_t next_y = 0;
+		bool order_ok = true;
+		strips.render([&](uint16_t y, uint16_t count, uint16_t* pixels) {
+			order_ok &= y == next_y;
+			next_y = y + count;
+			std::copy(pixels, pixels + DISPLAY_WIDTH * count, &display[y * DISPLAY_WIDTH]);
+		});
+		bool ok = order_ok && next_y == DISPLAY_HEIGHT && display == expected;
+		printf("[%s] %u line strips match the full framebuffer (%u commands)\n", ok ? "PASS" : "FAIL", lines, static_cast<unsigned>(strips.command_count()));
+	}
+}
+
+void strip_renderer_benchmark() {
+
+	const int frames = 20;
+	auto measure = [&](auto&& body) {
+		auto start = std::chrono::steady_clock::now();
+		for (int f = 0; f < frames; f++) body();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+	};
+
+	// Reference: immediate mode into the full framebuffer
+	double full_ms = measure([&] {
+		fill_with_color(COLORS[4].value);
+		strip_scene(9, 400,
+			[](int x, int y, int w, int h, uint16_t color) { draw_rectangle_memset(y, h, x, w, color); },
+			[](int x, int y, int w, int h, const SpritePixel* data) { draw_sprite_alpha(y, h, x, w, data); },
+			[](uint16_t frame, int x, int y) { draw_sprite_region(characters_atlas, frame, x, y); });
+	});
+	printf("[BENCH] %ux%u full framebuffer: %.2f ms per frame, %u KB for 2 frames\n",
+		DISPLAY_WIDTH, DISPLAY_HEIGHT, full_ms, 2 * DISPLAY_WIDTH * DISPLAY_HEIGHT * 2 / 1024);
+
+	std::vector<uint16_t> display(DISPLAY_WIDTH * DISPLAY_HEIGHT);
+	for (uint16_t lines : {uint16_t(8), uint16_t(16), uint16_t(32), uint16_t(64), uint16_t(128)}) {
+		Strip_renderer strips(DISPLAY_WIDTH, DISPLAY_HEIGHT, lines, 512);
+		double ms = measure([&] {
+			strips.begin(COLORS[4].value);
+			strip_scene(9, 400,
+				[&](int x, int y, int w, int h, uint16_t color) { strips.draw_rectangle(x, y, w, h, color); },
+				[&](int x, int y, int w, int h, const SpritePixel* data) { strips.draw_sprite_alpha(x, y, w, h, data); },
+				[&](uint16_t frame, int x, int y) { strips.draw_sprite_region(characters_atlas, frame, x, y); });
+			strips.render([&](uint16_t y, uint16_t count, uint16_t* pixels) {
+				std::copy(pixels, pixels + DISPLAY_WIDTH * count, &display[y * DISPLAY_WIDTH]);
+			});
+		});
+		printf("[BENCH] %ux%u, %3u line strips: %.2f ms per frame, %u KB for 2 strips (480x320 ST7796S: %u KB)\n",
+			DISPLAY_WIDTH, DISPLAY_HEIGHT, lines, ms, 2 * DISPLAY_WIDTH * lines * 2 / 1024, 2 * 480 * lines * 2 / 1024);
+	}
+}
+
+void upscale_test() {
+
+	const uint16_t width = 37, height = 23;
+	std::vector<uint16_t> image(width * height);
+	Random::Xoshiro128 gen(10);
+	for (uint16_t& pixel : image) pixel = static_cast<uint16_t>(gen.next());
+
+	bool ok = true;
+	for (uint8_t scale = 1; scale <= 5; scale++) {
+		// Letterboxed into a wider destination, the border must stay untouched
+		const uint32_t scaled_width = width * scale;
+		const uint32_t scaled_height = height * scale;
+		const uint32_t stride = scaled_width + 11;
+		const uint32_t rows = scaled_height + 4;
+		std::vector<uint16_t> out(stride * rows, 0xBEEF);
+		upscale(image.data(), width, height, &out[2 * stride + 5], stride, scale);
+
+		for (uint32_t y = 0; y < rows; y++)
+			for (uint32_t x = 0; x < stride; x++) {
+				bool inside = y >= 2 && y < 2 + scaled_height && x >= 5 && x < 5 + scaled_width;
+				uint16_t want = inside ? image[(y - 2) / scale * width + (x - 5) / scale] : 0xBEEF;
+				ok &= out[y * stride + x] == want;
+			}
+	}
+	printf("[%s] nearest neighbour upscale x1..x5\n", ok ? "PASS" : "FAIL");
+}
+
+void upscale_benchmark() {
+
+	// Logical resolutions a game would use, scaled to fit this window
+	const uint16_t sizes[][2] = {{160, 128}, {240, 160}, {480, 320}, {DISPLAY_WIDTH, DISPLAY_HEIGHT}};
+	std::vector<uint16_t> window_pixels(WINDOW_WIDTH * WINDOW_HEIGHT);
+	const int frames = 100;
+
+	for (const auto& size : sizes) {
+		uint16_t width = size[0], height = size[1];
+		uint8_t scale = std::min(WINDOW_WIDTH / width, WINDOW_HEIGHT / height);
+		if (scale == 0) continue;
+		std::vector<uint16_t> image(width * height, COLORS[6].value);
+
+		auto start = std::chrono::steady_clock::now();
+		for (int f = 0; f < frames; f++) upscale(image.data(), width, height, window_pixels.data(), WINDOW_WIDTH, scale);
+		double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+
+		printf("[BENCH] %ux%u x%u -> %ux%u: %.3f ms per present, %ux fewer pixels to draw than the window\n",
+			width, height, scale, width * scale, height * scale, ms, (WINDOW_WIDTH * WINDOW_HEIGHT) / (width * height));
+	}
+}
+
+// Reference rasterizer for the clipping fuzz test: whole primitive, bounds check per pixel
+static void reference_plot(std::vector<uint16_t>& image, int64_t x, int64_t y, uint16_t color) {
+	if (x < 0 || y < 0 || x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) return;
+	image[y * DISPLAY_WIDTH + x] = color;
+}
+
+static void reference_blend(std::vector<uint16_t>& image, int64_t x, int64_t y, const SpritePixel& pixel) {
+	if (x < 0 || y < 0 || x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT || pixel.alpha < 10) return;
+	uint16_t& dst = image[y * DISPLAY_WIDTH + x];
+	dst = pixel.alpha == 255 ? pixel.color : blend_rgb565(dst, pixel);
+}
+
+static void reference_line(std::vector<uint16_t>& image, int64_t x0, int64_t y0, int64_t x1, int64_t y1, uint16_t color) {
+	// Same stepping as the original unclipped draw_line_bresenham
+	int64_t dx = x1 > x0 ? x1 - x0 : x0 - x1;
+	int64_t dy = y1 > y0 ? y1 - y0 : y0 - y1;
+	int sx = (x0 < x1) ? 1 : -1;
+	int sy = (y0 < y1) ? 1 : -1;
+	if (dx >= dy) {
+		int64_t y = y0, d = 2 * dy - dx;
+		for (int64_t x = x0; x != x1; x += sx) {
+			reference_plot(image, x, y, color);
+			if (d > 0) { y += sy; d -= 2 * dx; }
+			d += 2 * dy;
+		}
+	} else {
+		int64_t x = x0, d = 2 * dx - dy;
+		for (int64_t y = y0; y != y1; y += sy) {
+			reference_plot(image, x, y, color);
+			if (d > 0) { x += sx; d -= 2 * dy; }
+			d += 2 * dx;
+		}
+	}
+	reference_plot(image, x1, y1, color);
+}
+
+void clipping_fuzz_test() {
+
+	const int pixels = DISPLAY_WIDTH * DISPLAY_HEIGHT;
+	Random::Xoshiro128 gen(11);
+
+	// Opaque keyed sprite (0x1FF8 = transparent) next to the alpha sprites
+	const int key_w = 19, key_h = 13;
+	std::vector<uint16_t> keyed(key_w * key_h);
+	for (uint16_t& pixel : keyed) pixel = gen.bounded(4) == 0 ? 0x1FF8 : static_cast<uint16_t>(gen.next());
+
+	std::vector<uint16_t> expected(pixels);
+	fill_with_color(COLORS[4].value);
+	std::fill(expected.begin(), expected.end(), COLORS[4].value);
+
+	const char* names[] = {"set_pixel", "draw_line", "draw_rectangle", "draw_rectangle_memset", "draw_sprite", "draw_sprite_alpha", "draw_sprite_region", "draw_line_bresenham"};
+	int failures[8] = {};
+	const int ops = 4000;
+
+	for (int n = 0; n < ops; n++) {
+		int op = gen.bounded(8);
+		// Mostly around the screen, some far away
+		bool far = gen.bounded(10) == 0;
+		int span_x = far ? 100000 : 2 * DISPLAY_WIDTH;
+		int span_y = far ? 100000 : 2 * DISPLAY_HEIGHT;
+		int x = gen.range(-span_x, span_x);
+		int y = gen.range(-span_y, span_y);
+		if (!far && gen.bounded(2)) {
+			// Straddle an edge
+			x = gen.range(-80, DISPLAY_WIDTH + 10);
+			y = gen.range(-80, DISPLAY_HEIGHT + 10);
+		}
+		int w = gen.range(-5, 120);
+		int h = gen.range(-5, 120);
+		uint16_t color = static_cast<uint16_t>(gen.next());
+
+		switch (op) {
+			case 0:
+				set_pixel(x, y, color);
+				reference_plot(expected, x, y, color);
+				break;
+			case 1:
+				draw_line(x, y, w, color);
+				for (int i = 0; i < w; i++) reference_plot(expected, int64_t(x) + i, y, color);
+				break;
+			case 2:
+			case 3:
+				if (op == 2) draw_rectangle(y, h, x, w, color);
+				else draw_rectangle_memset(y, h, x, w, color);
+				for (int row = 0; row < h; row++)
+					for (int col = 0; col < w; col++) reference_plot(expected, int64_t(x) + col, int64_t(y) + row, color);
+				break;
+			case 4:
+				draw_sprite(y, key_h, x, key_w, keyed.data());
+				for (int row = 0; row < key_h; row++)
+					for (int col = 0; col < key_w; col++) {
+						uint16_t pixel = keyed[row * key_w + col];
+						if (pixel != 0x1FF8) reference_plot(expected, int64_t(x) + col, int64_t(y) + row, pixel);
+					}
+				break;
+			case 5: {
+				const Atlas_test_sprite& s = atlas_test_sprites[gen.bounded(3)];
+				draw_sprite_alpha(y, s.height, x, s.width, s.data);
+				for (int row = 0; row < s.height; row++)
+					for (int col = 0; col < s.width; col++) reference_blend(expected, int64_t(x) + col, int64_t(y) + row, s.data[row * s.width + col]);
+				break;
+			}
+			case 6: {
+				uint16_t frame_id = gen.bounded(characters_frame_count);
+				const Atlas_frame& frame = characters_atlas.frames[frame_id];
+				draw_sprite_region(characters_atlas, frame_id, x, y);
+				for (int row = 0; row < frame.height; row++)
+					for (int col = 0; col < frame.width; col++) {
+						int i = (frame.y + row) * characters_atlas.width + frame.x + col;
+						reference_blend(expected, int64_t(x) + frame.offset_x + col, int64_t(y) + frame.offset_y + row,
+							SpritePixel{characters_atlas.color[i], characters_atlas.alpha[i]});
+					}
+				break;
+			}
+			default: {
+				int x1 = far ? gen.range(-span_x, span_x) : gen.range(-DISPLAY_WIDTH, 2 * DISPLAY_WIDTH);
+				int y1 = far ? gen.range(-span_y, span_y) : gen.range(-DISPLAY_HEIGHT, 2 * DISPLAY_HEIGHT);
+				draw_line_bresenham(x, y, x1, y1, color);
+				reference_line(expected, x, y, x1, y1, color);
+			}
+		}
+		if (!std::equal(expected.begin(), expected.end(), back_buffer)) {
+			failures[op]++;
+			std::copy(back_buffer, back_buffer + pixels, expected.begin());	// keep going from the same state
+		}
+	}
+
+	int total = 0;
+	for (int op = 0; op < 8; op++) {
+		total += failures[op];
+		if (failures[op]) printf("[FAIL] %s: %d mismatches\n", names[op], failures[op]);
+	}
+	printf("[%s] %d random clipped draws match the reference rasterizer\n", total == 0 ? "PASS" : "FAIL", ops);
+
+	// Corners of the int range: empty clips, nothing drawn
+	const int extremes[] = {INT32_MIN, INT32_MIN + 1, INT32_MAX - 1, INT32_MAX};
+	for (int ex : extremes)
+		for (int ey : extremes) {
+			draw_rectangle(ey, key_h, ex, key_w, COLORS[1].value);
+			draw_sprite(ey, key_h, ex, key_w, keyed.data());
+			draw_sprite_region(characters_atlas, characters_frame_wizard, ex, ey);
+		}
+	bool extremes_ok = std::equal(expected.begin(), expected.end(), back_buffer);
+	printf("[%s] draws at INT_MIN / INT_MAX positions draw nothing\n", extremes_ok ? "PASS" : "FAIL");
+}
+
+void clipping_benchmark() {
+
+	// Scrolling view: most sprites fully visible, the ones on the edges clipped
+	const int sprites = 2000;
+	const int frames = 50;
+	Random::Xoshiro128 gen(12);
+	std::vector<int> xs(sprites), ys(sprites), kinds(sprites);
+	for (int i = 0; i < sprites; i++) {
+		xs[i] = gen.range(-64, DISPLAY_WIDTH);
+		ys[i] = gen.range(-64, DISPLAY_HEIGHT);
+		kinds[i] = gen.bounded(3);
+	}
+
+	auto measure = [&](auto&& body) {
+		auto start = std::chrono::steady_clock::now();
+		for (int f = 0; f < frames; f++) body();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+	};
+
+	double sprite_ms = measure([&] {
+		for (int i = 0; i < sprites; i++) {
+			const Atlas_test_sprite& s = atlas_test_sprites[kinds[i]];
+			draw_sprite_alpha(ys[i], s.height, xs[i], s.width, s.data);
+		}
+	});
+	double rect_ms = measure([&] {
+		for (int i = 0; i < sprites; i++) draw_rectangle_memset(ys[i], 48, xs[i], 48, COLORS[kinds[i]].value);
+	});
+	double line_ms = measure([&] {
+		for (int i = 0; i < sprites; i++) draw_line_bresenham(xs[i], ys[i], xs[(i + 1) % sprites], ys[(i + 1) % sprites], COLORS[kinds[i]].value);
+	});
+	printf("[BENCH] %d partly off screen draws per frame: alpha sprites %.2f ms, rects %.2f ms, lines %.2f ms\n",
+		sprites, sprite_ms, rect_ms, line_ms);
+}
+
+// Reference for draw_sprite_transformed: same inverse mapping, evaluated with multiplies at every screen pixel
+static void reference_transformed(std::vector<uint16_t>& image, int x, int y, int width, int height, const SpritePixel* sprite, const Sprite_transform& t) {
+	int64_t c = Fixed_math::cos(t.angle).raw;
+	int64_t s = Fixed_math::sin(t.angle).raw;
+	int64_t inv_x = (int64_t(1) << 32) / t.scale_x.raw;
+	int64_t inv_y = (int64_t(1) << 32) / t.scale_y.raw;
+	int64_t fx = t.flip_x ? -1 : 1;
+	int64_t fy = t.flip_y ? -1 : 1;
+	int64_t du_dx = fx * ((c * inv_x) >> 16), du_dy = fx * ((s * inv_x) >> 16);
+	int64_t dv_dx = fy * ((-s * inv_y) >> 16), dv_dy = fy * ((c * inv_y) >> 16);
+	int64_t pivot_x = (int64_t(x) << 16) + (int64_t(width) << 15);
+	int64_t pivot_y = (int64_t(y) << 16) + (int64_t(height) << 15);
+
+	for (int py = 0; py < DISPLAY_HEIGHT; py++) {
+		for (int px = 0; px < DISPLAY_WIDTH; px++) {
+			int64_t dx = (int64_t(px) << 16) + 0x8000 - pivot_x;
+			int64_t dy = (int64_t(py) << 16) + 0x8000 - pivot_y;
+			int64_t u = (int64_t(width) << 15) + ((du_dx * dx) >> 16) + ((du_dy * dy) >> 16);
+			int64_t v = (int64_t(height) << 15) + ((dv_dx * dx) >> 16) + ((dv_dy * dy) >> 16);
+			if (u < 0 || v < 0 || (u >> 16) >= width || (v >> 16) >= height) continue;
+			reference_blend(image, px, py, sprite[(v >> 16) * width + (u >> 16)]);
+		}
+	}
+}
+
+void sprite_transform_test() {
+
+	const int pixels = DISPLAY_WIDTH * DISPLAY_HEIGHT;
+	std::vector<uint16_t> expected(pixels);
+	Random::Xoshiro128 gen(21);
+	int failures = 0;
+
+	auto check = [&](const char* name, auto&& draw_expected, auto&& draw_transformed) {
+		fill_with_color(COLORS[3].value);
+		draw_expected();
+		std::copy(back_buffer, back_buffer + pixels, expected.begin());
+		fill_with_color(COLORS[3].value);
+		draw_transformed();
+		if (!std::equal(expected.begin(), expected.end(), back_buffer)) {
+			if (failures++ < 10) printf("[FAIL] %s\n", name);
+		}
+	};
+
+	for (int n = 0; n < 200; n++) {
+		const Atlas_test_sprite& s = atlas_test_sprites[gen.bounded(3)];
+		const int w = s.width, h = s.height;
+		int x = gen.range(-w, DISPLAY_WIDTH);
+		int y = gen.range(-h, DISPLAY_HEIGHT);
+
+		// Mirrored copies drawn with the 1:1 blitter
+		std::vector<SpritePixel> mirrored(w * h), rotated(w * h), doubled(4 * w * h);
+		for (int row = 0; row < h; row++)
+			for (int col = 0; col < w; col++) {
+				mirrored[row * w + col] = s.data[row * w + (w - 1 - col)];
+				rotated[row * w + col] = s.data[(h - 1 - row) * w + (w - 1 - col)];
+				for (int k = 0; k < 4; k++) doubled[(2 * row + k / 2) * 2 * w + 2 * col + k % 2] = s.data[row * w + col];
+			}
+
+		Sprite_transform identity;
+		Sprite_transform flip;
+		flip.flip_x = true;
+		Sprite_transform flip_both;
+		flip_both.flip_x = flip_both.flip_y = true;
+		Sprite_transform half_turn;
+		half_turn.angle = Fixed_math::ANGLE_180;
+		Sprite_transform doubled_scale;
+		doubled_scale.scale_x = doubled_scale.scale_y = 2;
+
+		check("identity == draw_sprite_alpha",
+			[&] { draw_sprite_alpha(y, h, x, w, s.data); },
+			[&] { draw_sprite_transformed(x, y, w, h, s.data, identity); });
+		check("flip_x == mirrored sprite",
+			[&] { draw_sprite_alpha(y, h, x, w, mirrored.data()); },
+			[&] { draw_sprite_transformed(x, y, w, h, s.data, flip); });
+		check("flip_x + flip_y == 180 degree sprite",
+			[&] { draw_sprite_alpha(y, h, x, w, rotated.data()); },
+			[&] { draw_sprite_transformed(x, y, w, h, s.data, flip_both); });
+		check("180 degree rotation (scanline path) == both flips",
+			[&] { draw_sprite_transformed(x, y, w, h, s.data, flip_both); },
+			[&] { draw_sprite_transformed(x, y, w, h, s.data, half_turn); });
+		if (w % 2 == 0 && h % 2 == 0) {
+			check("scale 2 == pixel doubled sprite",
+				[&] { draw_sprite_alpha(y - h / 2, 2 * h, x - w / 2, 2 * w, doubled.data()); },
+				[&] { draw_sprite_transformed(x, y, w, h, s.data, doubled_scale); });
+		}
+
+		// Any scale / angle / flip, against the per pixel reference
+		Sprite_transform t;
+		t.scale_x = Fixed_q16::from_raw(gen.range(1 << 12, 4 << 16));
+		t.scale_y = gen.bounded(2) ? t.scale_x : Fixed_q16::from_raw(gen.range(1 << 12, 4 << 16));
+		t.angle = static_cast<Fixed_math::Angle>(gen.next());
+		t.flip_x = gen.bounded(2);
+		t.flip_y = gen.bounded(2);
+		int far_x = gen.bounded(8) == 0 ? gen.range(-3000, 3000) : x;
+		fill_with_color(COLORS[3].value);
+		std::copy(back_buffer, back_buffer + pixels, expected.begin());
+		reference_transformed(expected, far_x, y, w, h, s.data, t);
+		draw_sprite_transformed(far_x, y, w, h, s.data, t);
+		if (!std::equal(expected.begin(), expected.end(), back_buffer)) {
+			if (failures++ < 10) printf("[FAIL] scale %.3f x %.3f angle %u flip %d %d at %d, %d\n",
+				t.scale_x.to_float(), t.scale_y.to_float(), t.angle, t.flip_x, t.flip_y, far_x, y);
+		}
+	}
+	printf("[%s] transformed sprites match 1:1 blits and the reference mapping (%d failures)\n", failures == 0 ? "PASS" : "FAIL", failures);
+}
+
+void sprite_transform_benchmark() {
+
+	const int sprites = 2000;
+	const int frames = 50;
+	Random::Xoshiro128 gen(22);
+	std::vector<int> xs(sprites), ys(sprites), kinds(sprites);
+	for (int i = 0; i < sprites; i++) {
+		xs[i] = gen.range(-32, DISPLAY_WIDTH);
+		ys[i] = gen.range(-32, DISPLAY_HEIGHT);
+		kinds[i] = gen.bounded(3);
+	}
+
+	auto measure = [&](const Sprite_transform* transform) {
+		auto start = std::chrono::steady_clock::now();
+		for (int f = 0; f < frames; f++) {
+			for (int i = 0; i < sprites; i++) {
+				const Atlas_test_sprite& s = atlas_test_sprites[kinds[i]];
+				if (transform) draw_sprite_transformed(xs[i], ys[i], s.width, s.height, s.data, *transform);
+				else draw_sprite_alpha(ys[i], s.height, xs[i], s.width, s.data);
+			}
+		}
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+	};
+
+	Sprite_transform flip;
+	flip.flip_x = true;
+	Sprite_transform scaled;
+	scaled.scale_x = scaled.scale_y = 1.5_q16;
+	Sprite_transform rotated;
+	rotated.angle = Fixed_math::to_angle(Fixed_math::PI / 6);
+
+	double plain_ms = measure(nullptr);
+	double flip_ms = measure(&flip);
+	double scaled_ms = measure(&scaled);
+	double rotated_ms = measure(&rotated);
+	printf("[BENCH] %d sprites per frame: 1:1 %.2f ms, flip_x %.2f ms, scale 1.5 %.2f ms (2.25x pixels), rotate 30 deg %.2f ms\n",
+		sprites, plain_ms, flip_ms, scaled_ms, rotated_ms);
+}
+
+void particle_test() {
+
+	int failures = 0;
+	auto expect = [&](bool ok, const char* what) {
+		if (!ok && failures++ < 10) printf("[FAIL] %s\n", what);
+	};
+
+	// 1/64 s step keeps the per step values exact
+	const Fixed_q16 step = Fixed_q16(1) / 64;
+
+	Particle_system capped(100, step);
+	Particle_emitter burst;
+	burst.spread = 0xFFFF;
+	burst.speed_max = 100;
+	expect(capped.emit(burst, 150) == 100 && capped.size() == 100, "emit stops at capacity");
+	expect(capped.emit(burst, 1) == 0, "full system emits nothing");
+
+	// Lifetime in steps: 0.5 s = 32 steps
+	Particle_system timed(10, step);
+	Particle_emitter short_lived;
+	short_lived.life_min = short_lived.life_max = 0.5_q16;
+	timed.emit(short_lived, 10);
+	for (int i = 0; i < 31; i++) timed.step();
+	expect(timed.size() == 10, "alive until the last step of their life");
+	timed.step();
+	expect(timed.size() == 0, "expired after life / step steps");
+
+	// Long lifetimes: 600 s at 1/64 is 38400 steps, past the Q16.16 quotient range; 2000 s clamps
+	Particle_system long_lived(2, step);
+	Particle_emitter slow;
+	slow.life_min = slow.life_max = 600;
+	long_lived.emit(slow, 1);
+	slow.life_min = slow.life_max = 2000;
+	long_lived.emit(slow, 1);
+	expect(long_lived.lifetimes()[0] == 38400 && long_lived.lifetimes()[1] == UINT16_MAX, "long lifetimes in 64 bit, clamped to 16 bit");
+
+	// Semi-implicit Euler: 1 px/step right, 1 px/step^2 down
+	Particle_system ballistic(1, step);
+	ballistic.set_gravity(0, 4096);
+	Particle_emitter cannon;
+	cannon.x = 10;
+	cannon.y = 20;
+	cannon.speed_min = cannon.speed_max = 64;
+	cannon.life_min = cannon.life_max = 10;
+	ballistic.emit(cannon, 1);
+	for (int n = 1; n <= 20; n++) {
+		ballistic.step();
+		expect(ballistic.xs()[0] == 10 + n && ballistic.ys()[0] == 20 + n * (n + 1) / 2, "trajectory matches the closed form");
+	}
+
+	// Fixed timestep accumulator
+	Particle_system clock(1, Fixed_q16(1) / 60);
+	expect(clock.update(Fixed_q16(1) / 30) == 2, "1/30 s runs 2 steps of 1/60");
+	expect(clock.update(Fixed_q16(1) / 120) + clock.update(Fixed_q16(1) / 120) == 1, "two 1/120 s updates run 1 step");
+	expect(clock.update(10) == Particle_system::MAX_STEPS, "long hitch is capped");
+	expect(clock.update(0) == 0, "dropped time is not replayed");
+
+	// Same seed and inputs, same particles
+	Particle_system a(1000, step, 7), b(1000, step, 7);
+	Particle_emitter fountain;
+	fountain.x = DISPLAY_WIDTH / 2;
+	fountain.y = DISPLAY_HEIGHT;
+	fountain.radius = 2;
+	fountain.direction = Fixed_math::ANGLE_270;
+	fountain.spread = 0x2000;
+	fountain.speed_min = 40;
+	fountain.speed_max = 120;
+	fountain.life_min = 0.5_q16;
+	fountain.life_max = 2;
+	a.set_gravity(0, 150);
+	b.set_gravity(0, 150);
+	for (int frame = 0; frame < 120; frame++) {
+		a.emit(fountain, 20);
+		b.emit(fountain, 20);
+		a.update(Fixed_q16(1) / 60);
+		b.update(Fixed_q16(1) / 60);
+	}
+	expect(a.size() == b.size() && std::equal(a.xs().begin(), a.xs().end(), b.xs().begin()) &&
+		std::equal(a.ys().begin(), a.ys().end(), b.ys().begin()), "deterministic for the same seed");
+
+	// Points land where the particles are, off screen ones are skipped
+	Particle_system dots(3, step);
+	static const uint16_t red[] = {0xF800};
+	Particle_emitter at;
+	at.colors = red;
+	at.x = 5;
+	at.y = 6;
+	dots.emit(at, 1);
+	at.x = -3;
+	dots.emit(at, 1);
+	at.x = DISPLAY_WIDTH + 5;
+	dots.emit(at, 1);
+	fill_with_color(0x0000);
+	dots.draw_points();
+	int lit = 0;
+	for (int i = 0; i < DISPLAY_WIDTH * DISPLAY_HEIGHT; i++) lit += back_buffer[i] != 0;
+	expect(lit == 1 && back_buffer[6 * DISPLAY_WIDTH + 5] == 0xF800, "draw_points plots on screen particles only");
+
+	printf("[%s] particle system (%d failures)\n", failures == 0 ? "PASS" : "FAIL", failures);
+}
+
+void particle_benchmark() {
+
+	// 50k sparks alive: 1000 emitted per frame with ~1 s life (60 steps)
+	const uint32_t particles = 50000;
+	Particle_system system(particles, Fixed_q16(1) / 60, 3);
+	system.set_gravity(0, 200);
+	static const uint16_t colors[] = {COLORS[5].value, COLORS[6].value, COLORS[7].value};
+	Particle_emitter sparks;
+	sparks.x = DISPLAY_WIDTH / 2;
+	sparks.y = DISPLAY_HEIGHT / 2;
+	sparks.radius = 4;
+	sparks.spread = 0xFFFF;
+	sparks.speed_min = 10;
+	sparks.speed_max = 100;
+	sparks.life_min = 0.8_q16;
+	sparks.life_max = 1.2_q16;
+	sparks.colors = colors;
+	for (int frame = 0; frame < 90; frame++) {
+		system.emit(sparks, particles / 50);
+		system.step();
+	}
+
+	const int frames = 200;
+	double emit_ms = 0, step_ms = 0, draw_ms = 0;
+	size_t alive = 0;
+	for (int frame = 0; frame < frames; frame++) {
+		auto t0 = std::chrono::steady_clock::now();
+		system.emit(sparks, particles / 60);
+		auto t1 = std::chrono::steady_clock::now();
+		system.step();
+		auto t2 = std::chrono::steady_clock::now();
+		fill_with_color(0x0000);
+		auto t3 = std::chrono::steady_clock::now();
+		system.draw_points();
+		auto t4 = std::chrono::steady_clock::now();
+		emit_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+		step_ms += std::chrono::duration<double, std::milli>(t2 - t1).count();
+		draw_ms += std::chrono::duration<double, std::milli>(t4 - t3).count();
+		alive += system.size();
+	}
+
+	// Hand rolled baseline: random set_pixel per point, like random_pixels_test
+	auto start = std::chrono::steady_clock::now();
+	for (int frame = 0; frame < 20; frame++) {
+		for (uint32_t i = 0; i < particles; i++) {
+			set_pixel(random_int_modulo(0, DISPLAY_WIDTH), random_int_modulo(0, DISPLAY_HEIGHT), COLORS[random_int_modulo(5, 7)].value);
+		}
+	}
+	double set_pixel_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / 20;
+
+	printf("[BENCH] %zu particles: step %.3f ms, draw_points %.3f ms, emit %u %.3f ms per frame; random set_pixel x %u %.3f ms\n",
+		alive / frames, step_ms / frames, draw_ms / frames, particles / 60, emit_ms / frames, particles, set_pixel_ms);
+}
+
+void particle_fountain_test() {
+
+	Particle_system system(20000);
+	system.set_gravity(0, 150);
+	static const uint16_t colors[] = {COLORS[5].value, COLORS[6].value, COLORS[7].value};
+	Particle_emitter fountain;
+	fountain.x = DISPLAY_WIDTH / 2;
+	fountain.y = DISPLAY_HEIGHT - 4;
+	fountain.radius = 2;
+	fountain.direction = Fixed_math::ANGLE_270;
+	fountain.spread = 0x2000;
+	fountain.speed_min = DISPLAY_HEIGHT / 2;
+	fountain.speed_max = DISPLAY_HEIGHT;
+	fountain.life_min = 1;
+	fountain.life_max = 3;
+	fountain.colors = colors;
+
+	while (!glfwWindowShouldClose(g_window)) {
+		glfwPollEvents();
+
+		system.emit(fountain, 100);
+		system.update(Fixed_q16(static_cast<float>(delta_time())));
+		fill_with_color(0x0000);
+		system.draw_points();
+		fps_counter();
+		swap_buffers();
+		present_frame();
+	}
+}
+
+// Small pack built in memory: header, sorted entries, aligned payloads
+static std::vector<uint32_t> make_test_pack(std::vector<Pack_entry> entries, const std::vector<std::vector<uint8_t>>& payloads) {
+	size_t offset = sizeof(Pack_header) + entries.size() * sizeof(Pack_entry);
+	for (size_t i = 0; i < entries.size(); i++) {
+		offset = (offset + PACK_ALIGNMENT - 1) / PACK_ALIGNMENT * PACK_ALIGNMENT;
+		entries[i].offset = static_cast<uint32_t>(offset);
+		entries[i].size = static_cast<uint32_t>(payloads[i].size());
+		offset += payloads[i].size();
+	}
+	std::vector<uint32_t> words((offset + 3) / 4, 0);		// uint32_t storage keeps it aligned
+	uint8_t* bytes = reinterpret_cast<uint8_t*>(words.data());
+	Pack_header header = {PACK_MAGIC, PACK_VERSION, static_cast<uint16_t>(entries.size()), sizeof(Pack_header), static_cast<uint32_t>(offset)};
+	memcpy(bytes, &header, sizeof(header));
+	for (size_t i = 0; i < entries.size(); i++) {
+		memcpy(bytes + sizeof(Pack_header) + i * sizeof(Pack_entry), &entries[i], sizeof(Pack_entry));
+		memcpy(bytes + entries[i].offset, payloads[i].data(), payloads[i].size());
+	}
+	return words;
+}
+
+void asset_pack_test() {
+
+	int failures = 0;
+	auto expect = [&](bool ok, const char* what) {
+		if (!ok && failures++ < 10) printf("[FAIL] %s\n", what);
+	};
+
+	// Shipped pack (tools/asset_packer) against the generated headers
+	Asset_pack pack;
+	expect(pack.open_file("assets/characters.pack"), "open assets/characters.pack");
+	struct { const char* name; const Sprite_planes& planes; } sprites[] = {
+		{"wizard", wizard_sprite},
+		{"wizard2", wizard2_sprite},
+		{"skeleton_alpha", skeleton_alpha_sprite},
+	};
+	for (const auto& expected : sprites) {
+		Sprite_asset sprite{};
+		bool found = pack.sprite(expected.name, sprite);
+		bool same = found && sprite.width == expected.planes.width && sprite.height == expected.planes.height;
+		for (int i = 0; same && i < sprite.width * sprite.height; i++) {
+			same = sprite.pixels[i].color == expected.planes.color[i] && sprite.pixels[i].alpha == expected.planes.alpha[i];
+		}
+		expect(same, "packed sprite matches its header");
+		// Zero copy: the view points into the mapping
+		expect(found && reinterpret_cast<const uint8_t*>(sprite.pixels) == pack.payload(*pack.find(expected.name)), "sprite is a view into the pack");
+	}
+
+	// Every type, built by hand
+	auto entry = [](const char* name, Asset_type type, uint16_t width, uint16_t height, uint16_t count) {
+		Pack_entry e{};
+		strncpy(e.name, name, PACK_NAME_LENGTH - 1);
+		e.type = type;
+		e.width = width;
+		e.height = height;
+		e.count = count;
+		return e;
+	};
+	std::vector<uint8_t> atlas_payload(PACK_ATLAS_FRAME_SIZE + 4 * 4 * PACK_SPRITE_PIXEL_SIZE, 0);
+	const uint16_t frame[8] = {0, 0, 2, 4, 1, 0, 4, 4};
+	memcpy(atlas_payload.data(), frame, sizeof(frame));
+	std::vector<Pack_entry> entries = {
+		entry("atlas", Asset_type::atlas, 4, 4, 1),
+		entry("beep", Asset_type::audio, 16, 1, 22050),
+		entry("level", Asset_type::tilemap, 3, 2, 0),
+		entry("tiles_pal", Asset_type::palette, 0, 0, 3),
+		entry("tree", Asset_type::indexed_sprite, 2, 2, 0),
+	};
+	std::vector<std::vector<uint8_t>> payloads = {
+		atlas_payload,
+		std::vector<uint8_t>(200, 0x80),
+		{1, 0, 2, 0, 3, 0, 4, 0, 5, 0, 6, 0},
+		{0x1F, 0xF8, 0xE0, 0x07, 0x00, 0xF8},
+		{0, 1, 2, 0},
+	};
+	std::vector<uint32_t> memory = make_test_pack(entries, payloads);
+	const uint8_t* bytes = reinterpret_cast<const uint8_t*>(memory.data());
+	size_t size = memory.size() * 4;
+
+	Asset_pack typed;
+	expect(typed.open_memory(bytes, size), "open_memory on a valid pack");
+	Sprite_atlas atlas{};
+	Tilemap_asset level{};
+	Palette_asset palette{};
+	Indexed_sprite tree{};
+	Audio_asset beep{};
+	Sprite_asset wrong{};
+	expect(typed.atlas("atlas", atlas) && atlas.frame_count == 1 && atlas.frames[0].height == 4 && atlas.frames[0].offset_x == 1, "atlas view");
+	expect(typed.tilemap("level", level) && level.width == 3 && level.height == 2 && level.tiles[5] == 6, "tilemap view");
+	expect(typed.palette("tiles_pal", palette) && palette.count == 3 && palette.colors[1] == 0x07E0, "palette view");
+	expect(typed.indexed_sprite("tree", tree) && tree.width == 2 && tree.pixels[2] == 2, "indexed sprite view");
+	expect(typed.audio("beep", beep) && beep.sample_rate == 22050 && beep.bits == 16 && beep.size == 200, "audio view");
+	printf("  expected errors:\n");
+	expect(!typed.sprite("level", wrong), "type mismatch is refused");
+	expect(!typed.sprite("missing", wrong), "missing name is refused");
+
+	// Damaged packs are refused at open, nothing is trusted later
+	auto corrupt = [&](auto&& damage) {
+		std::vector<uint32_t> copy = memory;
+		damage(reinterpret_cast<uint8_t*>(copy.data()));
+		Asset_pack broken;
+		return !broken.open_memory(reinterpret_cast<const uint8_t*>(copy.data()), size);
+	};
+	auto toc = [](uint8_t* pack, size_t i) { return reinterpret_cast<Pack_entry*>(pack + sizeof(Pack_header)) + i; };
+	expect(corrupt([](uint8_t* p) { p[0] ^= 0xFF; }), "bad magic");
+	expect(corrupt([&](uint8_t* p) { toc(p, 2)->offset = static_cast<uint32_t>(size); }), "payload past the end");
+	expect(corrupt([&](uint8_t* p) { toc(p, 2)->width = 100; }), "size does not match the type");
+	expect(corrupt([&](uint8_t* p) { std::swap(*toc(p, 0), *toc(p, 1)); }), "unsorted entries");
+	expect(corrupt([&](uint8_t* p) { reinterpret_cast<uint16_t*>(p + toc(p, 0)->offset)[2] = 9; }), "atlas frame outside the atlas");
+	expect(corrupt([&](uint8_t* p) { reinterpret_cast<Pack_header*>(p)->file_size = static_cast<uint32_t>(size) + 1; }), "header larger than the data");
+
+	printf("[%s] asset pack (%d failures)\n", failures == 0 ? "PASS" : "FAIL", failures);
+}
+
+void asset_pack_benchmark() {
+
+	// Open + look up the 3 character sprites: mmap pack vs reading the .sprite files
+	const int runs = 200;
+	const char* names[] = {"wizard", "wizard2", "skeleton_alpha"};
+	uint32_t checksum = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	for (int r = 0; r < runs; r++) {
+		Asset_pack pack;
+		pack.open_file("assets/characters.pack");
+		for (const char* name : names) {
+			Sprite_asset sprite{};
+			if (pack.sprite(name, sprite)) checksum += sprite.pixels[sprite.width * sprite.height / 2].alpha;
+		}
+	}
+	double pack_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / runs;
+
+	start = std::chrono::steady_clock::now();
+	for (int r = 0; r < runs; r++) {
+		for (const char* name : names) {
+			std::ifstream in(std::string("assets/") + name + ".sprite", std::ios::binary);
+			uint16_t size[2] = {};
+			in.read(reinterpret_cast<char*>(size), 4);
+			std::vector<SpritePixel> pixels(size[0] * size[1]);
+			for (SpritePixel& pixel : pixels) {
+				uint8_t raw[3];
+				in.read(reinterpret_cast<char*>(raw), 3);
+				pixel = {static_cast<uint16_t>(raw[0] | (raw[1] << 8)), raw[2]};
+			}
+			if (!pixels.empty()) checksum += pixels[pixels.size() / 2].alpha;
+		}
+	}
+	double files_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / runs;
+
+	printf("[BENCH] load 3 sprites: pack mmap %.1f us, .sprite files read + convert %.1f us (checksum %u)\n", pack_us, files_us, checksum);
+}
+
+void lz_stream_test() {
+
+	int failures = 0;
+	auto expect = [&](bool ok, const char* what) {
+		if (!ok && failures++ < 10) printf("[FAIL] %s\n", what);
+	};
+
+	// Compressed pack (asset_packer -c) decodes to the same bytes as the plain one
+	Asset_pack plain;
+	Asset_pack packed;
+	expect(plain.open_file("assets/characters.pack"), "open assets/characters.pack");
+	expect(packed.open_file("assets/characters_lz.pack"), "open assets/characters_lz.pack");
+	for (const char* name : {"wizard", "wizard2", "skeleton_alpha"}) {
+		const Pack_entry* entry = plain.find(name);
+		Lz_stream stream;
+		bool found = entry && packed.stream(name, stream) && stream.raw_size() == entry->size;
+		expect(found, "compressed entry found with its raw size");
+		if (!found) continue;
+		const uint8_t* expected = plain.payload(*entry);
+
+		std::vector<uint8_t> whole(stream.raw_size());
+		expect(stream.decode_all(whole.data(), whole.size()) && memcmp(whole.data(), expected, whole.size()) == 0, "decode_all matches");
+
+		// Chunk by chunk through one window
+		std::vector<uint8_t> window(stream.chunk_size());
+		std::vector<uint8_t> joined(stream.raw_size());
+		bool decoded = stream.decode_chunks(window.data(), window.size(), [&](uint32_t offset, const uint8_t* data, uint32_t size) {
+			memcpy(&joined[offset], data, size);
+		});
+		expect(decoded && joined == whole, "decode_chunks matches");
+	}
+	printf("  expected errors:\n");
+	Sprite_asset refused{};
+	expect(!packed.sprite("wizard", refused), "typed view of a compressed entry is refused");
+
+	// Round trips through the tool compressor: runs, text like data, noise (stored chunks), odd sizes
+	Random::Xoshiro128 noise(7);
+	for (int round = 0; round < 40; round++) {
+		std::vector<uint8_t> raw(1 + noise.next() % 20000);
+		int kind = round % 3;
+		for (size_t i = 0; i < raw.size(); i++) {
+			if (kind == 0) raw[i] = static_cast<uint8_t>((i / (1 + round)) & 3);
+			else if (kind == 1) raw[i] = (i > 64 && noise.next() % 8) ? raw[i - 1 - noise.next() % 64] : static_cast<uint8_t>(noise.next());
+			else raw[i] = static_cast<uint8_t>(noise.next());
+		}
+		uint32_t chunk_size = 16u << (round % 13);
+		if (chunk_size > LZ_MAX_CHUNK_SIZE) chunk_size = LZ_MAX_CHUNK_SIZE;
+		std::vector<uint8_t> compressed = lz_compress_stream(raw, chunk_size);
+		Lz_stream stream;
+		std::vector<uint8_t> out(raw.size());
+		expect(stream.open(compressed.data(), compressed.size()) && stream.decode_all(out.data(), out.size()) && out == raw, "round trip");
+		expect(kind != 2 || stream.chunk(0).stored, "noise is stored");
+	}
+
+	// Damaged streams are refused or fail to decode, never write out of the window
+	std::vector<uint8_t> raw(5000);
+	for (size_t i = 0; i < raw.size(); i++) raw[i] = static_cast<uint8_t>(i % 97);
+	std::vector<uint8_t> good = lz_compress_stream(raw, 4096);
+	Lz_stream stream;
+	expect(!stream.open(good.data(), good.size() - 1), "truncated stream");
+	std::vector<uint8_t> bad = good;
+	reinterpret_cast<Lz_header*>(bad.data())->raw_size = 9000;
+	expect(!stream.open(bad.data(), bad.size()), "raw size does not match the chunks");
+	bad = good;
+	reinterpret_cast<uint32_t*>(bad.data() + sizeof(Lz_header))[0] = 0xFFFF;
+	expect(!stream.open(bad.data(), bad.size()), "chunk table past the end");
+	std::vector<uint8_t> window(4096 + 64);
+	for (size_t i = sizeof(Lz_header) + 8; i < good.size(); i += 3) {
+		bad = good;
+		bad[i] ^= 0x5A;
+		if (!stream.open(bad.data(), bad.size())) continue;
+		for (uint32_t c = 0; c < stream.chunk_count(); c++) {
+			window[4096] = 0xEE;
+			int32_t size = stream.decode(c, window.data(), 4096);
+			expect(size <= 4096 && window[4096] == 0xEE, "corrupt chunk stays in its window");
+		}
+	}
+	// Match reaching before the window start
+	const uint8_t before_start[] = {0x10, 'a', 0x05, 0x00, 0x50, 'a', 'a', 'a', 'a', 'a'};
+	expect(Lz_stream::decode({before_start, sizeof(before_start), 13, false}, window.data(), window.size()) < 0, "offset before the window start");
+
+	printf("[%s] lz stream (%d failures)\n", failures == 0 ? "PASS" : "FAIL", failures);
+}
+
+void lz_benchmark() {
+
+	// Ratio and decode speed on the character sprites, per chunk into a window
+	// (what a streaming load does) and whole payloads
+	Asset_pack packed;
+	if (!packed.open_file("assets/characters_lz.pack")) return;
+	const int runs = 2000;
+	size_t raw_total = 0;
+	size_t packed_total = 0;
+	uint32_t checksum = 0;
+	std::vector<uint8_t> window(LZ_MAX_CHUNK_SIZE);
+	std::vector<uint8_t> whole;
+	double chunk_s = 0;
+	double whole_s = 0;
+
+	for (const Pack_entry& entry : packed.entries()) {
+		Lz_stream stream;
+		if (!packed.stream(entry.name, stream)) continue;
+		raw_total += stream.raw_size();
+		packed_total += entry.size;
+		whole.resize(stream.raw_size());
+
+		auto start = std::chrono::steady_clock::now();
+		for (int r = 0; r < runs; r++) {
+			stream.decode_chunks(window.data(), window.size(), [&](uint32_t, const uint8_t* data, uint32_t size) { checksum += data[size / 2]; });
+		}
+		auto t1 = std::chrono::steady_clock::now();
+		for (int r = 0; r < runs; r++) {
+			stream.decode_all(whole.data(), whole.size());
+			checksum += whole[r % whole.size()];
+		}
+		auto t2 = std::chrono::steady_clock::now();
+		chunk_s += std::chrono::duration<double>(t1 - start).count();
+		whole_s += std::chrono::duration<double>(t2 - t1).count();
+	}
+	if (raw_total == 0) return;
+	double megabytes = double(raw_total) * runs / 1e6;
+	printf("[BENCH] lz sprites: %zu -> %zu bytes (%.1f%%)\n", raw_total, packed_total, 100.0 * packed_total / raw_total);
+	printf("[BENCH] lz decode: chunks into window %.0f MB/s, whole payloads %.0f MB/s (checksum %u)\n",
+		megabytes / chunk_s, megabytes / whole_s, checksum);
+}
+
+// .level with a tile id computable from its position, edge chunks padded with 0
+static std::vector<uint8_t> make_test_level(uint16_t width, uint16_t height, uint16_t chunk_width, uint16_t chunk_height) {
+	Level_header header = {LEVEL_MAGIC, LEVEL_VERSION, 0, width, height, chunk_width, chunk_height};
+	int chunks_x = (width + chunk_width - 1) / chunk_width;
+	int chunks_y = (height + chunk_height - 1) / chunk_height;
+	std::vector<uint16_t> tiles;
+	for (int cy = 0; cy < chunks_y; cy++) {
+		for (int cx = 0; cx < chunks_x; cx++) {
+			for (int y = cy * chunk_height; y < (cy + 1) * chunk_height; y++) {
+				for (int x = cx * chunk_width; x < (cx + 1) * chunk_width; x++) {
+					tiles.push_back((x < width && y < height) ? static_cast<uint16_t>((x * 31 + y * 17) & 0x7FFF) : 0);
+				}
+			}
+		}
+	}
+	std::vector<uint8_t> file(sizeof(header) + tiles.size() * 2);
+	memcpy(file.data(), &header, sizeof(header));
+	memcpy(file.data() + sizeof(header), tiles.data(), tiles.size() * 2);
+	return file;
+}
+
+static bool write_test_file(const std::string& path, const std::vector<uint8_t>& bytes) {
+	std::ofstream out(path, std::ios::binary);
+	return static_cast<bool>(out.write(reinterpret_cast<const char*>(bytes.data()), bytes.size()));
+}
+
+// Camera path in tiles: right, diagonal down right, then back left
+static void level_camera(int frame, int speed, int32_t& x, int32_t& y) {
+	int leg = 100;
+	if (frame < leg) { x = frame * speed; y = 0; }
+	else if (frame < 2 * leg) { x = leg * speed + (frame - leg) * speed; y = (frame - leg) * speed / 2; }
+	else { x = 2 * leg * speed - (frame - 2 * leg) * speed; y = leg * speed / 2; }
+}
+
+void level_stream_test() {
+
+	int failures = 0;
+	auto expect = [&](bool ok, const char* what) {
+		if (!ok && failures++ < 10) printf("[FAIL] %s\n", what);
+	};
+	const int32_t view_w = 20;
+	const int32_t view_h = 15;
+	auto view_matches = [&](const Level_stream& level, int32_t vx, int32_t vy) {
+		for (int32_t y = vy; y < vy + view_h; y++) {
+			for (int32_t x = vx; x < vx + view_w; x++) {
+				if (level.tile(x, y) != static_cast<uint16_t>((x * 31 + y * 17) & 0x7FFF)) return false;
+			}
+		}
+		return true;
+	};
+
+	// 300x200 tiles (not a multiple of the chunk size) in 16x16 chunks
+	std::vector<uint8_t> file = make_test_level(300, 200, 16, 16);
+	Memory_level_storage memory(file.data(), static_cast<uint32_t>(file.size()));
+	Level_stream level(memory, 16);
+	expect(level.open() && level.width() == 300 && level.chunk_height() == 16, "open from memory");
+	expect(level.load_view(280, 185, view_w, view_h) && view_matches(level, 280, 185), "load_view at the level corner");
+	expect(level.tile(300, 0) == LEVEL_TILE_MISSING && level.tile(-1, 5) == LEVEL_TILE_MISSING, "outside the level");
+	expect(level.chunk(0, 0) == nullptr && level.tile(0, 0) == LEVEL_TILE_MISSING, "far chunk not loaded");
+
+	// Host file throttled like an SD card, camera moving every 2 ms frame
+	std::string path = (std::filesystem::temp_directory_path() / "pocketgate_test.level").string();
+	expect(write_test_file(path, file), "write the test level");
+	for (uint16_t prefetch : {uint16_t(16), uint16_t(0)}) {
+		File_level_storage sd;
+		expect(sd.open(path.c_str()), "open the test level");
+		sd.set_throttle(1500, 2 * 1024 * 1024);
+		Level_stream streamed(sd, 16);
+		expect(streamed.open(), "open from file");
+		streamed.set_prefetch(prefetch);
+		expect(streamed.load_view(0, 0, view_w, view_h), "load_view at the start");
+
+		int wrong = 0;
+		for (int frame = 0; frame < 300; frame++) {
+			int32_t x, y;
+			level_camera(frame, 1, x, y);
+			streamed.update(x, y, view_w, view_h);
+			if (streamed.view_loaded(x, y, view_w, view_h) && !view_matches(streamed, x, y)) wrong++;
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+		}
+		expect(wrong == 0, "loaded tiles match the file");
+		// A turn gives no warning, the frame after it may still miss the new row
+		if (prefetch) expect(streamed.stats().misses <= 2, "prefetch: view loaded except at turns");
+		else expect(streamed.stats().misses > 0, "no prefetch: the view waits for chunks");
+		printf("  prefetch %2u: %u reads, %u missed frames\n", prefetch, streamed.stats().reads, streamed.stats().misses);
+	}
+
+	printf("  expected errors:\n");
+	Level_stream too_small(memory, 2);
+	expect(too_small.open() && !too_small.load_view(8, 8, view_w, view_h), "view larger than the regions");
+	std::vector<uint8_t> bad = file;
+	bad[0] ^= 0xFF;
+	Memory_level_storage bad_magic(bad.data(), static_cast<uint32_t>(bad.size()));
+	expect(!Level_stream(bad_magic, 16).open(), "bad magic");
+	Memory_level_storage truncated(file.data(), static_cast<uint32_t>(file.size() - 1));
+	expect(!Level_stream(truncated, 16).open(), "truncated level");
+	std::remove(path.c_str());
+
+	printf("[%s] level stream (%d failures)\n", failures == 0 ? "PASS" : "FAIL", failures);
+}
+
+void level_stream_benchmark() {
+
+	// 1024x1024 tiles (2 MB) in 32x32 chunks, 24 regions (48 KB) for a 160x128 view of 8 px tiles.
+	// Frames are 4 ms and the SD throttle is scaled the same way (60 fps, 2 ms + 1 MB/s SD).
+	std::vector<uint8_t> file = make_test_level(1024, 1024, 32, 32);
+	std::string path = (std::filesystem::temp_directory_path() / "pocketgate_bench.level").string();
+	if (!write_test_file(path, file)) return;
+	const int32_t view_w = 20;
+	const int32_t view_h = 16;
+
+	for (int speed : {1, 2, 4}) {
+		for (uint16_t prefetch : {uint16_t(32), uint16_t(0)}) {
+			File_level_storage sd;
+			if (!sd.open(path.c_str())) return;
+			sd.set_throttle(500, 4 * 1024 * 1024);
+			Level_stream level(sd, 24);
+			level.open();
+			level.set_prefetch(prefetch);
+			level.load_view(0, 0, view_w, view_h);
+
+			double update_us = 0;
+			const int frames = 300;
+			for (int frame = 0; frame < frames; frame++) {
+				int32_t x, y;
+				level_camera(frame, speed, x, y);
+				auto start = std::chrono::steady_clock::now();
+				level.update(x, y, view_w, view_h);
+				update_us += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+				std::this_thread::sleep_for(std::chrono::milliseconds(4));
+			}
+			printf("[BENCH] level stream %d tiles/frame, prefetch %2u: %3u missed frames of %d, %u reads, update %.2f us\n",
+				speed, prefetch, level.stats().misses, frames, level.stats().reads, update_us / frames);
+		}
+	}
+	std::remove(path.c_str());
+}
+
+// FAT32 card image built in memory: MBR, one partition, 2 FATs, directories with long names.
+// Clusters are handed out in order, gap leaves free clusters between them (fragmented files).
+struct Test_fat_image {
+	static const uint32_t PARTITION_LBA = 64;
+	static const uint32_t RESERVED = 32;
+	std::vector<uint8_t> image;
+	uint8_t cluster_sectors;
+	uint32_t fat_sectors;
+	uint32_t fat_lba = PARTITION_LBA + RESERVED;
+	uint32_t data_lba;
+	uint32_t next_free = 3;
+	std::map<uint32_t, std::vector<uint32_t>> directories;		// first cluster -> chain
+	std::map<uint32_t, uint32_t> entry_count;
+
+	Test_fat_image(uint32_t megabytes, uint8_t sectors_per_cluster) : cluster_sectors(sectors_per_cluster) {
+		uint32_t sectors = megabytes * 2048;
+		image.assign(size_t(sectors) * BLOCK_SIZE, 0);
+		fat_sectors = ((sectors - PARTITION_LBA) / cluster_sectors + 2) * 4 / BLOCK_SIZE + 1;
+		data_lba = fat_lba + 2 * fat_sectors;
+
+		uint8_t* mbr = &image[0];
+		mbr[446 + 4] = 0x0C;
+		put32(mbr + 446 + 8, PARTITION_LBA);
+		put32(mbr + 446 + 12, sectors - PARTITION_LBA);
+		put16(mbr + 510, 0xAA55);
+
+		uint8_t* boot = &image[PARTITION_LBA * BLOCK_SIZE];
+		boot[0] = 0xEB;
+		put16(boot + 11, BLOCK_SIZE);
+		boot[13] = cluster_sectors;
+		put16(boot + 14, RESERVED);
+		boot[16] = 2;
+		put32(boot + 32, sectors - PARTITION_LBA);
+		put32(boot + 36, fat_sectors);
+		put32(boot + 44, 2);
+		put16(boot + 510, 0xAA55);
+
+		link({0x0FFFFFF8, 0x0FFFFFFF});			// media and reserved entries
+		directories[2] = {2};
+		link_chain({2});
+	}
+
+	static void put16(uint8_t* p, uint16_t v) { p[0] = v & 0xFF; p[1] = v >> 8; }
+	static void put32(uint8_t* p, uint32_t v) { put16(p, v & 0xFFFF); put16(p + 2, v >> 16); }
+	uint32_t cluster_bytes() const { return cluster_sectors * BLOCK_SIZE; }
+	uint8_t* cluster(uint32_t c) { return &image[(size_t(data_lba) + (c - 2) * cluster_sectors) * BLOCK_SIZE]; }
+
+	void set_fat(uint32_t c, uint32_t value) {
+		for (uint32_t fat = 0; fat < 2; fat++) put32(&image[size_t(fat_lba + fat * fat_sectors) * BLOCK_SIZE + c * 4], value);
+	}
+	void link(const std::vector<uint32_t>& values) {
+		for (uint32_t i = 0; i < values.size(); i++) set_fat(i, values[i]);
+	}
+	void link_chain(const std::vector<uint32_t>& chain) {
+		for (size_t i = 0; i < chain.size(); i++) set_fat(chain[i], i + 1 < chain.size() ? chain[i + 1] : 0x0FFFFFFF);
+	}
+	std::vector<uint32_t> allocate(uint32_t count, uint32_t gap) {
+		std::vector<uint32_t> chain;
+		for (uint32_t i = 0; i < count; i++, next_free += 1 + gap) chain.push_back(next_free);
+		link_chain(chain);
+		return chain;
+	}
+
+	// 32 byte slot of a directory, the directory grows by one (non adjacent) cluster when full
+	uint8_t* slot(uint32_t directory) {
+		return entry(directory, entry_count[directory]++);
+	}
+	uint8_t* entry(uint32_t directory, uint32_t index) {
+		std::vector<uint32_t>& chain = directories[directory];
+		uint32_t per_cluster = cluster_bytes() / 32;
+		while (index / per_cluster >= chain.size()) {
+			chain.push_back(allocate(1, 2)[0]);
+			link_chain(chain);
+		}
+		return cluster(chain[index / per_cluster]) + (index % per_cluster) * 32;
+	}
+
+	void add_entry(uint32_t directory, const char* long_name, const char* short_name, uint8_t attributes, uint32_t first, uint32_t size) {
+		uint8_t checksum = 0;
+		for (int i = 0; i < 11; i++) checksum = static_cast<uint8_t>(((checksum & 1) << 7) + (checksum >> 1) + short_name[i]);
+		if (long_name) {
+			static const uint8_t positions[13] = {1, 3, 5, 7, 9, 14, 16, 18, 20, 22, 24, 28, 30};
+			size_t length = strlen(long_name);
+			int pieces = static_cast<int>((length + 12) / 13);
+			for (int order = pieces; order >= 1; order--) {
+				uint8_t* e = slot(directory);
+				e[0] = static_cast<uint8_t>(order | (order == pieces ? 0x40 : 0));
+				e[11] = 0x0F;
+				e[13] = checksum;
+				for (int i = 0; i < 13; i++) {
+					size_t at = (order - 1) * 13 + i;
+					put16(e + positions[i], at < length ? long_name[at] : at == length ? 0x0000 : 0xFFFF);
+				}
+			}
+		}
+		uint8_t* e = slot(directory);
+		memcpy(e, short_name, 11);
+		e[11] = attributes;
+		put16(e + 20, first >> 16);
+		put16(e + 26, first & 0xFFFF);
+		put32(e + 28, size);
+	}
+
+	uint32_t add_file(uint32_t directory, const char* long_name, const char* short_name, const std::vector<uint8_t>& data, uint32_t gap) {
+		uint32_t count = static_cast<uint32_t>((data.size() + cluster_bytes() - 1) / cluster_bytes());
+		std::vector<uint32_t> chain = allocate(count, gap);
+		for (uint32_t i = 0; i < count; i++) {
+			size_t offset = size_t(i) * cluster_bytes();
+			memcpy(cluster(chain[i]), &data[offset], std::min<size_t>(cluster_bytes(), data.size() - offset));
+		}
+		add_entry(directory, long_name, short_name, 0x20, count ? chain[0] : 0, static_cast<uint32_t>(data.size()));
+		return count ? chain[0] : 0;
+	}
+
+	uint32_t add_directory(uint32_t parent, const char* long_name, const char* short_name) {
+		uint32_t first = allocate(1, 0)[0];
+		directories[first] = {first};
+		add_entry(first, nullptr, ".          ", 0x10, first, 0);
+		add_entry(first, nullptr, "..         ", 0x10, parent == 2 ? 0 : parent, 0);
+		add_entry(parent, long_name, short_name, 0x10, first, 0);
+		return first;
+	}
+};
+
+static std::vector<uint8_t> read_whole_file(const char* path) {
+	std::ifstream in(path, std::ios::binary);
+	return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void fat32_test() {
+
+	int failures = 0;
+	auto expect = [&](bool ok, const char* what) {
+		if (!ok && failures++ < 10) printf("[FAIL] %s\n", what);
+	};
+
+	// 8 MB card, 1 KB clusters: the shipped pack contiguous, a sprite fragmented in a sub
+	// directory, a short name only file, enough entries for the root to span 2 clusters
+	Test_fat_image card(8, 2);
+	std::vector<uint8_t> pack = read_whole_file("assets/characters.pack");
+	std::vector<uint8_t> sprite = read_whole_file("assets/wizard.sprite");
+	std::vector<uint8_t> readme(700);
+	for (size_t i = 0; i < readme.size(); i++) readme[i] = static_cast<uint8_t>('a' + i % 26);
+	expect(!pack.empty() && !sprite.empty(), "read the assets");
+
+	for (int i = 0; i < 40; i++) {
+		char name[12];
+		snprintf(name, sizeof(name), "FILE%02d  BIN", i);
+		card.add_file(2, nullptr, name, std::vector<uint8_t>(100, static_cast<uint8_t>(i)), 0);
+	}
+	card.add_file(2, "old.pack", "OLD     PAC", {1, 2, 3}, 0);
+	card.entry(2, card.entry_count[2] - 1)[0] = 0xE5;		// deleted: the short entry of old.pack
+	card.add_file(2, "characters.pack", "CHARAC~1PAC", pack, 0);
+	uint32_t sprites = card.add_directory(2, "sprites", "SPRITES    ");
+	uint32_t interleaved = card.next_free;
+	card.add_file(sprites, "wizard.sprite", "WIZARD~1SPR", sprite, 1);
+	card.next_free = interleaved + 1;		// fill the gaps with another file
+	card.add_file(sprites, nullptr, "README  TXT", readme, 1);
+
+	std::string path = (std::filesystem::temp_directory_path() / "pocketgate_test.img").string();
+	expect(write_test_file(path, card.image), "write the card image");
+
+	Image_block_device device;
+	expect(device.open(path.c_str()), "open the card image");
+	Sector_cache cache(device, 8, 4);
+	Fat_volume volume(cache);
+	expect(volume.mount() && volume.cluster_size() == 1024, "mount");
+
+	auto read_all = [&](const char* name, const std::vector<uint8_t>& expected, bool contiguous) {
+		Fat_file file;
+		if (!volume.open(name, file) || file.size() != expected.size() || file.is_contiguous() != contiguous) return false;
+		std::vector<uint8_t> data(expected.size() + 16, 0xEE);
+		return file.read(data.data(), static_cast<uint32_t>(data.size())) == static_cast<int32_t>(expected.size()) &&
+			memcmp(data.data(), expected.data(), expected.size()) == 0 && file.read(data.data(), 1) == 0;
+	};
+	device.reset_stats();
+	expect(read_all("/characters.pack", pack, true), "contiguous file with a long name");
+	printf("  characters.pack (%zu bytes): %u commands, %u blocks\n", pack.size(), device.stats().commands, device.stats().blocks);
+	expect(read_all("Sprites/WIZARD.SPRITE", sprite, false), "fragmented file, case insensitive path");
+	expect(read_all("/sprites/readme.txt", readme, true), "short name only");
+	expect(read_all("/file39.bin", std::vector<uint8_t>(100, 39), true), "entry in the second root cluster");
+
+	// Random seeks and sizes: partial sectors, cluster and run boundaries, backwards seeks
+	Random::Xoshiro128 random(3);
+	for (const char* name : {"/characters.pack", "/sprites/wizard.sprite"}) {
+		const std::vector<uint8_t>& expected = (name[1] == 'c') ? pack : sprite;
+		Fat_file file;
+		std::vector<uint8_t> data(4096);
+		bool same = volume.open(name, file) && file.size() > 0;
+		for (int i = 0; i < 300 && same; i++) {
+			uint32_t position = random.next() % file.size();
+			uint32_t size = 1 + random.next() % 4096;
+			int32_t read = file.seek(position) ? file.read(data.data(), size) : -1;
+			same = read == static_cast<int32_t>(std::min<uint32_t>(size, file.size() - position)) &&
+				memcmp(data.data(), &expected[position], read) == 0;
+		}
+		expect(same, "random seek + read");
+	}
+
+	printf("  expected errors:\n");
+	Fat_file file;
+	expect(!volume.open("/missing.pack", file), "missing file");
+	expect(!volume.open("/old.pack", file), "deleted file");
+	expect(!volume.open("/sprites", file), "directory is not a file");
+	// Chain cut short: the FAT says the sprite ends after its first cluster
+	card.set_fat(interleaved, 0x0FFFFFFF);
+	write_test_file(path, card.image);
+	Image_block_device broken_device;
+	broken_device.open(path.c_str());
+	Sector_cache broken_cache(broken_device, 8, 4);
+	Fat_volume broken(broken_cache);
+	expect(broken.mount() && !broken.open("/sprites/wizard.sprite", file), "chain shorter than the size");
+	std::remove(path.c_str());
+
+	printf("  cache: %u hits, %u misses, %u sectors direct\n", cache.stats().hits, cache.stats().misses, cache.stats().direct);
+	printf("[%s] fat32 (%d failures)\n", failures == 0 ? "PASS" : "FAIL", failures);
+}
+
+void fat32_benchmark() {
+
+	// 1 MB file, contiguous and fragmented (4 cluster runs), 4 KB clusters, on a card image
+	// throttled like an SPI SD card (300 us per command, 2.5 MB/s)
+	const uint32_t size = 1024 * 1024;
+	std::vector<uint8_t> data(size);
+	for (uint32_t i = 0; i < size; i++) data[i] = static_cast<uint8_t>(i * 7 + (i >> 9));
+	Test_fat_image card(8, 8);
+	card.add_file(2, "contiguous.bin", "CONTIG~1BIN", data, 0);
+	// Runs of 4 clusters with a 1 cluster gap
+	std::vector<uint32_t> chain;
+	for (uint32_t i = 0; i < size / card.cluster_bytes(); i++) chain.push_back(card.next_free + i + i / 4);
+	card.link_chain(chain);
+	for (size_t i = 0; i < chain.size(); i++) memcpy(card.cluster(chain[i]), &data[i * card.cluster_bytes()], card.cluster_bytes());
+	card.add_entry(2, "fragmented.bin", "FRAGME~1BIN", 0x20, chain[0], size);
+	std::string path = (std::filesystem::temp_directory_path() / "pocketgate_bench.img").string();
+	if (!write_test_file(path, card.image)) return;
+
+	struct Variant { const char* name; const char* file; uint16_t line_sectors; uint32_t read_size; };
+	const Variant variants[] = {
+		{"512 B reads, no read ahead ", "/contiguous.bin", 1, 512},
+		{"512 B reads, 4 KB lines    ", "/contiguous.bin", 8, 512},
+		{"100 B reads, 4 KB lines    ", "/contiguous.bin", 8, 100},
+		{"32 KB reads, contiguous    ", "/contiguous.bin", 8, 32768},
+		{"32 KB reads, fragmented    ", "/fragmented.bin", 8, 32768},
+	};
+	std::vector<uint8_t> buffer(32768);
+	for (const Variant& variant : variants) {
+		Image_block_device device;
+		if (!device.open(path.c_str())) return;
+		device.set_throttle(300, 2500 * 1024);
+		Sector_cache cache(device, 8, variant.line_sectors);
+		Fat_volume volume(cache);
+		Fat_file file;
+		if (!volume.mount() || !volume.open(variant.file, file)) return;
+		device.reset_stats();
+		cache.reset_stats();
+
+		uint32_t checksum = 0;
+		auto start = std::chrono::steady_clock::now();
+		int32_t read;
+		while ((read = file.read(buffer.data(), variant.read_size)) > 0) checksum += buffer[read - 1];
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		const Sector_cache::Stats& stats = cache.stats();
+		uint32_t lookups = stats.hits + stats.misses;
+		printf("[BENCH] fat32 %s %6.2f MB/s, %5u commands, %5u blocks, %5.1f blocks/command, cache hit %5.1f%% (checksum %u)\n",
+			variant.name, size / seconds / 1e6, device.stats().commands, device.stats().blocks,
+			double(device.stats().blocks) / device.stats().commands, lookups ? 100.0 * stats.hits / lookups : 0.0, checksum);
+	}
+	std::remove(path.c_str());
+}
+
+void hot_reload_test() {
+
+	int failures = 0;
+	auto expect = [&](bool ok, const char* what) {
+		if (!ok && failures++ < 10) printf("[FAIL] %s\n", what);
+	};
+	const std::filesystem::path dir = std::filesystem::temp_directory_path() / "pocketgate_hot_reload";
+	std::filesystem::create_directories(dir);
+	const std::string pack_path = (dir / "hot.pack").string();
+	const std::string icon_path = (dir / "icon.sprite").string();
+
+	// Pack with a w x h "hero" sprite and a 2x1 "walk" atlas, every pixel the same color
+	auto build_pack = [](uint16_t width, uint16_t height, uint16_t color, bool with_hero) {
+		auto entry = [](const char* name, Asset_type type, uint16_t w, uint16_t h, uint16_t count) {
+			Pack_entry e{};
+			strncpy(e.name, name, PACK_NAME_LENGTH - 1);
+			e.type = type;
+			e.width = w;
+			e.height = h;
+			e.count = count;
+			return e;
+		};
+		auto pixels = [](std::vector<uint8_t>& out, int count, uint16_t color) {
+			for (int i = 0; i < count; i++) out.insert(out.end(), {uint8_t(color & 0xFF), uint8_t(color >> 8), 255, 0});
+		};
+		std::vector<Pack_entry> entries;
+		std::vector<std::vector<uint8_t>> payloads;
+		if (with_hero) {
+			entries.push_back(entry("hero", Asset_type::sprite, width, height, 0));
+			payloads.emplace_back();
+			pixels(payloads.back(), width * height, color);
+		}
+		Atlas_frame frame = {0, 0, 2, 1, 0, 0, 2, 1};
+		entries.push_back(entry("walk", Asset_type::atlas, 2, 1, 1));
+		payloads.emplace_back(reinterpret_cast<const uint8_t*>(&frame), reinterpret_cast<const uint8_t*>(&frame) + sizeof(frame));
+		pixels(payloads.back(), 2, color);
+		std::vector<uint32_t> words = make_test_pack(entries, payloads);
+		const uint8_t* bytes = reinterpret_cast<const uint8_t*>(words.data());
+		return std::vector<uint8_t>(bytes, bytes + reinterpret_cast<const Pack_header*>(bytes)->file_size);
+	};
+	auto build_sprite = [](uint16_t color) {
+		return std::vector<uint8_t>{1, 0, 1, 0, uint8_t(color & 0xFF), uint8_t(color >> 8), 255};
+	};
+
+	expect(write_test_file(pack_path, build_pack(2, 2, 0x1111, true)) && write_test_file(icon_path, build_sprite(0x1111)), "write the sources");
+	Hot_assets assets;
+	expect(assets.add_pack(pack_path.c_str()) && assets.add_sprite_file("icon", icon_path.c_str()), "add the sources");
+	const Sprite_asset* hero = assets.sprite("hero");
+	const Sprite_atlas* walk = assets.atlas("walk");
+	const Sprite_asset* icon = assets.sprite("icon");
+	expect(hero && walk && icon && hero->width == 2 && hero->pixels[3].color == 0x1111 && walk->pixels[1].color == 0x1111, "slots loaded");
+	expect(assets.sprite("hero") == hero && assets.poll() == 0, "same slot, nothing changed");
+	if (!hero || !walk || !icon) {
+		printf("[FAIL] hot reload (%d failures)\n", failures);
+		return;
+	}
+
+	// Rewritten in place: same slots, new content
+	write_test_file(pack_path, build_pack(3, 1, 0x2222, true));
+	expect(assets.poll() == 1, "rewrite picked up");
+	expect(hero->width == 3 && hero->height == 1 && hero->pixels[2].color == 0x2222 && walk->pixels[0].color == 0x2222, "slots hold the new pack");
+
+	// Written aside and renamed over the pack (editors, atomic tool output)
+	const std::string aside = (dir / "hot.pack.tmp").string();
+	write_test_file(aside, build_pack(1, 4, 0x3333, true));
+	std::filesystem::rename(aside, pack_path);
+	expect(assets.poll() == 1 && hero->height == 4 && hero->pixels[3].color == 0x3333, "rename over the pack picked up");
+
+	printf("  expected errors:\n");
+	// Broken or incomplete file, then a pack without a slot's asset: previous data kept
+	std::vector<uint8_t> truncated = build_pack(2, 2, 0x4444, true);
+	truncated.resize(truncated.size() - 5);
+	write_test_file(pack_path, truncated);
+	expect(assets.poll() == 0 && hero->height == 4 && hero->pixels[3].color == 0x3333, "truncated pack rejected");
+	write_test_file(pack_path, build_pack(2, 2, 0x5555, false));
+	expect(assets.poll() == 0 && hero->pixels[0].color == 0x3333 && walk->pixels[0].color == 0x3333, "pack without hero rejected");
+	expect(assets.stats().reloads == 2 && assets.stats().failures == 2, "stats");
+	expect(assets.sprite("nothing") == nullptr, "missing name");
+
+	// Loose sprite
+	write_test_file(icon_path, build_sprite(0x6666));
+	expect(assets.poll() == 1 && icon->pixels[0].color == 0x6666, "loose sprite reloaded");
+
+	// Cost per frame when nothing changed
+	const int polls = 10000;
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < polls; i++) assets.poll();
+	double poll_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / polls;
+
+	std::filesystem::remove_all(dir);
+	printf("[%s] hot reload (%d failures, %.2f us per idle poll)\n", failures == 0 ? "PASS" : "FAIL", failures, poll_us);
+}
+
+// Rebuild assets/characters.pack (tools/asset_packer or tools/assetc) while this runs:
+// the characters change on the next frame, no restart
+void hot_reload_demo() {
+
+	Hot_assets assets;
+	if (!assets.add_pack("assets/characters.pack")) return;
+	const char* names[] = {"wizard", "wizard2", "skeleton_alpha"};
+	const Sprite_asset* sprites[3];
+	for (int i = 0; i < 3; i++) {
+		sprites[i] = assets.sprite(names[i]);
+		if (!sprites[i]) return;
+	}
+
+	while (!glfwWindowShouldClose(g_window)) {
+		glfwPollEvents();
+
+		if (assets.poll()) printf("characters.pack reloaded (%u reloads)\n", assets.stats().reloads);
+		fill_with_color(COLORS[3].value);
+		for (int i = 0; i < 3; i++) {
+			const Sprite_asset& sprite = *sprites[i];
+			draw_sprite_alpha(DISPLAY_HEIGHT / 2 - sprite.height / 2, sprite.height, 20 + i * (DISPLAY_WIDTH - 40) / 3, sprite.width, sprite.pixels);
+		}
+		fps_counter();
+		swap_buffers();
+		present_frame();
+	}
+}
+
+void profiler_test() {
+
+	bool all_ok = true;
+	auto expect = [&](bool ok, const char* what) {
+		printf("[%s] %s\n", ok ? "PASS" : "FAIL", what);
+		all_ok &= ok;
+	};
+	auto stats_of = [](const char* name, Profiler::Zone_stats& out) {
+		Profiler::Zone_stats zones[16];
+		uint32_t count = std::min<uint32_t>(Profiler::zone_stats(zones, 16), 16);
+		for (uint32_t i = 0; i < count; i++) {
+			if (strcmp(zones[i].name, name) == 0) {
+				out = zones[i];
+				return true;
+			}
+		}
+		return false;
+	};
+	const Profiler::Ticks us = Profiler::TICKS_PER_US;
+
+	// Known durations: 1..100 us, so min 1, avg 50.5, p99 99, max 100
+	Profiler::clear();
+	for (Profiler::Ticks i = 100; i >= 1; i--) Profiler::record("known", 1000 * us, (1000 + i) * us);
+	static const char other_copy[] = "known";		// same text, another address (another translation unit)
+	Profiler::record(other_copy, 0, 50 * us);
+	Profiler::Zone_stats known{};
+	expect(stats_of("known", known) && known.count == 101, "zones merged by name");
+	expect(known.min_us == 1 && known.max_us == 100 && known.p99_us == 99 && std::abs(known.avg_us - 5100.0f / 101) < 0.01f, "min / avg / max / p99");
+
+	// Nested zones: the outer one contains the inner one
+	Profiler::clear();
+	{
+		PROFILE_ZONE("outer");
+		{
+			PROFILE_ZONE("inner");
+			std::this_thread::sleep_for(2ms);
+		}
+	}
+	Profiler::Zone_stats outer{}, inner{};
+	expect(stats_of("outer", outer) && stats_of("inner", inner) && inner.min_us >= 2000 && outer.min_us >= inner.min_us, "nested PROFILE_ZONE");
+
+	// Full ring: the oldest events are overwritten, the newest PROFILE_RING_SIZE remain
+	Profiler::clear();
+	for (uint32_t i = 0; i < PROFILE_RING_SIZE + 10; i++) Profiler::record("wrap", 0, (i + 1) * us);
+	Profiler::Zone_stats wrap{};
+	expect(stats_of("wrap", wrap) && wrap.count == PROFILE_RING_SIZE && wrap.min_us == 11, "ring keeps the newest events");
+
+	// Threads record into their own rings without locks
+	Profiler::clear();
+	const int threads = 4, zones_per_thread = 5000;
+	std::vector<std::thread> workers;
+	for (int t = 0; t < threads; t++) {
+		workers.emplace_back([] {
+			for (int i = 0; i < zones_per_thread; i++) {
+				PROFILE_ZONE("worker");
+			}
+		});
+	}
+	for (std::thread& worker : workers) worker.join();
+	Profiler::Zone_stats worker{};
+	expect(stats_of("worker", worker) && worker.count == threads * zones_per_thread, "4 threads x 5000 zones");
+
+	// Chrome trace: one "X" event per recorded event, one track per thread
+	FILE* file = tmpfile();
+	bool written = file && Profiler::write_chrome_trace(file);
+	std::string json;
+	if (file) {
+		rewind(file);
+		char buffer[4096];
+		size_t n;
+		while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) json.append(buffer, n);
+		fclose(file);
+	}
+	size_t complete_events = 0, tracks = 0;
+	for (size_t at = 0; (at = json.find("\"ph\":\"X\"", at)) != std::string::npos; at++) complete_events++;
+	for (size_t at = 0; (at = json.find("\"thread_name\"", at)) != std::string::npos; at++) tracks++;
+	expect(written && json.rfind("{\"displayTimeUnit\"", 0) == 0 && json.find("\n]}") != std::string::npos, "trace is a trace event object");
+	expect(complete_events == Profiler::event_count() && complete_events == threads * zones_per_thread && tracks >= threads + 1, "trace has every event and thread");
+
+	Profiler::clear();
+	expect(Profiler::event_count() == 0, "clear starts a new window");
+	if (!all_ok) printf("[FAIL] profiler_test\n");
+}
+
+void profiler_benchmark() {
+
+	// Cost of an empty zone: two clock reads and one ring store
+	const int zones = 1000000;
+	Profiler::clear();
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < zones; i++) {
+		PROFILE_ZONE("empty");
+	}
+	double zone_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / zones;
+
+	start = std::chrono::steady_clock::now();
+	Profiler::Ticks sum = 0;
+	for (int i = 0; i < zones; i++) sum += Profiler::now();
+	double now_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / zones;
+
+	start = std::chrono::steady_clock::now();
+	Profiler::Zone_stats stats[4];
+	Profiler::zone_stats(stats, 4);
+	double stats_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	printf("[BENCH] PROFILE_ZONE %.1f ns (clock read %.1f ns), zone_stats over %u events %.2f ms (%llu)\n",
+		zone_ns, now_ns, static_cast<unsigned>(Profiler::event_count()), stats_ms, static_cast<unsigned long long>(sum & 1));
+	Profiler::clear();
+}
+
+// Fountain with zones around logic, render and present: stats every 300 frames, trace on exit
+void profiler_demo() {
+
+	Particle_system system(20000);
+	system.set_gravity(0, 150);
+	static const uint16_t colors[] = {COLORS[5].value, COLORS[6].value, COLORS[7].value};
+	Particle_emitter fountain;
+	fountain.x = DISPLAY_WIDTH / 2;
+	fountain.y = DISPLAY_HEIGHT - 4;
+	fountain.radius = 2;
+	fountain.direction = Fixed_math::ANGLE_270;
+	fountain.spread = 0x2000;
+	fountain.speed_min = DISPLAY_HEIGHT / 2;
+	fountain.speed_max = DISPLAY_HEIGHT;
+	fountain.life_min = 1;
+	fountain.life_max = 3;
+	fountain.colors = colors;
+
+	Profiler::clear();
+	uint32_t frame = 0;
+	while (!glfwWindowShouldClose(g_window)) {
+		PROFILE_ZONE("frame");
+		glfwPollEvents();
+		{
+			PROFILE_ZONE("logic");
+			system.emit(fountain, 100);
+			system.update(Fixed_q16(static_cast<float>(delta_time())));
+		}
+		{
+			PROFILE_ZONE("render");
+			fill_with_color(0x0000);
+			system.draw_points();
+		}
+		swap_buffers();
+		present_frame();
+		if (++frame % 300 == 0) {
+			Profiler::print_stats();
+			Profiler::clear();
+		}
+	}
+	Profiler::save_chrome_trace("profile_trace.json");
+}
+
+void perf_hud_test() {
+
+	bool all_ok = true;
+	auto expect = [&](bool ok, const char* what) {
+		printf("[%s] %s\n", ok ? "PASS" : "FAIL", what);
+		all_ok &= ok;
+	};
+	auto lit_pixels = [] {
+		int lit = 0;
+		for (int i = 0; i < DISPLAY_WIDTH * DISPLAY_HEIGHT; i++) lit += back_buffer[i] != 0;
+		return lit;
+	};
+
+	// Font: lowercase is uppercase, unknown characters are '?', one pixel per set bit
+	expect(Tiny_font::glyph('a') == Tiny_font::glyph('A') && Tiny_font::glyph('~') == Tiny_font::glyph('?'), "glyph lookup");
+	fill_with_color(0x0000);
+	int advance = Tiny_font::draw_text(10, 10, "8 8", 0xFFFF);
+	expect(advance == 3 * Tiny_font::ADVANCE && lit_pixels() == 2 * 13 && back_buffer[11 * DISPLAY_WIDTH + 11] == 0, "draw_text pixels");
+	fill_with_color(0x0000);
+	Tiny_font::draw_text(10, 10, "8", 0xFFFF, 3);
+	expect(lit_pixels() == 13 * 9, "draw_text scale 3");
+
+	// Clipping: only the part on screen is drawn
+	fill_with_color(0x0000);
+	Tiny_font::draw_text(-1, -1, "8", 0xFFFF);
+	Tiny_font::draw_text(DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1, "8", 0xFFFF);
+	Tiny_font::draw_text(-100, -100, "8", 0xFFFF);
+	expect(lit_pixels() == 6 + 1 && back_buffer[0] == 0 && back_buffer[1] != 0 && back_buffer[DISPLAY_WIDTH * DISPLAY_HEIGHT - 1] != 0, "draw_text clipped");
+
+	// Totals without percentiles match zone_stats
+	Profiler::clear();
+	for (Profiler::Ticks i = 1; i <= 100; i++) Profiler::record("totals", 0, i * Profiler::TICKS_PER_US);
+	Profiler::record("small", 0, 1);
+	Profiler::Zone_stats full[4], quick[4];
+	uint32_t full_count = Profiler::zone_stats(full, 4);
+	uint32_t quick_count = Profiler::zone_totals(quick, 4);
+	expect(quick_count == full_count && strcmp(quick[0].name, "totals") == 0 && quick[0].count == full[0].count &&
+		quick[0].total_us == full[0].total_us && quick[0].min_us == 1 && quick[0].max_us == 100 && quick[0].avg_us == full[0].avg_us, "zone_totals");
+
+	// The combo toggles on the press, holding it does nothing
+	Perf_hud hud(1);
+	hud.frame(true);
+	bool shown = hud.visible();
+	hud.frame(true);
+	bool held = hud.visible();
+	hud.frame(false);
+	hud.frame(true);
+	expect(shown && held && !hud.visible(), "toggle on the press");
+
+	// Visible HUD draws its panel and nothing outside it
+	fill_with_color(0x1234);
+	hud.set_visible(true);
+	for (int i = 0; i < 3; i++) {
+		{ PROFILE_ZONE("render"); }
+		hud.frame(false);
+	}
+	bool outside_kept = true;
+	for (int y = 0; y < DISPLAY_HEIGHT; y++) {
+		for (int x = 0; x < DISPLAY_WIDTH; x++) {
+			if (x >= hud.width() || y >= hud.height()) outside_kept &= back_buffer[y * DISPLAY_WIDTH + x] == 0x1234;
+		}
+	}
+	expect(outside_kept && back_buffer[0] == 0x0000 && hud.width() <= 160 && hud.height() <= 128, "panel drawn, fits 160x128");
+
+	printf("perf hud test: %s\n", all_ok ? "all passed" : "FAILED");
+}
+
+void perf_hud_benchmark() {
+	// Cost of a visible HUD per frame, refreshes included
+	const int frames = 3000;
+	for (int scale : {1, Perf_hud::DEFAULT_SCALE}) {
+		Perf_hud hud(scale);
+		hud.set_visible(true);
+		fill_with_color(0x0000);
+		Profiler::clear();
+		auto start = std::chrono::high_resolution_clock::now();
+		for (int frame = 0; frame < frames; frame++) {
+			{ PROFILE_ZONE("render"); }
+			hud.frame(false);
+		}
+		double us = std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - start).count() / frames;
+		printf("[BENCH] perf hud scale %d (%dx%d panel): %.1f us per frame\n", scale, hud.width(), hud.height(), us);
+	}
+	Perf_hud hidden;
+	auto start = std::chrono::high_resolution_clock::now();
+	for (int frame = 0; frame < frames; frame++) hidden.frame(false);
+	double us = std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - start).count() / frames;
+	printf("[BENCH] perf hud hidden: %.3f us per frame\n", us);
+}
+
+void perf_hud_demo() {
+	// profiler_demo scene, F3 shows / hides the HUD
+	Particle_system system(20000);
+	system.set_gravity(0, 150);
+	static const uint16_t colors[] = {COLORS[5].value, COLORS[6].value, COLORS[7].value};
+	Particle_emitter fountain;
+	fountain.x = DISPLAY_WIDTH / 2;
+	fountain.y = DISPLAY_HEIGHT - 4;
+	fountain.radius = 2;
+	fountain.direction = Fixed_math::ANGLE_270;
+	fountain.spread = 0x2000;
+	fountain.speed_min = DISPLAY_HEIGHT / 2;
+	fountain.speed_max = DISPLAY_HEIGHT;
+	fountain.life_min = 1;
+	fountain.life_max = 3;
+	fountain.colors = colors;
+
+	Perf_hud hud;
+	hud.set_visible(true);
+	while (!glfwWindowShouldClose(g_window)) {
+		PROFILE_ZONE("frame");
+		glfwPollEvents();
+		{
+			PROFILE_ZONE("logic");
+			system.emit(fountain, 100);
+			system.update(Fixed_q16(static_cast<float>(delta_time())));
+		}
+		{
+			PROFILE_ZONE("render");
+			fill_with_color(0x0000);
+			system.draw_points();
+		}
+		hud.frame(glfwGetKey(g_window, GLFW_KEY_F3) == GLFW_PRESS);
+		swap_buffers();
+		present_frame();
+	}
+}
 
 void error_callback(int error, const char* description) {
 	fprintf(stderr, "Error %s\n", description);
@@ -340,10 +3280,25 @@ static void key_callback(GLFWwindow* window, int key, int scancode, int action,
 		glfwSetWindowShouldClose(window, GLFW_TRUE);
 }
 
+// Largest integer factor that fits the window, the rest is black border
+constexpr uint8_t PRESENT_SCALE = (WINDOW_WIDTH / DISPLAY_WIDTH < WINDOW_HEIGHT / DISPLAY_HEIGHT) ?
+	WINDOW_WIDTH / DISPLAY_WIDTH : WINDOW_HEIGHT / DISPLAY_HEIGHT;
+
 void present_frame() {
+	PROFILE_ZONE("present");
 	glBindTexture(GL_TEXTURE_2D, g_texture);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, DISPLAY_WIDTH, DISPLAY_HEIGHT, 0,
-				GL_RGB, GL_UNSIGNED_SHORT_5_6_5, get_front_buffer());
+
+	if (DISPLAY_WIDTH == WINDOW_WIDTH && DISPLAY_HEIGHT == WINDOW_HEIGHT) {
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, DISPLAY_WIDTH, DISPLAY_HEIGHT, 0,
+					GL_RGB, GL_UNSIGNED_SHORT_5_6_5, get_front_buffer());
+	} else {
+		// Same path a bigger panel would take: scale on the CPU, send the window sized frame
+		static std::vector<uint16_t> window_pixels(WINDOW_WIDTH * WINDOW_HEIGHT, 0);
+		size_t offset = (WINDOW_HEIGHT - DISPLAY_HEIGHT * PRESENT_SCALE) / 2 * WINDOW_WIDTH + (WINDOW_WIDTH - DISPLAY_WIDTH * PRESENT_SCALE) / 2;
+		upscale(get_front_buffer(), DISPLAY_WIDTH, DISPLAY_HEIGHT, &window_pixels[offset], WINDOW_WIDTH, PRESENT_SCALE);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, WINDOW_WIDTH, WINDOW_HEIGHT, 0,
+					GL_RGB, GL_UNSIGNED_SHORT_5_6_5, window_pixels.data());
+	}
 
 	glEnable(GL_TEXTURE_2D);
 	glBegin(GL_QUADS);
@@ -366,7 +3321,7 @@ int gl_init() {
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
 
-	g_window = glfwCreateWindow(DISPLAY_WIDTH, DISPLAY_HEIGHT, "PocketGateEngine", NULL, NULL);
+	g_window = glfwCreateWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "PocketGateEngine", NULL, NULL);
 	if (!g_window) {
 		glfwTerminate();
 		exit(EXIT_FAILURE);
@@ -411,8 +3366,8 @@ public:
 				fill_with_color(0x0000);
 
 				for (auto &d : data) {
-					d.x = random_int_modulo(0, SCREEN_WIDTH - RECT_WIDTH);
-					d.y = random_int_modulo(0, SCREEN_HEIGHT - RECT_HEIGHT);
+					d.x = random_int_modulo(0, DISPLAY_WIDTH - RECT_WIDTH);
+					d.y = random_int_modulo(0, DISPLAY_HEIGHT - RECT_HEIGHT);
 					draw_rectangle_memset(d.y, RECT_WIDTH, d.x, RECT_HEIGHT, 0xFFE0);
 				}
 
@@ -472,6 +3427,53 @@ int main() {
 	// movement_tracking_test_sprite_wizard();
 	// bresenham_line_drawing_test();
 	// diamond_outline_test();
+	// world_to_screen_test();
+	// fixed_math_accuracy_test();
+	// fixed_math_benchmark();
+	// random_test();
+	// random_benchmark();
+	// spatial_hash_test();
+	// spatial_hash_benchmark();
+	// collision_test();
+	// collision_benchmark();
+	// collision_movement_test();
+	// pathfinding_test();
+	// pathfinding_benchmark();
+	// sprite_atlas_test();
+	// sprite_atlas_benchmark();
+	// sprite_planes_test();
+	// animation_test();
+	// animation_benchmark();
+	// indexed_framebuffer_test();
+	// indexed_framebuffer_benchmark();
+	// palette_cycling_test();
+	// strip_renderer_test();
+	// strip_renderer_benchmark();
+	// upscale_test();
+	// upscale_benchmark();
+	// clipping_fuzz_test();
+	// clipping_benchmark();
+	// sprite_transform_test();
+	// sprite_transform_benchmark();
+	// particle_test();
+	// particle_benchmark();
+	// particle_fountain_test();
+	// asset_pack_test();
+	// asset_pack_benchmark();
+	// lz_stream_test();
+	// lz_benchmark();
+	// level_stream_test();
+	// level_stream_benchmark();
+	// fat32_test();
+	// fat32_benchmark();
+	// hot_reload_test();
+	// hot_reload_demo();
+	// profiler_test();
+	// profiler_benchmark();
+	// profiler_demo();
+	// perf_hud_test();
+	// perf_hud_benchmark();
+	// perf_hud_demo();
 
 	// while (!glfwWindowShouldClose(g_window)){
 	// 	fill_with_color(COLORS[5].value);
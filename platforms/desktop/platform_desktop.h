@@ -7,7 +7,22 @@
 #define SCREEN_HEIGHT 820
 #define SCREEN_WIDTH 1480
 
-constexpr uint16_t DISPLAY_HEIGHT = SCREEN_HEIGHT;
-constexpr uint16_t DISPLAY_WIDTH = SCREEN_WIDTH;
+// Logical resolution the engine renders at, present_frame() scales it up to the window
+// by the largest integer factor that fits (make LOGICAL_WIDTH=160 LOGICAL_HEIGHT=128 draws
+// as many pixels as the Pico). Defaults to the window size, no scaling.
+#ifndef LOGICAL_WIDTH
+	#define LOGICAL_WIDTH SCREEN_WIDTH
+#endif
+#ifndef LOGICAL_HEIGHT
+	#define LOGICAL_HEIGHT SCREEN_HEIGHT
+#endif
+
+constexpr uint16_t DISPLAY_HEIGHT = LOGICAL_HEIGHT;
+constexpr uint16_t DISPLAY_WIDTH = LOGICAL_WIDTH;
+constexpr uint16_t WINDOW_HEIGHT = SCREEN_HEIGHT;
+constexpr uint16_t WINDOW_WIDTH = SCREEN_WIDTH;
+
+static_assert(DISPLAY_WIDTH > 0 && DISPLAY_HEIGHT > 0, "logical resolution must not be empty");
+static_assert(DISPLAY_WIDTH <= WINDOW_WIDTH && DISPLAY_HEIGHT <= WINDOW_HEIGHT, "logical resolution larger than the window");
 
 #endif
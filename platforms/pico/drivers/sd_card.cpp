@@ -0,0 +1,180 @@
+#include "pico/stdlib.h"
+#include "hardware/spi.h"
+#include "stdio.h"
+
+#include "hardware_config.h"
+#include "sd_card.h"
+
+// 25 MHz is the default speed mode limit, 400 kHz until the card is initialized
+const uint32_t SD_BAUDRATE = 25000000;
+const uint32_t SD_INIT_BAUDRATE = 400000;
+const uint32_t SD_TIMEOUT_US = 500000;
+
+const uint8_t CMD_GO_IDLE = 0;
+const uint8_t CMD_SEND_IF_COND = 8;
+const uint8_t CMD_SEND_CSD = 9;
+const uint8_t CMD_STOP_TRANSMISSION = 12;
+const uint8_t CMD_SET_BLOCKLEN = 16;
+const uint8_t CMD_READ_SINGLE = 17;
+const uint8_t CMD_READ_MULTIPLE = 18;
+const uint8_t CMD_APP = 55;
+const uint8_t CMD_READ_OCR = 58;
+const uint8_t ACMD_SEND_OP_COND = 41;
+
+const uint8_t R1_IDLE = 0x01;
+const uint8_t R1_ILLEGAL_COMMAND = 0x04;
+const uint8_t DATA_TOKEN = 0xFE;
+
+static uint8_t transfer(uint8_t out) {
+	uint8_t in;
+	spi_write_read_blocking(spi0, &out, &in, 1);
+	return in;
+}
+
+void Sd_block_device::select() {
+	bus_baudrate = spi_get_baudrate(spi0);
+	spi_set_baudrate(spi0, blocks ? SD_BAUDRATE : SD_INIT_BAUDRATE);
+	gpio_put(PIN_CARD_CS, 0);
+}
+
+void Sd_block_device::deselect() {
+	gpio_put(PIN_CARD_CS, 1);
+	transfer(0xFF);		// the card releases MISO on the next clock
+	spi_set_baudrate(spi0, bus_baudrate);
+}
+
+bool Sd_block_device::wait_ready(uint32_t timeout_us) {
+	uint32_t start = time_us_32();
+	while (transfer(0xFF) != 0xFF) {
+		if (time_us_32() - start > timeout_us) return false;
+	}
+	return true;
+}
+
+uint8_t Sd_block_device::command(uint8_t index, uint32_t argument) {
+
+	if (index != CMD_GO_IDLE && !wait_ready(SD_TIMEOUT_US)) return 0xFF;
+
+	// CRC only checked for CMD0 and CMD8 in SPI mode
+	uint8_t crc = (index == CMD_GO_IDLE) ? 0x95 : (index == CMD_SEND_IF_COND) ? 0x87 : 0x01;
+	uint8_t frame[6] = {static_cast<uint8_t>(0x40 | index), static_cast<uint8_t>(argument >> 24), static_cast<uint8_t>(argument >> 16),
+		static_cast<uint8_t>(argument >> 8), static_cast<uint8_t>(argument), crc};
+	spi_write_blocking(spi0, frame, sizeof(frame));
+	if (index == CMD_STOP_TRANSMISSION) transfer(0xFF);		// stuff byte
+
+	uint8_t response = 0xFF;
+	for (int i = 0; i < 10 && (response & 0x80); i++) response = transfer(0xFF);
+	return response;
+}
+
+bool Sd_block_device::read_data(uint8_t* dst, uint32_t size) {
+
+	uint32_t start = time_us_32();
+	uint8_t token;
+	while ((token = transfer(0xFF)) == 0xFF) {
+		if (time_us_32() - start > SD_TIMEOUT_US) return false;
+	}
+	if (token != DATA_TOKEN) return false;
+	spi_read_blocking(spi0, 0xFF, dst, size);
+	transfer(0xFF);		// CRC16, not checked
+	transfer(0xFF);
+	return true;
+}
+
+bool Sd_block_device::init() {
+
+	blocks = 0;
+	gpio_set_function(PIN_MISO, GPIO_FUNC_SPI);
+	gpio_init(PIN_CARD_CS);
+	gpio_set_dir(PIN_CARD_CS, GPIO_OUT);
+	gpio_put(PIN_CARD_CS, 1);
+
+	// 80 clocks with CS high put the card in native mode, CMD0 with CS low switches it to SPI
+	bus_baudrate = spi_get_baudrate(spi0);
+	spi_set_baudrate(spi0, SD_INIT_BAUDRATE);
+	for (int i = 0; i < 10; i++) transfer(0xFF);
+	spi_set_baudrate(spi0, bus_baudrate);
+
+	select();
+	bool ok = false;
+	uint8_t r1 = 0xFF;
+	for (int i = 0; i < 10 && r1 != R1_IDLE; i++) r1 = command(CMD_GO_IDLE, 0);
+	if (r1 != R1_IDLE) {
+		printf("[ERROR] sd card: no card\n");
+		deselect();
+		return false;
+	}
+
+	// v2 cards echo the check pattern, v1 cards do not know CMD8
+	bool version2 = false;
+	r1 = command(CMD_SEND_IF_COND, 0x1AA);
+	if (!(r1 & R1_ILLEGAL_COMMAND)) {
+		uint8_t r7[4];
+		for (uint8_t& byte : r7) byte = transfer(0xFF);
+		if (r7[3] != 0xAA) {
+			printf("[ERROR] sd card: bad CMD8 echo\n");
+			deselect();
+			return false;
+		}
+		version2 = true;
+	}
+
+	uint32_t start = time_us_32();
+	do {
+		command(CMD_APP, 0);
+		r1 = command(ACMD_SEND_OP_COND, version2 ? 0x40000000 : 0);
+	} while (r1 == R1_IDLE && time_us_32() - start < 1000000);
+
+	if (r1 == 0) {
+		high_capacity = false;
+		if (version2 && command(CMD_READ_OCR, 0) == 0) {
+			uint8_t ocr[4];
+			for (uint8_t& byte : ocr) byte = transfer(0xFF);
+			high_capacity = (ocr[0] & 0x40) != 0;
+		}
+		ok = high_capacity || command(CMD_SET_BLOCKLEN, BLOCK_SIZE) == 0;
+	}
+
+	// Capacity from the CSD
+	uint8_t csd[16];
+	if (ok && command(CMD_SEND_CSD, 0) == 0 && read_data(csd, sizeof(csd))) {
+		if ((csd[0] >> 6) == 1) {
+			uint32_t size = ((csd[7] & 0x3F) << 16) | (csd[8] << 8) | csd[9];
+			blocks = (size + 1) * 1024;
+		} else {
+			uint32_t size = ((csd[6] & 0x03) << 10) | (csd[7] << 2) | (csd[8] >> 6);
+			uint32_t multiplier = ((csd[9] & 0x03) << 1) | (csd[10] >> 7);
+			uint32_t block_length = csd[5] & 0x0F;
+			blocks = (size + 1) << (multiplier + 2 + block_length - 9);
+		}
+	}
+	deselect();
+
+	if (blocks == 0) {
+		printf("[ERROR] sd card: initialization failed\n");
+		return false;
+	}
+	return true;
+}
+
+bool Sd_block_device::read_blocks(uint32_t lba, uint32_t count, uint8_t* dst) {
+
+	if (blocks == 0 || count == 0 || uint64_t(lba) + count > blocks) return false;
+	counters.commands++;
+	counters.blocks += count;
+
+	select();
+	uint32_t address = high_capacity ? lba : lba * BLOCK_SIZE;
+	bool ok = command(count == 1 ? CMD_READ_SINGLE : CMD_READ_MULTIPLE, address) == 0;
+	for (uint32_t i = 0; ok && i < count; i++) {
+		ok = read_data(dst + i * BLOCK_SIZE, BLOCK_SIZE);
+	}
+	if (count > 1) {
+		command(CMD_STOP_TRANSMISSION, 0);
+		wait_ready(SD_TIMEOUT_US);
+	}
+	deselect();
+
+	if (!ok) printf("[ERROR] sd card: read of %u blocks at %u failed\n", static_cast<unsigned>(count), static_cast<unsigned>(lba));
+	return ok;
+}
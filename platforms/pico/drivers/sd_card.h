@@ -0,0 +1,37 @@
+#ifndef SD_CARD_H
+#define SD_CARD_H
+
+#include "pico/stdlib.h"
+#include "engine/io/block_device.h"
+
+// SD card in SPI mode on spi0, shared with the display (PIN_CARD_CS, PIN_MISO). Read
+// only, SDSC and SDHC/SDXC. The bus runs at SD_BAUDRATE during a card transaction and is
+// put back to the display rate after it.
+//
+// Sd_block_device card;
+// Sector_cache cache(card, 8, 4);
+// Fat_volume fat(cache);
+// if (card.init() && fat.mount()) fat.open("/assets/world.level", file);
+
+class Sd_block_device : public Block_device {
+public:
+	// After init_display() (the SPI bus is set up there)
+	bool init();
+
+	uint32_t block_count() const override { return blocks; }
+	// One block is CMD17, more is CMD18 + CMD12
+	bool read_blocks(uint32_t lba, uint32_t count, uint8_t* dst) override;
+
+private:
+	uint32_t blocks = 0;
+	bool high_capacity = false;		// addressed in blocks, not bytes
+	uint32_t bus_baudrate = 0;		// display rate, restored after a transaction
+
+	void select();
+	void deselect();
+	bool wait_ready(uint32_t timeout_us);
+	uint8_t command(uint8_t index, uint32_t argument);
+	bool read_data(uint8_t* dst, uint32_t size);
+};
+
+#endif
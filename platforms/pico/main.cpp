@@ -5,16 +5,31 @@
 #include <stdlib.h>
 #include <random>
 #include <math.h>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 
 #include "drivers/display.h"
+#include "drivers/sd_card.h"
 #include "framebuffer.h"
+#include "framebuffer_indexed.h"
+#include "strip_renderer.h"
 #include "buttons.h"
 #include "assets/skeleton_alpha.h"
 #include "assets/wizard.h"
 #include "assets/wizard2.h"
 #include "engine/isometric/iso_math.h"
+#include "engine/math/fixed_math.h"
+#include "engine/math/random.h"
+#include "engine/spatial/collision.h"
+#include "engine/spatial/pathfinding.h"
+#include "engine/graphics/animation.h"
+#include "engine/graphics/particles.h"
+#include "engine/assets/asset_pack.h"
+#include "engine/assets/level_stream.h"
+#include "engine/io/fat32.h"
+#include "engine/profile/profiler.h"
+#include "engine/profile/perf_hud.h"
 
 using namespace Framebuffer;
 using namespace Buttons;
@@ -23,13 +38,15 @@ const uint LED_PIN = 25;
 const uint LED_L = 28;
 const uint LED_R = 4;
 
-static std::mt19937 rng(time_us_32());
+// xoshiro128**: 16 bytes of state instead of mt19937's 2.5 KB, seedable for replays
+static Random::Xoshiro128 rng(time_us_32());
 int random_int_distr(int min, int max) {
 	std::uniform_int_distribution<int> dist(min, max);
 	return dist(rng);
 }
+// Unbiased [min, max] (Lemire multiply-shift, no modulo)
 int random_int_modulo(int min, int max) {
-	return min + (rng() % (max - min + 1));
+	return rng.range(min, max);
 }
 
 void fps_counter() {
@@ -94,20 +111,26 @@ void init_led_pins() {
 	// gpio_set_dir(LED_R, GPIO_OUT);
 }
 
-void ambient_glow(uint led, float speed) {
-	 float time_sec = time_us_64() / 1000000.0f;
+// Phase of a periodic signal as a 16-bit fraction of one cycle.
+// 4295 ~= 2^32 / 1e6, the product may wrap - only bits 32..47 are kept.
+uint16_t phase_from_time(uint64_t time_us, Fixed_q16 cycles_per_second) {
+	return static_cast<uint16_t>((time_us * static_cast<uint64_t>(cycles_per_second.raw) * 4295u) >> 32);
+}
+
+void ambient_glow(uint led, Fixed_q16 speed) {
+	// speed in radians per second, same as sinf(time_sec * speed)
+	Fixed_math::Angle angle = phase_from_time(time_us_64(), speed / Fixed_math::TWO_PI);
+	Fixed_q16 wave = Fixed_math::sin(angle) + 1;
 
-	uint16_t brightness = (sinf(time_sec *  speed) + 1.0f) * 500.0f;
+	uint16_t brightness = (wave * 500).to_int();
 	set_led_brightness(led, brightness);
 }
-void dim_led(uint led, float speed ) {
-	float time_sec = time_us_64() / 1000000.0f;
-
-	// Triangle wave (0→1→0→1...)
-	float cycle = fmodf(time_sec * speed, 2.0f);  // 2-second cycle
-	float brightness_normalized = (cycle < 1.0f) ? cycle : (2.0f - cycle);
+void dim_led(uint led, Fixed_q16 speed) {
+	// Triangle wave (0→1→0→1...), 2-second cycle at speed 1
+	uint16_t phase = phase_from_time(time_us_64(), speed / 2);
+	uint32_t brightness_normalized = (phase < 0x8000) ? phase * 2u : (0x10000u - phase) * 2u;
 
-	uint16_t brightness = brightness_normalized * 1023.0f;
+	uint16_t brightness = (brightness_normalized * 1023u) >> 16;
 	set_led_brightness(led, brightness);
 }
 void dim_led(uint led, uint16_t level) {
@@ -148,8 +171,8 @@ void blik(){
 		// sleep_ms(randomInt(0, 250));
 		// gpio_put(LED_R, 0);
 
-		dim_led(LED_L, 0.5f);
-		ambient_glow(LED_R, 1.0f);
+		dim_led(LED_L, 0.5_q16);
+		ambient_glow(LED_R, 1.0_q16);
 		sleep_ms(10);
 	}
 }
@@ -316,13 +339,13 @@ void sprite_test() {
 	fill_with_color(COLORS[3].value);
 	// draw_sprite(128/2 - 25/2, 43, 160/2 - 25/2, 59, skeleton_data);
 
-	draw_sprite_alpha(2, skeleton_alpha_height, 2, skeleton_alpha_width, skeleton_alpha_data);
-	draw_sprite_alpha(2, skeleton_alpha_height, 160 - skeleton_alpha_width, skeleton_alpha_width, skeleton_alpha_data);
+	draw_sprite_planes(skeleton_alpha_sprite, 2, 2);
+	draw_sprite_planes(skeleton_alpha_sprite, 160 - skeleton_alpha_width, 2);
 
-	draw_sprite_alpha(128/2 - skeleton_alpha_height/2, skeleton_alpha_height, 160/2 - skeleton_alpha_width/2, skeleton_alpha_width, skeleton_alpha_data);
+	draw_sprite_planes(skeleton_alpha_sprite, 160/2 - skeleton_alpha_width/2, 128/2 - skeleton_alpha_height/2);
 
-	draw_sprite_alpha(128 - skeleton_alpha_height, skeleton_alpha_height, 2, skeleton_alpha_width, skeleton_alpha_data);
-	draw_sprite_alpha(128 - skeleton_alpha_height, skeleton_alpha_height, 160 - skeleton_alpha_width, skeleton_alpha_width, skeleton_alpha_data);
+	draw_sprite_planes(skeleton_alpha_sprite, 2, 128 - skeleton_alpha_height);
+	draw_sprite_planes(skeleton_alpha_sprite, 160 - skeleton_alpha_width, 128 - skeleton_alpha_height);
 
 	swap_buffers();
 	send_to_display();
@@ -333,7 +356,7 @@ void movement_tracking_test_sprite_skeleton() {
 	Entity sprite_coord = {128/2 - skeleton_alpha_height/2, skeleton_alpha_height, 160/2 - skeleton_alpha_width/2, skeleton_alpha_width};
 
 	fill_with_color(COLORS[3].value);
-	draw_sprite_alpha(sprite_coord.y.to_int(), sprite_coord.height, sprite_coord.x.to_int(), sprite_coord.width, skeleton_alpha_data);
+	draw_sprite_planes(skeleton_alpha_sprite, sprite_coord.x.to_int(), sprite_coord.y.to_int());
 	swap_buffers();
 	send_to_display();
 
@@ -345,7 +368,7 @@ void movement_tracking_test_sprite_skeleton() {
 			sleep_ms(1);
 			fill_with_color(COLORS[3].value);
 			performe_button_action(buttons, sprite_coord);
-			draw_sprite_alpha(sprite_coord.y.to_int(), sprite_coord.height, sprite_coord.x.to_int(), sprite_coord.width, skeleton_alpha_data);
+			draw_sprite_planes(skeleton_alpha_sprite, sprite_coord.x.to_int(), sprite_coord.y.to_int());
 			fps_counter();
 			swap_buffers();
 			send_to_display();
@@ -359,8 +382,8 @@ void movement_tracking_test_sprite_wizard() {
 
 	fill_with_color(COLORS[4].value);
 
-	draw_sprite_alpha(wizard.y.to_int(), wizard.height, wizard.x.to_int(), wizard.width, wizard_data);
-	draw_sprite_alpha(wizard2.y.to_int(), wizard2.height, wizard2.x.to_int(), wizard2.width, wizard2_data);
+	draw_sprite_planes(wizard_sprite, wizard.x.to_int(), wizard.y.to_int());
+	draw_sprite_planes(wizard2_sprite, wizard2.x.to_int(), wizard2.y.to_int());
 
 	swap_buffers();
 	send_to_display();
@@ -372,9 +395,9 @@ void movement_tracking_test_sprite_wizard() {
 		if(buttons.a || buttons.d || buttons.i || buttons.j || buttons.k || buttons.l || buttons.s || buttons.w) {
 			sleep_ms(1);
 			fill_with_color(COLORS[4].value);
-			draw_sprite_alpha(wizard.y.to_int(), wizard.height, wizard.x.to_int(), wizard.width, wizard_data);
+			draw_sprite_planes(wizard_sprite, wizard.x.to_int(), wizard.y.to_int());
 			performe_button_action(buttons, wizard2);
-			draw_sprite_alpha(wizard2.y.to_int(), wizard2.height, wizard2.x.to_int(), wizard2.width, wizard2_data);
+			draw_sprite_planes(wizard2_sprite, wizard2.x.to_int(), wizard2.y.to_int());
 			fps_counter();
 			swap_buffers();
 			send_to_display();
@@ -409,6 +432,444 @@ void world_to_screen_test() {
 
 }
 
+void fixed_math_benchmark() {
+	// Soft-float (no FPU on the RP2040) vs engine/math fixed point
+	const int iterations = 10000;
+	volatile float float_sink = 0;
+	volatile int32_t fixed_sink = 0;
+
+	uint32_t start = time_us_32();
+	for (int i = 0; i < iterations; i++) float_sink = float_sink + sinf(i * 0.001f);
+	uint32_t sinf_us = time_us_32() - start;
+
+	start = time_us_32();
+	for (int i = 0; i < iterations; i++) fixed_sink = fixed_sink + Fixed_math::sin(static_cast<Fixed_math::Angle>(i * 10)).raw;
+	uint32_t sin_us = time_us_32() - start;
+
+	start = time_us_32();
+	for (int i = 0; i < iterations; i++) float_sink = float_sink + sqrtf(i * 0.37f);
+	uint32_t sqrtf_us = time_us_32() - start;
+
+	start = time_us_32();
+	for (int i = 0; i < iterations; i++) fixed_sink = fixed_sink + Fixed_math::sqrt(Fixed_q16::from_raw(i * 24248)).raw;
+	uint32_t sqrt_us = time_us_32() - start;
+
+	start = time_us_32();
+	for (int i = 0; i < iterations; i++) float_sink = float_sink + atan2f(i * 0.01f - 50.0f, 13.0f);
+	uint32_t atan2f_us = time_us_32() - start;
+
+	start = time_us_32();
+	for (int i = 0; i < iterations; i++) fixed_sink = fixed_sink + Fixed_math::atan2(Fixed_q16::from_raw(i * 655 - 3276800), Fixed_q16(13)).raw;
+	uint32_t atan2_us = time_us_32() - start;
+
+	start = time_us_32();
+	for (int i = 1; i <= iterations; i++) float_sink = float_sink + 1.0f / (i * 0.37f);
+	uint32_t divf_us = time_us_32() - start;
+
+	start = time_us_32();
+	for (int i = 1; i <= iterations; i++) fixed_sink = fixed_sink + Fixed_math::reciprocal(Fixed_q16::from_raw(i * 24248)).raw;
+	uint32_t recip_us = time_us_32() - start;
+
+	printf("[BENCH] %d calls (us): sinf %lu / sin %lu, sqrtf %lu / sqrt %lu, atan2f %lu / atan2 %lu, 1.0f/x %lu / reciprocal %lu\n",
+		iterations, sinf_us, sin_us, sqrtf_us, sqrt_us, atan2f_us, atan2_us, divf_us, recip_us);
+}
+
+// Same scene as collision_scene_* in the desktop main: the checksums must match
+struct Collision_scene {
+	Collision_world world;
+	std::vector<Vec2_q16> velocity;
+	Fixed_q16 size;
+};
+
+void collision_scene_init(Collision_scene& scene, uint32_t bodies, uint32_t seed) {
+
+	Random::Xoshiro128 gen(seed);
+	scene.size = Fixed_q16(static_cast<int32_t>(Fixed_math::isqrt(bodies)) * 24);
+	scene.velocity.assign(bodies, Vec2_q16{});
+
+	uint32_t id = bodies;
+	for (Fixed_q16 ty = 32; ty < scene.size; ty += 96) {
+		for (Fixed_q16 tx = 32; tx < scene.size; tx += 96) {
+			scene.world.set(id++, Collision::Shape::diamond(tx, ty, 16, 8), true);
+		}
+	}
+	for (uint32_t i = 0; i < bodies; i++) {
+		Fixed_q16 x = gen.uniform(Fixed_q16(0), scene.size);
+		Fixed_q16 y = gen.uniform(Fixed_q16(0), scene.size);
+		Fixed_q16 side = Fixed_q16(gen.range(6, 12));
+		scene.world.set(i, Collision::Shape::box(x, y, side, side));
+		scene.velocity[i] = {gen.uniform(Fixed_q16(-1), Fixed_q16(1)), gen.uniform(Fixed_q16(-1), Fixed_q16(1))};
+	}
+}
+
+size_t collision_scene_step(Collision_scene& scene, uint32_t& checksum) {
+
+	for (uint32_t i = 0; i < scene.velocity.size(); i++) {
+		const Collision::Shape& shape = scene.world.shape(i);
+		Vec2_q16& v = scene.velocity[i];
+		if (shape.x < 0 || shape.x > scene.size) v.x = -v.x;
+		if (shape.y < 0 || shape.y > scene.size) v.y = -v.y;
+		scene.world.move_to(i, shape.x + v.x, shape.y + v.y);
+	}
+
+	auto contacts = scene.world.step();
+	for (const Collision::Contact& c : contacts) {
+		for (uint32_t word : {c.a, c.b, static_cast<uint32_t>(c.normal_x.raw), static_cast<uint32_t>(c.normal_y.raw), static_cast<uint32_t>(c.depth.raw)}) {
+			checksum = (checksum ^ word) * 16777619u;
+		}
+	}
+	scene.world.resolve();
+	return contacts.size();
+}
+
+void collision_benchmark() {
+
+	const int frames = 60;
+	Collision_scene scene;
+	collision_scene_init(scene, 1000, 1);
+	uint32_t checksum = 2166136261u;
+	size_t contacts = 0;
+
+	uint32_t start = time_us_32();
+	for (int f = 0; f < frames; f++) contacts += collision_scene_step(scene, checksum);
+	uint32_t frame_us = (time_us_32() - start) / frames;
+
+	printf("[BENCH] 1000 dynamic bodies: %lu us per frame, %u contacts per frame, checksum %08lx\n",
+		frame_us, static_cast<unsigned>(contacts / frames), checksum);
+}
+
+void pathfinding_benchmark() {
+	// 64x64 map: pathfinder 17 KB + 1024 entry open list 8 KB + map 512 B
+	Nav_grid grid(64, 64);
+	Random::Xoshiro128 gen(1);
+	for (int y = 0; y < 64; y++)
+		for (int x = 0; x < 64; x++)
+			grid.set_walkable(x, y, gen.bounded(100) >= 20);
+
+	Pathfinder finder(64, 64, 1024);
+	std::vector<Tile_point> path;
+	path.reserve(256);
+	Flow_field field;
+
+	const int queries = 20;
+	uint32_t astar_us = 0, jps_us = 0, flow_us = 0;
+	int found = 0;
+	for (int q = 0; q < queries; q++) {
+		Tile_point start = {static_cast<int16_t>(gen.bounded(64)), static_cast<int16_t>(gen.bounded(64))};
+		Tile_point goal = {static_cast<int16_t>(gen.bounded(64)), static_cast<int16_t>(gen.bounded(64))};
+		grid.set_walkable(start.x, start.y, true);
+		grid.set_walkable(goal.x, goal.y, true);
+
+		uint32_t t = time_us_32();
+		found += finder.find_path(grid, start, goal, path) == Path_status::found;
+		astar_us += time_us_32() - t;
+
+		t = time_us_32();
+		finder.find_path_jps(grid, start, goal, path);
+		jps_us += time_us_32() - t;
+
+		t = time_us_32();
+		finder.build_flow_field(grid, goal, field);
+		flow_us += time_us_32() - t;
+	}
+	printf("[BENCH] 64x64 map, %d queries (%d found), per query: A* %lu us, JPS %lu us, flow field %lu us\n",
+		queries, found, astar_us / queries, jps_us / queries, flow_us / queries);
+}
+
+void animation_benchmark() {
+	// 8 clips of 4..11 frames, 1000 animated entities (13 KB of SoA state)
+	static Animation_frame frames[8][11];
+	Animation_clip clips[8];
+	for (int c = 0; c < 8; c++) {
+		for (int f = 0; f < 4 + c; f++) frames[c][f] = {static_cast<uint16_t>(f % 3), Fixed_q16(0.05 + 0.01 * c)};
+		clips[c] = {frames[c], static_cast<uint16_t>(4 + c), c % 3 == 0 ? Animation_mode::ping_pong : Animation_mode::loop};
+	}
+
+	Animation_system animations(clips);
+	Random::Xoshiro128 gen(4);
+	const uint32_t entities = 1000;
+	for (uint32_t id = 0; id < entities; id++) animations.play(id, static_cast<uint16_t>(gen.bounded(8)));
+
+	const int updates = 100;
+	const Fixed_q16 dt = Fixed_q16(1) / 30;
+	uint32_t checksum = 0;
+	uint32_t t = time_us_32();
+	for (int u = 0; u < updates; u++) {
+		animations.update(dt);
+		for (uint16_t atlas_frame : animations.atlas_frames()) checksum += atlas_frame;
+	}
+	uint32_t frame_us = (time_us_32() - t) / updates;
+
+	printf("[BENCH] %lu animations: %lu us per frame, checksum %lu\n", entities, frame_us, checksum);
+}
+
+void palette_cycling_test() {
+	// 8bpp mode: 2 x 20 KB buffers, palette applied while flushing
+	namespace Indexed = Indexed_framebuffer;
+
+	uint16_t ramp[16];
+	for (int i = 0; i < 16; i++) ramp[i] = static_cast<uint16_t>(((i * 2) << 11) | ((i * 4) << 5) | 31);
+	Indexed::set_palette(1, ramp, 16);
+
+	for (int y = 0; y < DISPLAY_HEIGHT; y++)
+		for (int x = 0; x < DISPLAY_WIDTH; x++)
+			Indexed::set_pixel(x, y, 1 + ((x + y) / 8) % 16);
+	Indexed::swap_buffers();
+
+	uint32_t flush_us = 0;
+	for (int frame = 0; ; frame++) {
+		Indexed::rotate_palette(1, 16);
+		uint32_t t = time_us_32();
+		Indexed::send_to_display();
+		flush_us += time_us_32() - t;
+		if (frame % 100 == 99) {
+			printf("[BENCH] 8bpp flush: %lu us per frame\n", flush_us / 100);
+			flush_us = 0;
+		}
+		sleep_ms(30);
+	}
+}
+
+void strip_renderer_test() {
+	// No framebuffer: 2 x 16 line strips = 10 KB at 160x128
+	static Strip_renderer strips(DISPLAY_WIDTH, DISPLAY_HEIGHT, 16, 128);
+	int x = 0;
+
+	for (int frame = 0; ; frame++) {
+		uint32_t t = time_us_32();
+		strips.begin(COLORS[3].value);
+		strips.draw_rectangle(0, DISPLAY_HEIGHT - 20, DISPLAY_WIDTH, 20, COLORS[1].value);
+		strips.draw_sprite_planes(skeleton_alpha_sprite, x - skeleton_alpha_width, 40);
+		strips.draw_sprite_planes(wizard_sprite, DISPLAY_WIDTH - x, 70);
+
+		strips.render([](uint16_t y, uint16_t count, uint16_t* pixels) {
+			size_t pixel_count = DISPLAY_WIDTH * count;
+			for (size_t i = 0; i < pixel_count; i++) pixels[i] = __builtin_bswap16(pixels[i]);
+			set_window(0, y, DISPLAY_WIDTH - 1, y + count - 1);
+			send_data(reinterpret_cast<uint8_t*>(pixels), pixel_count * 2);
+		});
+		if (frame % 100 == 0) printf("[BENCH] strip frame: %lu us\n", time_us_32() - t);
+
+		x = (x + 1) % (DISPLAY_WIDTH + wizard_width);
+	}
+}
+
+void sprite_transform_benchmark() {
+	// 200 wizards per variant: 1:1 blit, mirrored, scaled, rotated
+	Sprite_transform variants[4];
+	variants[1].flip_x = true;
+	variants[2].scale_x = variants[2].scale_y = 1.5_q16;
+	variants[3].angle = Fixed_math::to_angle(Fixed_math::PI / 6);
+	const char* names[4] = {"1:1", "flip_x", "scale 1.5", "rotate 30"};
+
+	for (int v = 0; v < 4; v++) {
+		fill_with_color(COLORS[4].value);
+		uint32_t t = time_us_32();
+		for (int i = 0; i < 200; i++) {
+			int x = (i * 37) % DISPLAY_WIDTH - 20;
+			int y = (i * 23) % DISPLAY_HEIGHT - 20;
+			if (v == 0) draw_sprite_planes(wizard_sprite, x, y);
+			else draw_sprite_transformed(wizard_sprite, x, y, variants[v]);
+		}
+		uint32_t elapsed = time_us_32() - t;
+		swap_buffers();
+		send_to_display();
+		printf("[BENCH] 200 sprites %s: %lu us\n", names[v], elapsed);
+		sleep_ms(500);
+	}
+}
+
+void particle_benchmark() {
+	// 2000 sparks alive (40 KB of SoA state), one step + draw per frame
+	const uint32_t particles = 2000;
+	Particle_system system(particles);
+	system.set_gravity(0, 100);
+	static const uint16_t colors[] = {0xFFE0, 0xFD20, 0xF800};
+	Particle_emitter sparks;
+	sparks.x = DISPLAY_WIDTH / 2;
+	sparks.y = DISPLAY_HEIGHT / 2;
+	sparks.spread = 0xFFFF;
+	sparks.speed_min = 10;
+	sparks.speed_max = 60;
+	sparks.life_min = 0.8_q16;
+	sparks.life_max = 1.2_q16;
+	sparks.colors = colors;
+
+	uint32_t step_us = 0, draw_us = 0;
+	const int frames = 120;
+	for (int frame = 0; frame < frames; frame++) {
+		system.emit(sparks, particles / 60);
+		uint32_t t = time_us_32();
+		system.step();
+		uint32_t t1 = time_us_32();
+		fill_with_color(0x0000);
+		uint32_t t2 = time_us_32();
+		system.draw_points();
+		uint32_t t3 = time_us_32();
+		step_us += t1 - t;
+		draw_us += t3 - t2;
+		swap_buffers();
+		send_to_display();
+	}
+	printf("[BENCH] %u particles: step %lu us, draw_points %lu us per frame\n", static_cast<unsigned>(system.size()), step_us / frames, draw_us / frames);
+}
+
+void asset_pack_test() {
+	// assets/characters.pack flashed behind the firmware:
+	// picotool load assets/characters.pack -t bin -o 0x10100000
+	Asset_pack pack;
+	uint32_t t = time_us_32();
+	if (!pack.open_flash()) return;
+	Sprite_asset wizard{};
+	bool found = pack.sprite("wizard", wizard);
+	uint32_t open_us = time_us_32() - t;
+
+	fill_with_color(0x0000);
+	if (found) draw_sprite_alpha(DISPLAY_HEIGHT / 2 - wizard.height / 2, wizard.height, DISPLAY_WIDTH / 2 - wizard.width / 2, wizard.width, wizard.pixels);
+	swap_buffers();
+	send_to_display();
+	printf("[BENCH] pack open + lookup from XIP flash: %lu us, %u assets\n", open_us, static_cast<unsigned>(pack.entries().size()));
+}
+
+void lz_benchmark() {
+	// assets/characters_lz.pack flashed behind the firmware:
+	// picotool load assets/characters_lz.pack -t bin -o 0x10100000
+	Asset_pack pack;
+	if (!pack.open_flash()) return;
+	static uint8_t window[4096];
+	uint32_t raw_total = 0;
+	uint32_t decode_us = 0;
+	uint32_t checksum = 0;
+	for (const Pack_entry& entry : pack.entries()) {
+		Lz_stream stream;
+		if (!pack.stream(entry.name, stream) || stream.chunk_size() > sizeof(window)) continue;
+		uint32_t t = time_us_32();
+		stream.decode_chunks(window, sizeof(window), [&](uint32_t, const uint8_t* data, uint32_t size) { checksum += data[size / 2]; });
+		decode_us += time_us_32() - t;
+		raw_total += stream.raw_size();
+	}
+	printf("[BENCH] lz decode from XIP flash: %lu bytes in %lu us (checksum %lu)\n", raw_total, decode_us, checksum);
+}
+
+void level_stream_benchmark() {
+	// 128x128 tiles in 16x16 chunks built in RAM (a flash level uses the same storage),
+	// camera crossing it diagonally: cost of update() per frame
+	alignas(4) static uint8_t level_file[sizeof(Level_header) + 128 * 128 * 2];
+	Level_header header = {LEVEL_MAGIC, LEVEL_VERSION, 0, 128, 128, 16, 16};
+	memcpy(level_file, &header, sizeof(header));
+	uint16_t* tiles = reinterpret_cast<uint16_t*>(level_file + sizeof(header));
+	for (int i = 0; i < 128 * 128; i++) tiles[i] = static_cast<uint16_t>(i & 0x7FFF);
+
+	Memory_level_storage storage(level_file, sizeof(level_file));
+	Level_stream level(storage, 16);
+	if (!level.open()) return;
+	level.load_view(0, 0, 20, 16);
+	uint32_t update_us = 0;
+	const int frames = 100;
+	for (int frame = 0; frame < frames; frame++) {
+		uint32_t t = time_us_32();
+		level.update(frame, frame, 20, 16);
+		update_us += time_us_32() - t;
+	}
+	printf("[BENCH] level stream: update %lu us per frame, %u reads, %u missed frames\n", update_us / frames,
+		static_cast<unsigned>(level.stats().reads), static_cast<unsigned>(level.stats().misses));
+}
+
+void sd_card_test() {
+	// FAT32 card with characters.pack copied to its root
+	Sd_block_device card;
+	if (!card.init()) return;
+	Sector_cache cache(card, 8, 4);
+	Fat_volume volume(cache);
+	Fat_file file;
+	if (!volume.mount() || !volume.open("/characters.pack", file)) return;
+	printf("card: %lu blocks, characters.pack %lu bytes, %s\n", card.block_count(), file.size(), file.is_contiguous() ? "contiguous" : "fragmented");
+
+	static uint8_t buffer[8192];
+	card.reset_stats();
+	cache.reset_stats();
+	uint32_t t = time_us_32();
+	uint32_t total = 0;
+	int32_t read;
+	while ((read = file.read(buffer, sizeof(buffer))) > 0) total += read;
+	uint32_t read_us = time_us_32() - t;
+	printf("[BENCH] sd read %lu bytes in %lu us: %lu commands, %lu blocks, cache %lu hits / %lu misses\n", total, read_us,
+		card.stats().commands, card.stats().blocks, cache.stats().hits, cache.stats().misses);
+}
+
+void profiler_benchmark() {
+	// particle_benchmark scene with zones, send_to_display records "flush" itself
+	const uint32_t particles = 2000;
+	Particle_system system(particles);
+	system.set_gravity(0, 100);
+	static const uint16_t colors[] = {0xFFE0, 0xFD20, 0xF800};
+	Particle_emitter sparks;
+	sparks.x = DISPLAY_WIDTH / 2;
+	sparks.y = DISPLAY_HEIGHT / 2;
+	sparks.spread = 0xFFFF;
+	sparks.speed_min = 10;
+	sparks.speed_max = 60;
+	sparks.life_min = 0.8_q16;
+	sparks.life_max = 1.2_q16;
+	sparks.colors = colors;
+
+	Profiler::clear();
+	for (int frame = 0; frame < 60; frame++) {
+		PROFILE_ZONE("frame");
+		{
+			PROFILE_ZONE("logic");
+			system.emit(sparks, particles / 60);
+			system.step();
+		}
+		{
+			PROFILE_ZONE("render");
+			fill_with_color(0x0000);
+			system.draw_points();
+		}
+		swap_buffers();
+		send_to_display();
+	}
+	Profiler::print_stats();
+	// Copy from the serial monitor into trace.json, open in ui.perfetto.dev
+	Profiler::write_chrome_trace(stdout);
+}
+
+void perf_hud_demo() {
+	// profiler_benchmark scene without end, up + down together shows / hides the HUD
+	const uint32_t particles = 2000;
+	Particle_system system(particles);
+	system.set_gravity(0, 100);
+	static const uint16_t colors[] = {0xFFE0, 0xFD20, 0xF800};
+	Particle_emitter sparks;
+	sparks.x = DISPLAY_WIDTH / 2;
+	sparks.y = DISPLAY_HEIGHT / 2;
+	sparks.spread = 0xFFFF;
+	sparks.speed_min = 10;
+	sparks.speed_max = 60;
+	sparks.life_min = 0.8_q16;
+	sparks.life_max = 1.2_q16;
+	sparks.colors = colors;
+
+	Perf_hud hud;
+	while (true) {
+		PROFILE_ZONE("frame");
+		{
+			PROFILE_ZONE("logic");
+			system.emit(sparks, particles / 60);
+			system.step();
+		}
+		{
+			PROFILE_ZONE("render");
+			fill_with_color(0x0000);
+			system.draw_points();
+		}
+		ButtonState buttons = button_polling();
+		hud.frame(buttons.w && buttons.s);
+		swap_buffers();
+		send_to_display();
+	}
+}
+
 int main(){
 
 	stdio_init_all();
@@ -428,6 +889,20 @@ int main(){
 	// movement_tracking_test_sprite_wizard();
 	// bresenham_line_drawing_test();
 	// diamond_outline_test();
+	// fixed_math_benchmark();
+	// collision_benchmark();
+	// pathfinding_benchmark();
+	// animation_benchmark();
+	// palette_cycling_test();
+	// strip_renderer_test();
+	// sprite_transform_benchmark();
+	// particle_benchmark();
+	// asset_pack_test();
+	// lz_benchmark();
+	// level_stream_benchmark();
+	// sd_card_test();
+	// profiler_benchmark();
+	// perf_hud_demo();
 
 	blik();
 
@@ -0,0 +1,104 @@
+// tools/asset_packer/asset_packer.cpp - builds a binary .pack (engine/assets/asset_pack_format.h)
+// Sprites, grid atlases, palettes, indexed sprites, tilemaps and audio in one file with a
+// sorted table of contents, used in place by the engine (mmap / XIP flash), optionally
+// LZ compressed per chunk (decoded into RAM by the engine).
+#define STB_IMAGE_IMPLEMENTATION
+#include "pack_builder.h"
+
+int list_pack(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    std::vector<uint8_t> file((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    Pack_header header;
+    if (file.size() < sizeof(header)) {
+        std::cerr << "Error: " << path << " is not a pack" << std::endl;
+        return 1;
+    }
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (header.magic != PACK_MAGIC || header.toc_offset + uint64_t(header.entry_count) * sizeof(Pack_entry) > file.size()) {
+        std::cerr << "Error: " << path << " is not a pack" << std::endl;
+        return 1;
+    }
+    std::cout << path << ": version " << header.version << ", " << header.entry_count << " assets, " << header.file_size << " bytes\n";
+    for (uint16_t i = 0; i < header.entry_count; i++) {
+        Pack_entry entry;
+        std::memcpy(&entry, &file[header.toc_offset + i * sizeof(Pack_entry)], sizeof(entry));
+        char line[128];
+        std::snprintf(line, sizeof(line), "  %-16s %-8s %5ux%-5u count %-5u offset %8u size %8u%s",
+                      entry.name, type_name(entry.type), entry.width, entry.height, entry.count, entry.offset, entry.size,
+                      (entry.flags & PACK_FLAG_COMPRESSED) ? " lz" : "");
+        std::cout << line << "\n";
+    }
+    return 0;
+}
+
+void usage(const char* program) {
+    std::cout << "Asset Packer for PocketGateEngine (.pack, engine/assets/asset_pack.h)\n";
+    std::cout << "Usage:\n";
+    std::cout << "  " << program << " [-o assets.pack] [-c] [-k chunk] [name=]<input>...\n";
+    std::cout << "  " << program << " -l <assets.pack>      list the table of contents\n";
+    std::cout << "\nOptions:\n";
+    std::cout << "  -c          LZ compress every asset that shrinks (decoded into RAM, no longer in place)\n";
+    std::cout << "  -k <bytes>  compressed chunk size = decode window (default 4096, max 65536)\n";
+    std::cout << "\nInputs (name defaults to the file name, at most " << PACK_NAME_LENGTH - 1 << " characters):\n";
+    std::cout << "  image.png | image.sprite   sprite, RGB565 + Alpha8\n";
+    std::cout << "  sheet.png:WxH              atlas, one frame per WxH cell\n";
+    std::cout << "  colors.png:palette         palette, every opaque pixel in order\n";
+    std::cout << "  image.png:indexed          8bpp sprite + <name>_pal palette (index 0 = transparent)\n";
+    std::cout << "  level.csv                  tilemap (Tiled CSV export)\n";
+    std::cout << "  sound.wav                  audio, 8/16 bit PCM\n";
+}
+
+int main(int argc, char** argv) {
+    std::string output = "assets.pack";
+    std::vector<std::string> inputs;
+    bool compress = false;
+    long chunk_size = 4096;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc) output = argv[++i];
+        else if (arg == "-c") compress = true;
+        else if (arg == "-k" && i + 1 < argc) chunk_size = std::strtol(argv[++i], nullptr, 10);
+        else if (arg == "-l" && i + 1 < argc) return list_pack(argv[++i]);
+        else if (arg[0] == '-') {
+            usage(argv[0]);
+            return 1;
+        }
+        else inputs.push_back(arg);
+    }
+    if (inputs.empty()) {
+        usage(argv[0]);
+        return 1;
+    }
+    if (chunk_size < 16 || chunk_size > LZ_MAX_CHUNK_SIZE) {
+        std::cerr << "Error: chunk size must be 16 to " << LZ_MAX_CHUNK_SIZE << " bytes" << std::endl;
+        return 1;
+    }
+
+    std::vector<Asset> assets;
+    for (const std::string& input : inputs) {
+        std::string path = input;
+        std::string name;
+        size_t equals = path.find('=');
+        if (equals != std::string::npos) {
+            name = path.substr(0, equals);
+            path = path.substr(equals + 1);
+        }
+        std::string option;
+        size_t colon = path.find_last_of(':');
+        if (colon != std::string::npos && colon > 1) {      // not a drive letter
+            option = path.substr(colon + 1);
+            path = path.substr(0, colon);
+        }
+        if (name.empty()) name = stem(path);
+
+        if (!load_asset(path, option, name, assets)) return 1;
+        const Asset& asset = assets.back();
+        std::cout << "  " << asset.entry.name << ": " << type_name(asset.entry.type) << " from " << path
+                  << ", " << asset.payload.size() << " bytes" << std::endl;
+    }
+
+    if (!write_pack(output, assets, compress ? static_cast<uint32_t>(chunk_size) : 0)) return 1;
+    std::cout << "Success: Generated " << output << " (" << assets.size() << " assets)" << std::endl;
+    return 0;
+}
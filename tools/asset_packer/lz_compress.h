@@ -0,0 +1,114 @@
+// tools/asset_packer/lz_compress.h - LZ4 block format compressor for pack payloads
+// Hash chains over 4 byte prefixes, greedy parse. Decoded by engine/assets/lz_stream.cpp.
+#ifndef LZ_COMPRESS_H
+#define LZ_COMPRESS_H
+
+#include "../../engine/assets/asset_pack_format.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+const int LZ_MIN_MATCH = 4;
+const int LZ_LAST_LITERALS = 5;     // block ends with at least 5 literals
+const int LZ_MATCH_LIMIT = 12;      // no match starts in the last 12 bytes
+const int LZ_HASH_BITS = 14;
+const int LZ_MAX_OFFSET = 65535;
+
+inline uint32_t lz_read32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, 4);
+    return value;
+}
+
+inline uint32_t lz_hash(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+inline void lz_put_length(std::vector<uint8_t>& out, size_t length) {
+    for (; length >= 255; length -= 255) out.push_back(255);
+    out.push_back(static_cast<uint8_t>(length));
+}
+
+inline void lz_put_sequence(std::vector<uint8_t>& out, const uint8_t* literals, size_t literal_count, uint32_t offset, size_t match_length) {
+    size_t match_code = match_length ? match_length - LZ_MIN_MATCH : 0;
+    out.push_back(static_cast<uint8_t>(((literal_count < 15 ? literal_count : 15) << 4) | (match_code < 15 ? match_code : 15)));
+    if (literal_count >= 15) lz_put_length(out, literal_count - 15);
+    out.insert(out.end(), literals, literals + literal_count);
+    if (match_length == 0) return;      // last sequence
+    out.push_back(offset & 0xFF);
+    out.push_back(offset >> 8);
+    if (match_code >= 15) lz_put_length(out, match_code - 15);
+}
+
+// One block, attempts = chain candidates tried per position (more = smaller, slower)
+inline std::vector<uint8_t> lz_compress_block(const uint8_t* src, size_t size, int attempts = 64) {
+    std::vector<uint8_t> out;
+    std::vector<int32_t> head(size_t(1) << LZ_HASH_BITS, -1);
+    std::vector<int32_t> chain(size, -1);
+
+    auto insert = [&](size_t pos) {
+        uint32_t h = lz_hash(lz_read32(src + pos));
+        chain[pos] = head[h];
+        head[h] = static_cast<int32_t>(pos);
+    };
+
+    size_t anchor = 0;
+    size_t pos = 0;
+    const size_t match_end = size > LZ_LAST_LITERALS ? size - LZ_LAST_LITERALS : 0;
+    while (pos + LZ_MATCH_LIMIT <= size) {
+        size_t best_length = 0;
+        size_t best_offset = 0;
+        uint32_t sequence = lz_read32(src + pos);
+        int32_t candidate = head[lz_hash(sequence)];
+        for (int tries = attempts; candidate >= 0 && tries > 0 && pos - candidate <= LZ_MAX_OFFSET; tries--) {
+            if (lz_read32(src + candidate) == sequence) {
+                size_t length = LZ_MIN_MATCH;
+                while (pos + length < match_end && src[candidate + length] == src[pos + length]) length++;
+                if (length > best_length) {
+                    best_length = length;
+                    best_offset = pos - candidate;
+                }
+            }
+            candidate = chain[candidate];
+        }
+        insert(pos);
+
+        if (best_length < LZ_MIN_MATCH) {
+            pos++;
+            continue;
+        }
+        lz_put_sequence(out, src + anchor, pos - anchor, static_cast<uint32_t>(best_offset), best_length);
+        for (size_t i = 1; i < best_length && pos + i + 4 <= size; i++) insert(pos + i);
+        pos += best_length;
+        anchor = pos;
+    }
+    lz_put_sequence(out, src + anchor, size - anchor, 0, 0);
+    return out;
+}
+
+// Chunked stream (asset_pack_format.h), chunks that do not shrink are stored raw
+inline std::vector<uint8_t> lz_compress_stream(const std::vector<uint8_t>& raw, uint32_t chunk_size, int attempts = 64) {
+    uint32_t chunk_count = static_cast<uint32_t>((raw.size() + chunk_size - 1) / chunk_size);
+    Lz_header header = {LZ_MAGIC, static_cast<uint32_t>(raw.size()), chunk_size, chunk_count};
+
+    std::vector<uint32_t> ends;
+    std::vector<uint8_t> data;
+    for (uint32_t i = 0; i < chunk_count; i++) {
+        size_t start = size_t(i) * chunk_size;
+        size_t length = std::min<size_t>(chunk_size, raw.size() - start);
+        std::vector<uint8_t> block = lz_compress_block(raw.data() + start, length, attempts);
+        bool stored = block.size() >= length;
+        if (stored) data.insert(data.end(), raw.begin() + start, raw.begin() + start + length);
+        else data.insert(data.end(), block.begin(), block.end());
+        ends.push_back(static_cast<uint32_t>(data.size()) | (stored ? LZ_STORED : 0));
+    }
+
+    std::vector<uint8_t> stream(sizeof(header) + ends.size() * 4);
+    std::memcpy(stream.data(), &header, sizeof(header));
+    std::memcpy(stream.data() + sizeof(header), ends.data(), ends.size() * 4);
+    stream.insert(stream.end(), data.begin(), data.end());
+    return stream;
+}
+
+#endif
@@ -0,0 +1,421 @@
+// tools/asset_packer/pack_builder.h - asset loaders and .pack writer shared by asset_packer and assetc
+// Include after defining STB_IMAGE_IMPLEMENTATION in the tool's .cpp (one translation unit per tool).
+#ifndef PACK_BUILDER_H
+#define PACK_BUILDER_H
+
+#include "../stb_image.h"
+#include "../png_to_sprite/quantize.h"
+#include "../../engine/assets/asset_pack_format.h"
+#include "../../engine/assets/level_format.h"
+#include "lz_compress.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct Asset {
+    Pack_entry entry = {};
+    std::vector<uint8_t> payload;
+    std::string source;
+};
+
+// Same threshold as png_to_sprite_indexed (indexed sprites are not blended)
+const uint8_t ALPHA_OPAQUE = 128;
+
+inline bool ends_with(const std::string& s, const std::string& suffix) {
+    return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+inline std::string stem(const std::string& path) {
+    size_t slash = path.find_last_of("/\\");
+    std::string file = (slash == std::string::npos) ? path : path.substr(slash + 1);
+    size_t dot = file.find_last_of('.');
+    return (dot == std::string::npos) ? file : file.substr(0, dot);
+}
+
+inline std::string lower(const std::string& text) {
+    std::string out;
+    for (char c : text) out += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    return out;
+}
+
+// Little-endian appends (the pack is little-endian whatever the host)
+inline void put16(std::vector<uint8_t>& out, uint16_t value) {
+    out.push_back(value & 0xFF);
+    out.push_back(value >> 8);
+}
+
+inline void put_sprite_pixel(std::vector<uint8_t>& out, uint16_t color, uint8_t alpha) {
+    put16(out, color);
+    out.push_back(alpha);
+    out.push_back(0);
+}
+
+inline bool set_size(Asset& asset, int width, int height) {
+    if (width <= 0 || height <= 0 || width > 0xFFFF || height > 0xFFFF) {
+        std::cerr << "Error: " << asset.source << " is " << width << "x" << height << ", limit is 65535x65535" << std::endl;
+        return false;
+    }
+    asset.entry.width = static_cast<uint16_t>(width);
+    asset.entry.height = static_cast<uint16_t>(height);
+    return true;
+}
+
+inline unsigned char* load_rgba(const std::string& path, int& width, int& height) {
+    int channels;
+    unsigned char* img = stbi_load(path.c_str(), &width, &height, &channels, 4);
+    if (!img) std::cerr << "Error: Failed to load " << path << std::endl;
+    return img;
+}
+
+inline bool load_sprite_png(const std::string& path, Asset& asset) {
+    int width, height;
+    unsigned char* img = load_rgba(path, width, height);
+    if (!img) return false;
+    bool ok = set_size(asset, width, height);
+    for (int i = 0; ok && i < width * height; i++) {
+        const unsigned char* p = &img[i * 4];
+        put_sprite_pixel(asset.payload, rgb_to_rgb565(p[0], p[1], p[2]), p[3]);
+    }
+    stbi_image_free(img);
+    asset.entry.type = Asset_type::sprite;
+    return ok;
+}
+
+// .sprite from png_to_sprite_alpha: uint16 width, uint16 height, then RGB565 (LE) + Alpha8 per pixel
+inline bool load_sprite_file(const std::string& path, Asset& asset) {
+    std::ifstream in(path, std::ios::binary);
+    uint8_t header[4];
+    if (!in.read(reinterpret_cast<char*>(header), 4)) {
+        std::cerr << "Error: Failed to read " << path << std::endl;
+        return false;
+    }
+    if (!set_size(asset, header[0] | (header[1] << 8), header[2] | (header[3] << 8))) return false;
+    size_t pixels = size_t(asset.entry.width) * asset.entry.height;
+    for (size_t i = 0; i < pixels; i++) {
+        uint8_t bytes[3];
+        if (!in.read(reinterpret_cast<char*>(bytes), 3)) {
+            std::cerr << "Error: " << path << " is truncated (expected " << pixels * 3 << " pixel bytes)" << std::endl;
+            return false;
+        }
+        put_sprite_pixel(asset.payload, static_cast<uint16_t>(bytes[0] | (bytes[1] << 8)), bytes[2]);
+    }
+    asset.entry.type = Asset_type::sprite;
+    return true;
+}
+
+// Sprite sheet as an atlas: every cell_w x cell_h cell is a frame (row by row, no trim,
+// frame ids are cell indices). Use tools/atlas_packer for trimmed, packed atlases.
+inline bool load_atlas_grid(const std::string& path, int cell_w, int cell_h, Asset& asset) {
+    int width, height;
+    unsigned char* img = load_rgba(path, width, height);
+    if (!img) return false;
+    if (!set_size(asset, width, height)) {
+        stbi_image_free(img);
+        return false;
+    }
+
+    std::vector<uint8_t> frames;
+    int count = 0;
+    for (int y = 0; y + cell_h <= height; y += cell_h) {
+        for (int x = 0; x + cell_w <= width; x += cell_w) {
+            // x, y, width, height, offset_x, offset_y, source_width, source_height
+            for (int value : {x, y, cell_w, cell_h, 0, 0, cell_w, cell_h}) put16(frames, static_cast<uint16_t>(value));
+            count++;
+        }
+    }
+    if (count == 0 || count > 0xFFFF) {
+        std::cerr << "Error: " << path << " has " << count << " cells of " << cell_w << "x" << cell_h << std::endl;
+        stbi_image_free(img);
+        return false;
+    }
+
+    asset.payload = frames;
+    for (int i = 0; i < width * height; i++) {
+        const unsigned char* p = &img[i * 4];
+        put_sprite_pixel(asset.payload, rgb_to_rgb565(p[0], p[1], p[2]), p[3]);
+    }
+    stbi_image_free(img);
+    asset.entry.type = Asset_type::atlas;
+    asset.entry.count = static_cast<uint16_t>(count);
+    return true;
+}
+
+// Palette strip: every opaque pixel is a color, in order, duplicates kept
+inline bool load_palette_png(const std::string& path, Asset& asset) {
+    int width, height;
+    unsigned char* img = load_rgba(path, width, height);
+    if (!img) return false;
+    int count = 0;
+    for (int i = 0; i < width * height && count < 0xFFFF; i++) {
+        const unsigned char* p = &img[i * 4];
+        if (p[3] < ALPHA_OPAQUE) continue;
+        put16(asset.payload, rgb_to_rgb565(p[0], p[1], p[2]));
+        count++;
+    }
+    stbi_image_free(img);
+    if (count == 0) {
+        std::cerr << "Error: " << path << " has no opaque pixels for a palette" << std::endl;
+        return false;
+    }
+    asset.entry.type = Asset_type::palette;
+    asset.entry.count = static_cast<uint16_t>(count);
+    return true;
+}
+
+// 8bpp sprite with its own palette (second asset, index 0 = transparent), more than 255
+// colors are quantized and Floyd-Steinberg dithered like png_to_sprite_indexed
+inline bool load_indexed_png(const std::string& path, Asset& asset, Asset& palette) {
+    int width, height;
+    unsigned char* img = load_rgba(path, width, height);
+    if (!img) return false;
+    if (!set_size(asset, width, height)) {
+        stbi_image_free(img);
+        return false;
+    }
+
+    bool exact;
+    const Rgba_image image = {img, width, height};
+    std::vector<uint16_t> colors = build_palette({image}, ALPHA_OPAQUE, 255, KMEANS_PASSES, exact);
+    Palette_lookup lookup(colors, exact);
+    remap_image(image, ALPHA_OPAQUE, lookup, colors.size(), exact ? Dither::none : Dither::floyd_steinberg, 1, asset.payload);
+    stbi_image_free(img);
+    colors.insert(colors.begin(), 0xF81F);      // shown for transparent if the palette is dumped
+    asset.entry.type = Asset_type::indexed_sprite;
+
+    for (uint16_t color : colors) put16(palette.payload, color);
+    palette.entry.type = Asset_type::palette;
+    palette.entry.count = static_cast<uint16_t>(colors.size());
+    palette.source = path;
+    return true;
+}
+
+// Tiled CSV export: one row per line, tile ids separated by commas
+inline bool load_tilemap_csv(const std::string& path, Asset& asset) {
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << "Error: Failed to open " << path << std::endl;
+        return false;
+    }
+    std::string line;
+    int width = -1, height = 0;
+    while (std::getline(in, line)) {
+        std::stringstream row(line);
+        std::string cell;
+        int columns = 0;
+        while (std::getline(row, cell, ',')) {
+            if (cell.find_first_not_of(" \t\r") == std::string::npos) continue;
+            long tile = std::strtol(cell.c_str(), nullptr, 10);
+            if (tile < 0 || tile > 0xFFFF) {
+                std::cerr << "Error: " << path << " line " << height + 1 << ": tile " << tile << " out of range" << std::endl;
+                return false;
+            }
+            put16(asset.payload, static_cast<uint16_t>(tile));
+            columns++;
+        }
+        if (columns == 0) continue;
+        if (width >= 0 && columns != width) {
+            std::cerr << "Error: " << path << " line " << height + 1 << " has " << columns << " tiles, expected " << width << std::endl;
+            return false;
+        }
+        width = columns;
+        height++;
+    }
+    asset.entry.type = Asset_type::tilemap;
+    return set_size(asset, width, height);
+}
+
+inline uint32_t read32(const uint8_t* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | (uint32_t(p[3]) << 24); }
+inline uint16_t read16(const uint8_t* p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+
+// Tilemap as a streamed .level (Level_stream): chunk after chunk, edge chunks padded with 0
+inline bool write_level(const std::string& output, const Asset& tilemap, uint16_t chunk_width, uint16_t chunk_height) {
+    const uint32_t width = tilemap.entry.width, height = tilemap.entry.height;
+    const uint32_t chunks_x = (width + chunk_width - 1) / chunk_width;
+    const uint32_t chunks_y = (height + chunk_height - 1) / chunk_height;
+
+    Level_header header = {LEVEL_MAGIC, LEVEL_VERSION, 0, tilemap.entry.width, tilemap.entry.height, chunk_width, chunk_height};
+    std::vector<uint8_t> level(sizeof(header));
+    std::memcpy(level.data(), &header, sizeof(header));
+    level.reserve(sizeof(header) + size_t(chunks_x) * chunks_y * chunk_width * chunk_height * 2);
+    for (uint32_t cy = 0; cy < chunks_y; cy++) {
+        for (uint32_t cx = 0; cx < chunks_x; cx++) {
+            for (uint32_t y = cy * chunk_height; y < (cy + 1) * chunk_height; y++) {
+                for (uint32_t x = cx * chunk_width; x < (cx + 1) * chunk_width; x++) {
+                    const bool inside = x < width && y < height;
+                    put16(level, inside ? read16(&tilemap.payload[(size_t(y) * width + x) * 2]) : 0);
+                }
+            }
+        }
+    }
+
+    std::ofstream out(output, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(level.data()), level.size());
+    if (!out) {
+        std::cerr << "Error: Cannot write " << output << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// PCM .wav, 8 or 16 bit
+inline bool load_wav(const std::string& path, Asset& asset) {
+    std::ifstream in(path, std::ios::binary);
+    std::vector<uint8_t> file((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (file.size() < 12 || std::memcmp(file.data(), "RIFF", 4) != 0 || std::memcmp(file.data() + 8, "WAVE", 4) != 0) {
+        std::cerr << "Error: " << path << " is not a WAVE file" << std::endl;
+        return false;
+    }
+
+    bool have_format = false;
+    for (size_t pos = 12; pos + 8 <= file.size();) {
+        const uint8_t* chunk = &file[pos];
+        uint32_t size = read32(chunk + 4);
+        if (pos + 8 + size > file.size()) break;
+
+        if (std::memcmp(chunk, "fmt ", 4) == 0 && size >= 16) {
+            uint16_t format = read16(chunk + 8);
+            uint16_t channels = read16(chunk + 10);
+            uint32_t rate = read32(chunk + 12);
+            uint16_t bits = read16(chunk + 22);
+            if (format != 1 || (bits != 8 && bits != 16) || channels == 0 || channels > 255 || rate > 0xFFFF) {
+                std::cerr << "Error: " << path << ": only 8/16 bit PCM up to 65535 Hz is supported" << std::endl;
+                return false;
+            }
+            asset.entry.width = bits;
+            asset.entry.height = channels;
+            asset.entry.count = static_cast<uint16_t>(rate);
+            have_format = true;
+        }
+        else if (std::memcmp(chunk, "data", 4) == 0 && have_format) {
+            asset.payload.assign(chunk + 8, chunk + 8 + size);
+            asset.entry.type = Asset_type::audio;
+            // Odd trailing bytes of a broken file would not make a whole sample frame
+            asset.payload.resize(asset.payload.size() - asset.payload.size() % ((asset.entry.width / 8) * asset.entry.height));
+            return !asset.payload.empty();
+        }
+        pos += 8 + size + (size & 1);
+    }
+    std::cerr << "Error: " << path << " has no PCM data" << std::endl;
+    return false;
+}
+
+inline bool set_name(Asset& asset, const std::string& name) {
+    if (name.empty() || name.size() >= PACK_NAME_LENGTH) {
+        std::cerr << "Error: asset name '" << name << "' must be 1 to " << PACK_NAME_LENGTH - 1 << " characters" << std::endl;
+        return false;
+    }
+    std::memset(asset.entry.name, 0, PACK_NAME_LENGTH);
+    std::memcpy(asset.entry.name, name.data(), name.size());
+    return true;
+}
+
+inline const char* type_name(Asset_type type) {
+    switch (type) {
+        case Asset_type::sprite: return "sprite";
+        case Asset_type::indexed_sprite: return "indexed";
+        case Asset_type::atlas: return "atlas";
+        case Asset_type::palette: return "palette";
+        case Asset_type::tilemap: return "tilemap";
+        case Asset_type::audio: return "audio";
+    }
+    return "?";
+}
+
+inline bool write_pack(const std::string& output, std::vector<Asset>& assets, uint32_t chunk_size) {
+    std::sort(assets.begin(), assets.end(), [](const Asset& a, const Asset& b) {
+        return std::strncmp(a.entry.name, b.entry.name, PACK_NAME_LENGTH) < 0;
+    });
+    for (size_t i = 1; i < assets.size(); i++) {
+        if (std::strncmp(assets[i - 1].entry.name, assets[i].entry.name, PACK_NAME_LENGTH) == 0) {
+            std::cerr << "Error: two assets named " << assets[i].entry.name << " (" << assets[i - 1].source
+                      << ", " << assets[i].source << ")" << std::endl;
+            return false;
+        }
+    }
+
+    // Header, table of contents, then the aligned payloads
+    uint64_t offset = sizeof(Pack_header) + assets.size() * sizeof(Pack_entry);
+    size_t raw_total = 0;
+    for (Asset& asset : assets) {
+        uint32_t raw_size = static_cast<uint32_t>(asset.payload.size());
+        if (pack_payload_size(asset.entry, raw_size) != raw_size) {
+            std::cerr << "Error: " << asset.source << ": payload does not match its size" << std::endl;
+            return false;
+        }
+        raw_total += raw_size;
+
+        // Compressed only when it saves something
+        if (chunk_size != 0) {
+            std::vector<uint8_t> stream = lz_compress_stream(asset.payload, chunk_size);
+            if (stream.size() < asset.payload.size()) {
+                std::cout << "  " << asset.entry.name << ": " << raw_size << " -> " << stream.size() << " bytes ("
+                          << 100 * stream.size() / raw_size << "%)" << std::endl;
+                asset.payload = stream;
+                asset.entry.flags |= PACK_FLAG_COMPRESSED;
+            }
+        }
+
+        offset = (offset + PACK_ALIGNMENT - 1) / PACK_ALIGNMENT * PACK_ALIGNMENT;
+        asset.entry.offset = static_cast<uint32_t>(offset);
+        asset.entry.size = static_cast<uint32_t>(asset.payload.size());
+        offset += asset.payload.size();
+    }
+    if (offset > UINT32_MAX || assets.size() > 0xFFFF) {
+        std::cerr << "Error: pack too large" << std::endl;
+        return false;
+    }
+
+    Pack_header header = {PACK_MAGIC, PACK_VERSION, static_cast<uint16_t>(assets.size()),
+                          static_cast<uint32_t>(sizeof(Pack_header)), static_cast<uint32_t>(offset)};
+    std::vector<uint8_t> file(offset, 0);
+    std::memcpy(file.data(), &header, sizeof(header));
+    for (size_t i = 0; i < assets.size(); i++) {
+        std::memcpy(&file[sizeof(Pack_header) + i * sizeof(Pack_entry)], &assets[i].entry, sizeof(Pack_entry));
+        std::copy(assets[i].payload.begin(), assets[i].payload.end(), file.begin() + assets[i].entry.offset);
+    }
+
+    std::ofstream out(output, std::ios::binary);
+    if (!out || !out.write(reinterpret_cast<const char*>(file.data()), file.size())) {
+        std::cerr << "Error: Cannot write " << output << std::endl;
+        return false;
+    }
+    if (chunk_size != 0) std::cout << "  Compressed: " << raw_total << " -> " << file.size() << " bytes" << std::endl;
+    return true;
+}
+
+// One input (asset_packer syntax, option is what follows ':'), the indexed option also
+// appends its <name>_pal palette
+inline bool load_asset(const std::string& path, const std::string& option, const std::string& name, std::vector<Asset>& assets) {
+    Asset asset;
+    asset.source = path;
+    std::string extension = lower(path.substr(path.find_last_of('.') + 1));
+    int cell_w = 0, cell_h = 0;
+    bool loaded = false;
+
+    if (option == "indexed") {
+        Asset palette;
+        loaded = load_indexed_png(path, asset, palette) && set_name(palette, name + "_pal");
+        if (loaded) assets.push_back(palette);
+    }
+    else if (option == "palette") loaded = load_palette_png(path, asset);
+    else if (std::sscanf(option.c_str(), "%dx%d", &cell_w, &cell_h) == 2 && cell_w > 0 && cell_h > 0) loaded = load_atlas_grid(path, cell_w, cell_h, asset);
+    else if (!option.empty()) std::cerr << "Error: unknown option :" << option << " for " << path << std::endl;
+    else if (extension == "sprite") loaded = load_sprite_file(path, asset);
+    else if (extension == "csv") loaded = load_tilemap_csv(path, asset);
+    else if (extension == "wav") loaded = load_wav(path, asset);
+    else loaded = load_sprite_png(path, asset);
+
+    if (!loaded || !set_name(asset, name)) return false;
+    assets.push_back(asset);
+    return true;
+}
+
+#endif
@@ -0,0 +1,422 @@
+// tools/assetc/assetc.cpp - incremental, parallel asset build
+// Scans an asset directory, converts every source on all cores and emits a .pack and / or
+// sprite headers in one pass. Each conversion is cached by the hash of its source, so a
+// rebuild only converts what changed. --watch rebuilds whenever a source changes.
+//
+// Asset kind from the file name (name = file name up to the first '.', lower case):
+//   name.png              sprite, RGB565 + Alpha8
+//   name.WxH.png          atlas, one frame per WxH cell
+//   name.palette.png      palette
+//   name.indexed.png      8bpp sprite + name_pal palette
+//   name.csv              tilemap (also name.level with --levels)
+//   name.wav              audio
+#define STB_IMAGE_IMPLEMENTATION
+#include "../asset_packer/pack_builder.h"
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+// Bump when a conversion changes, invalidates every cached asset
+const uint32_t ASSETC_VERSION = 2;
+
+struct Job {
+    fs::path source;
+    std::string relative;       // to the asset directory, cache key
+    std::string name;
+    std::string option;         // asset_packer option (WxH, palette, indexed)
+    uint64_t hash = 0;
+    bool converted = false;     // not taken from the cache
+    bool ok = false;
+    std::vector<Asset> assets;
+};
+
+struct Options {
+    fs::path input = "assets";
+    fs::path output = "build/assets";
+    std::string pack;           // empty = no pack
+    bool headers = false;
+    bool levels = false;
+    uint16_t chunk_width = 16;  // .level chunks, tiles
+    uint16_t chunk_height = 16;
+    bool compress = false;
+    long chunk_size = 4096;
+    unsigned threads = 0;       // 0 = every core
+};
+
+uint64_t fnv1a(const uint8_t* data, size_t size, uint64_t hash = 0xCBF29CE484222325ull) {
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+bool read_file(const fs::path& path, std::vector<uint8_t>& data) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    data.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return true;
+}
+
+std::string hex(uint64_t value) {
+    char text[17];
+    std::snprintf(text, sizeof(text), "%016llx", static_cast<unsigned long long>(value));
+    return text;
+}
+
+// Kind from the file name, false for files that are not asset sources (.h, .sprite, .pack...)
+bool classify(const fs::path& path, std::string& name, std::string& option) {
+    std::string file = lower(path.filename().string());
+    size_t dot = file.find('.');
+    if (dot == 0 || dot == std::string::npos) return false;
+    std::string extension = file.substr(file.find_last_of('.') + 1);
+    if (extension != "png" && extension != "csv" && extension != "wav") return false;
+
+    name = file.substr(0, dot);
+    for (char& c : name) {
+        if (!std::isalnum(static_cast<unsigned char>(c))) c = '_';
+    }
+    option.clear();
+    size_t last = file.find_last_of('.');
+    if (last > dot) {
+        std::string middle = file.substr(dot + 1, last - dot - 1);
+        int cell_w = 0, cell_h = 0;
+        if (extension != "png") return false;
+        if (middle == "palette" || middle == "indexed") option = middle;
+        else if (std::sscanf(middle.c_str(), "%dx%d", &cell_w, &cell_h) == 2) option = middle;
+        else return false;
+    }
+    return true;
+}
+
+std::vector<Job> scan(const fs::path& input) {
+    std::vector<Job> jobs;
+    std::error_code error;
+    for (fs::recursive_directory_iterator it(input, error), end; !error && it != end; it.increment(error)) {
+        if (!it->is_regular_file()) continue;
+        Job job;
+        if (!classify(it->path(), job.name, job.option)) continue;
+        job.source = it->path();
+        job.relative = fs::relative(it->path(), input).generic_string();
+        jobs.push_back(job);
+    }
+    if (error) std::cerr << "Error: cannot scan " << input.string() << ": " << error.message() << std::endl;
+    // Stable order whatever the directory listing order is
+    std::sort(jobs.begin(), jobs.end(), [](const Job& a, const Job& b) { return a.relative < b.relative; });
+    return jobs;
+}
+
+// Cached conversion: count, then per asset Pack_entry, uint32 payload size, payload
+bool save_cached(const fs::path& path, const std::vector<Asset>& assets) {
+    std::ofstream out(path, std::ios::binary);
+    uint32_t count = static_cast<uint32_t>(assets.size());
+    out.write(reinterpret_cast<const char*>(&count), 4);
+    for (const Asset& asset : assets) {
+        uint32_t size = static_cast<uint32_t>(asset.payload.size());
+        out.write(reinterpret_cast<const char*>(&asset.entry), sizeof(Pack_entry));
+        out.write(reinterpret_cast<const char*>(&size), 4);
+        out.write(reinterpret_cast<const char*>(asset.payload.data()), size);
+    }
+    return static_cast<bool>(out);
+}
+
+bool load_cached(const fs::path& path, const std::string& source, std::vector<Asset>& assets) {
+    std::vector<uint8_t> data;
+    if (!read_file(path, data) || data.size() < 4) return false;
+    uint32_t count;
+    std::memcpy(&count, data.data(), 4);
+    size_t pos = 4;
+    for (uint32_t i = 0; i < count; i++) {
+        Asset asset;
+        uint32_t size;
+        if (pos + sizeof(Pack_entry) + 4 > data.size()) return false;
+        std::memcpy(&asset.entry, &data[pos], sizeof(Pack_entry));
+        std::memcpy(&size, &data[pos + sizeof(Pack_entry)], 4);
+        pos += sizeof(Pack_entry) + 4;
+        if (pos + size > data.size()) return false;
+        asset.payload.assign(data.begin() + pos, data.begin() + pos + size);
+        asset.source = source;
+        pos += size;
+        assets.push_back(asset);
+    }
+    return pos == data.size();
+}
+
+// Same header as sprite_to_cpp_alpha.py: color and alpha planes (Sprite_planes)
+bool write_sprite_header(const fs::path& path, const Job& job, const Asset& asset) {
+    const std::string& name = job.name;
+    std::string guard = "SPRITE_" + name;
+    for (char& c : guard) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    uint32_t pixels = uint32_t(asset.entry.width) * asset.entry.height;
+    const uint8_t* payload = asset.payload.data();       // pack layout: RGB565, alpha, pad
+
+    std::ostringstream out;
+    out << "// Auto-generated from " << job.relative << " by assetc\n";
+    out << "// Sprite dimensions: " << asset.entry.width << "x" << asset.entry.height << "\n";
+    out << "// Format: RGB565 plane + Alpha8 plane (3 bytes per pixel)\n\n";
+    out << "#ifndef " << guard << "_H\n#define " << guard << "_H\n\n";
+    out << "#include <stdint.h>\n#include \"framebuffer.h\"  // For Sprite_planes definition\n\n";
+    out << "inline constexpr uint16_t " << name << "_width = " << asset.entry.width << ";\n";
+    out << "inline constexpr uint16_t " << name << "_height = " << asset.entry.height << ";\n\n";
+    char value[8];
+    out << "inline constexpr uint16_t " << name << "_color[" << pixels << "] = {\n";
+    for (uint32_t i = 0; i < pixels; i++) {
+        std::snprintf(value, sizeof(value), "0x%04X", payload[i * 4] | (payload[i * 4 + 1] << 8));
+        out << ((i % 16 == 0) ? "    " : ",") << value << ((i % 16 == 15 || i + 1 == pixels) ? ",\n" : "");
+    }
+    out << "};\n\n";
+    out << "inline constexpr uint8_t " << name << "_alpha[" << pixels << "] = {\n";
+    for (uint32_t i = 0; i < pixels; i++) {
+        std::snprintf(value, sizeof(value), "%3d", payload[i * 4 + 2]);
+        out << ((i % 16 == 0) ? "    " : ",") << value << ((i % 16 == 15 || i + 1 == pixels) ? ",\n" : "");
+    }
+    out << "};\n\n";
+    out << "inline constexpr Sprite_planes " << name << "_sprite = {" << name << "_width, " << name << "_height, "
+        << name << "_color, " << name << "_alpha};\n\n";
+    out << "#endif // " << guard << "_H\n";
+
+    std::ofstream file(path);
+    file << out.str();
+    return static_cast<bool>(file);
+}
+
+// Hash of everything the output depends on: tool version, kind and source bytes
+bool hash_source(Job& job) {
+    std::vector<uint8_t> data;
+    if (!read_file(job.source, data)) {
+        std::cerr << "Error: Failed to read " << job.source.string() << std::endl;
+        return false;
+    }
+    std::string key = std::to_string(ASSETC_VERSION) + "|" + job.name + "|" + job.option;
+    job.hash = fnv1a(reinterpret_cast<const uint8_t*>(key.data()), key.size());
+    job.hash = fnv1a(data.data(), data.size(), job.hash);
+    return true;
+}
+
+void run_job(Job& job, const Options& options, const fs::path& cache_dir, const std::map<std::string, uint64_t>& cache) {
+    if (!hash_source(job)) return;
+    fs::path cached = cache_dir / (job.name + "." + hex(job.hash) + ".asset");
+    fs::path header = options.output / (job.name + ".h");
+    // Only plain sprites have a header, tilemaps and audio payloads are not pixels
+    auto header_wanted = [&]() {
+        return options.headers && job.assets.size() == 1 && job.assets[0].entry.type == Asset_type::sprite;
+    };
+
+    auto hit = cache.find(job.relative);
+    bool fresh = hit != cache.end() && hit->second == job.hash;
+    if (fresh && load_cached(cached, job.source.string(), job.assets)) {
+        if (!header_wanted() || fs::exists(header)) {
+            job.ok = true;
+            return;
+        }
+    }
+
+    job.assets.clear();
+    job.converted = true;
+    if (!load_asset(job.source.string(), job.option, job.name, job.assets)) return;
+    for (Asset& asset : job.assets) asset.source = job.source.string();
+    if (!save_cached(cached, job.assets)) {
+        std::cerr << "Error: Cannot write " << cached.string() << std::endl;
+        return;
+    }
+    if (header_wanted() && !write_sprite_header(header, job, job.assets.back())) {
+        std::cerr << "Error: Cannot write " << header.string() << std::endl;
+        return;
+    }
+    job.ok = true;
+}
+
+// Pack layout options, a change rewrites the pack even when no source changed
+std::string pack_options(const Options& options) {
+    return options.compress ? "lz " + std::to_string(options.chunk_size) : "raw";
+}
+
+std::string level_options(const Options& options) {
+    return std::to_string(options.chunk_width) + "x" + std::to_string(options.chunk_height);
+}
+
+// "<hash> <source>" per cached source, "pack <options>" / "level <chunk>" for the outputs last written
+std::map<std::string, uint64_t> load_index(const fs::path& path, std::string& pack, std::string& levels) {
+    std::map<std::string, uint64_t> cache;
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        size_t space = line.find(' ');
+        if (line.compare(0, 5, "pack ") == 0) pack = line.substr(5);
+        else if (line.compare(0, 6, "level ") == 0) levels = line.substr(6);
+        else if (space == 16) cache[line.substr(17)] = std::strtoull(line.substr(0, 16).c_str(), nullptr, 16);
+    }
+    return cache;
+}
+
+bool build(const Options& options) {
+    auto start = std::chrono::steady_clock::now();
+    fs::path cache_dir = options.output / ".assetc";
+    std::error_code error;
+    fs::create_directories(cache_dir, error);
+    if (error) {
+        std::cerr << "Error: cannot create " << cache_dir.string() << ": " << error.message() << std::endl;
+        return false;
+    }
+
+    std::vector<Job> jobs = scan(options.input);
+    std::string packed_with, levels_with;
+    std::map<std::string, uint64_t> cache = load_index(cache_dir / "index", packed_with, levels_with);
+
+    // Jobs are independent (own source, own cache file, own header), workers take the next one
+    unsigned threads = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min<unsigned>(threads, std::max<size_t>(jobs.size(), 1));
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (size_t i; (i = next.fetch_add(1)) < jobs.size();) run_job(jobs[i], options, cache_dir, cache);
+    };
+    std::vector<std::thread> pool;
+    for (unsigned i = 1; i < threads; i++) pool.emplace_back(worker);
+    worker();
+    for (std::thread& thread : pool) thread.join();
+
+    // Index of what succeeded, failed sources are converted again next time
+    size_t converted = 0, failed = 0;
+    bool levels_ok = true;
+    std::vector<Asset> assets;
+    std::ofstream index(cache_dir / "index");
+    for (Job& job : jobs) {
+        if (!job.ok) {
+            failed++;
+            continue;
+        }
+        if (job.converted) converted++;
+        index << hex(job.hash) << " " << job.relative << "\n";
+        // Streamed levels next to the pack, rewritten when the tilemap or the chunk size changed
+        for (const Asset& asset : job.assets) {
+            if (!options.levels || asset.entry.type != Asset_type::tilemap) continue;
+            fs::path level = options.output / (job.name + ".level");
+            if (job.converted || levels_with != level_options(options) || !fs::exists(level))
+                levels_ok &= write_level(level.string(), asset, options.chunk_width, options.chunk_height);
+        }
+        for (Asset& asset : job.assets) assets.push_back(std::move(asset));
+    }
+
+    // Drop cached conversions no source maps to any more
+    for (const fs::directory_entry& entry : fs::directory_iterator(cache_dir, error)) {
+        if (entry.path().extension() != ".asset") continue;
+        bool used = false;
+        for (const Job& job : jobs) used |= job.ok && entry.path().filename() == job.name + "." + hex(job.hash) + ".asset";
+        if (!used) fs::remove(entry.path(), error);
+    }
+
+    // The pack is rebuilt from the cached payloads, only when something changed
+    bool ok = failed == 0 && levels_ok;
+    fs::path pack = options.output / options.pack;
+    bool stale = converted > 0 || jobs.size() != cache.size() || !fs::exists(pack) || packed_with != pack_options(options);
+    for (const Job& job : jobs) stale |= !cache.count(job.relative);
+    if (ok && !options.pack.empty() && stale) {
+        ok = write_pack(pack.string(), assets, options.compress ? static_cast<uint32_t>(options.chunk_size) : 0);
+    }
+    // A failed or skipped pack keeps the options of the one on disk
+    if (ok && !options.pack.empty()) index << "pack " << pack_options(options) << "\n";
+    else if (!packed_with.empty()) index << "pack " << packed_with << "\n";
+    if (options.levels && failed == 0 && levels_ok) index << "level " << level_options(options) << "\n";
+    else if (!levels_with.empty()) index << "level " << levels_with << "\n";
+    index.close();
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << (ok ? "Built " : "Failed: ") << jobs.size() << " sources (" << converted << " converted, "
+              << jobs.size() - converted - failed << " cached, " << failed << " failed) in " << std::fixed
+              << std::setprecision(1) << ms << " ms on " << threads << " threads" << std::endl;
+    return ok;
+}
+
+// Poll the sources (inotify / FSEvents differ per host, polling is the same everywhere)
+void watch(const Options& options) {
+    auto snapshot = [&]() {
+        std::map<std::string, std::pair<fs::file_time_type, uintmax_t>> files;
+        std::error_code error;
+        for (fs::recursive_directory_iterator it(options.input, error), end; !error && it != end; it.increment(error)) {
+            if (it->is_regular_file()) files[it->path().string()] = {it->last_write_time(error), it->file_size(error)};
+        }
+        return files;
+    };
+    auto last = snapshot();
+    std::cout << "Watching " << options.input.string() << " (Ctrl+C to stop)" << std::endl;
+    while (true) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        auto now = snapshot();
+        if (now == last) continue;
+        last = now;
+        build(options);
+    }
+}
+
+void usage(const char* program) {
+    std::cout << "assetc - incremental asset build for PocketGateEngine\n";
+    std::cout << "Usage:\n";
+    std::cout << "  " << program << " [options] [asset_dir]          (default assets)\n";
+    std::cout << "\nOptions:\n";
+    std::cout << "  -o <dir>        output directory (default build/assets), cache in <dir>/.assetc\n";
+    std::cout << "  --pack <file>   write <dir>/<file> with every asset\n";
+    std::cout << "  --headers       write <dir>/<name>.h for every sprite (Sprite_planes, as sprite_to_cpp_alpha)\n";
+    std::cout << "  --levels        write <dir>/<name>.level for every tilemap (Level_stream)\n";
+    std::cout << "  --chunk <WxH>   .level chunk size in tiles (default 16x16)\n";
+    std::cout << "  -c              LZ compress the pack, -k <bytes> chunk size (default 4096)\n";
+    std::cout << "  -j <threads>    worker threads (default every core)\n";
+    std::cout << "  --watch         rebuild whenever a source changes\n";
+    std::cout << "\nSources (name = file name up to the first '.', at most " << PACK_NAME_LENGTH - 1 << " characters):\n";
+    std::cout << "  name.png  name.WxH.png (atlas)  name.palette.png  name.indexed.png  name.csv  name.wav\n";
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    bool watching = false;
+    bool input_set = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc) options.output = argv[++i];
+        else if (arg == "--pack" && i + 1 < argc) options.pack = argv[++i];
+        else if (arg == "--headers") options.headers = true;
+        else if (arg == "--levels") options.levels = true;
+        else if (arg == "--chunk" && i + 1 < argc) {
+            int chunk_w = 0, chunk_h = 0;
+            if (std::sscanf(argv[++i], "%dx%d", &chunk_w, &chunk_h) != 2 || chunk_w < 1 || chunk_h < 1 || int64_t(chunk_w) * chunk_h > 4096) {
+                std::cerr << "Error: chunk size must be WxH with 1 to 4096 tiles" << std::endl;
+                return 1;
+            }
+            options.chunk_width = static_cast<uint16_t>(chunk_w);
+            options.chunk_height = static_cast<uint16_t>(chunk_h);
+        }
+        else if (arg == "-c") options.compress = true;
+        else if (arg == "-k" && i + 1 < argc) options.chunk_size = std::strtol(argv[++i], nullptr, 10);
+        else if (arg == "-j" && i + 1 < argc) options.threads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        else if (arg == "--watch") watching = true;
+        else if (arg[0] == '-' || input_set) {
+            usage(argv[0]);
+            return 1;
+        }
+        else {
+            options.input = arg;
+            input_set = true;
+        }
+    }
+    if (options.pack.empty() && !options.headers && !options.levels) {
+        std::cerr << "Error: nothing to emit, use --pack, --headers and / or --levels" << std::endl;
+        usage(argv[0]);
+        return 1;
+    }
+    if (options.chunk_size < 16 || options.chunk_size > LZ_MAX_CHUNK_SIZE) {
+        std::cerr << "Error: chunk size must be 16 to " << LZ_MAX_CHUNK_SIZE << " bytes" << std::endl;
+        return 1;
+    }
+    if (!fs::is_directory(options.input)) {
+        std::cerr << "Error: " << options.input.string() << " is not a directory" << std::endl;
+        return 1;
+    }
+
+    bool ok = build(options);
+    if (watching) watch(options);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,420 @@
+// tools/atlas_packer/atlas_packer.cpp - packs many sprites into one RGB565 + Alpha8 atlas
+// MaxRects (best short side fit), transparent borders trimmed, identical frames shared.
+#define STB_IMAGE_IMPLEMENTATION
+#include "../stb_image.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct Pixel {
+    uint16_t color;
+    uint8_t alpha;
+};
+
+// Bytes per atlas pixel in the header: RGB565 plane + Alpha8 plane (Sprite_atlas_planes)
+const size_t PLANES_PIXEL_SIZE = 3;
+
+struct Image {
+    int width = 0;
+    int height = 0;
+    std::vector<Pixel> pixels;
+};
+
+struct Frame {
+    std::string name;
+    Image image;            // trimmed
+    int offset_x = 0;
+    int offset_y = 0;
+    int source_width = 0;
+    int source_height = 0;
+    int x = 0;              // position in the atlas
+    int y = 0;
+    int same_as = -1;       // index of an identical frame, shares its rect
+};
+
+struct Rect {
+    int x, y, width, height;
+};
+
+// Same threshold the engine uses to skip pixels (draw_sprite_alpha)
+const uint8_t ALPHA_VISIBLE = 10;
+
+uint16_t rgb_to_rgb565(uint8_t r, uint8_t g, uint8_t b) {
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+}
+
+bool ends_with(const std::string& s, const std::string& suffix) {
+    return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+std::string stem(const std::string& path) {
+    size_t slash = path.find_last_of("/\\");
+    std::string file = (slash == std::string::npos) ? path : path.substr(slash + 1);
+    size_t dot = file.find_last_of('.');
+    return (dot == std::string::npos) ? file : file.substr(0, dot);
+}
+
+// C identifier: lower case, everything else becomes '_'
+std::string identifier(const std::string& s) {
+    std::string out;
+    for (char c : s) out += std::isalnum(static_cast<unsigned char>(c)) ? static_cast<char>(std::tolower(c)) : '_';
+    if (out.empty() || std::isdigit(static_cast<unsigned char>(out[0]))) out = "_" + out;
+    return out;
+}
+
+bool load_png(const std::string& path, Image& image) {
+    int channels;
+    unsigned char* img = stbi_load(path.c_str(), &image.width, &image.height, &channels, 4);
+    if (!img) {
+        std::cerr << "Error: Failed to load " << path << std::endl;
+        return false;
+    }
+    image.pixels.resize(image.width * image.height);
+    for (int i = 0; i < image.width * image.height; i++) {
+        image.pixels[i] = {rgb_to_rgb565(img[i * 4], img[i * 4 + 1], img[i * 4 + 2]), img[i * 4 + 3]};
+    }
+    stbi_image_free(img);
+    return true;
+}
+
+// .sprite from png_to_sprite_alpha: uint16 width, uint16 height, then RGB565 (LE) + Alpha8 per pixel
+bool load_sprite(const std::string& path, Image& image) {
+    std::ifstream in(path, std::ios::binary);
+    uint16_t w = 0, h = 0;
+    if (!in.read(reinterpret_cast<char*>(&w), 2) || !in.read(reinterpret_cast<char*>(&h), 2)) {
+        std::cerr << "Error: Failed to read " << path << std::endl;
+        return false;
+    }
+    image.width = w;
+    image.height = h;
+    image.pixels.resize(w * h);
+    for (auto& p : image.pixels) {
+        uint8_t bytes[3];
+        if (!in.read(reinterpret_cast<char*>(bytes), 3)) {
+            std::cerr << "Error: " << path << " is truncated (expected " << w * h * 3 << " pixel bytes)" << std::endl;
+            return false;
+        }
+        p = {static_cast<uint16_t>(bytes[0] | (bytes[1] << 8)), bytes[2]};
+    }
+    return true;
+}
+
+Image crop(const Image& src, int x, int y, int width, int height) {
+    Image out;
+    out.width = width;
+    out.height = height;
+    out.pixels.resize(width * height);
+    for (int row = 0; row < height; row++) {
+        std::memcpy(&out.pixels[row * width], &src.pixels[(y + row) * src.width + x], width * sizeof(Pixel));
+    }
+    return out;
+}
+
+Frame make_frame(const std::string& name, const Image& source, bool trim) {
+    Frame frame;
+    frame.name = name;
+    frame.source_width = source.width;
+    frame.source_height = source.height;
+
+    int min_x = 0, min_y = 0, max_x = source.width - 1, max_y = source.height - 1;
+    if (trim) {
+        min_x = source.width; min_y = source.height; max_x = -1; max_y = -1;
+        for (int y = 0; y < source.height; y++) {
+            for (int x = 0; x < source.width; x++) {
+                if (source.pixels[y * source.width + x].alpha < ALPHA_VISIBLE) continue;
+                min_x = std::min(min_x, x); max_x = std::max(max_x, x);
+                min_y = std::min(min_y, y); max_y = std::max(max_y, y);
+            }
+        }
+        if (max_x < 0) {    // fully transparent, nothing to pack
+            min_x = min_y = 0;
+            max_x = max_y = -1;
+        }
+    }
+    frame.offset_x = min_x;
+    frame.offset_y = min_y;
+    frame.image = crop(source, min_x, min_y, max_x - min_x + 1, max_y - min_y + 1);
+    return frame;
+}
+
+bool same_pixels(const Image& a, const Image& b) {
+    if (a.width != b.width || a.height != b.height) return false;
+    for (size_t i = 0; i < a.pixels.size(); i++) {
+        if (a.pixels[i].color != b.pixels[i].color || a.pixels[i].alpha != b.pixels[i].alpha) return false;
+    }
+    return true;
+}
+
+/*
+    MAXRECTS
+*/
+class Max_rects {
+public:
+    Max_rects(int width, int height) { free_rects.push_back({0, 0, width, height}); }
+
+    // Best short side fit: the free rect that leaves the smallest leftover on its shorter side
+    bool insert(int width, int height, Rect& placed) {
+        int best_short = INT32_MAX, best_long = INT32_MAX;
+        for (const Rect& r : free_rects) {
+            if (r.width < width || r.height < height) continue;
+            int leftover_w = r.width - width, leftover_h = r.height - height;
+            int short_side = std::min(leftover_w, leftover_h), long_side = std::max(leftover_w, leftover_h);
+            if (short_side < best_short || (short_side == best_short && long_side < best_long)) {
+                placed = {r.x, r.y, width, height};
+                best_short = short_side;
+                best_long = long_side;
+            }
+        }
+        if (best_short == INT32_MAX) return false;
+
+        std::vector<Rect> next;
+        for (const Rect& r : free_rects) split(r, placed, next);
+        free_rects.swap(next);
+        prune();
+        return true;
+    }
+
+private:
+    std::vector<Rect> free_rects;
+
+    static bool intersects(const Rect& a, const Rect& b) {
+        return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height;
+    }
+    static bool contains(const Rect& outer, const Rect& inner) {
+        return inner.x >= outer.x && inner.y >= outer.y &&
+               inner.x + inner.width <= outer.x + outer.width && inner.y + inner.height <= outer.y + outer.height;
+    }
+
+    // Up to four maximal free rects around the used one
+    static void split(const Rect& free, const Rect& used, std::vector<Rect>& out) {
+        if (!intersects(free, used)) {
+            out.push_back(free);
+            return;
+        }
+        if (used.x > free.x) out.push_back({free.x, free.y, used.x - free.x, free.height});
+        if (used.x + used.width < free.x + free.width)
+            out.push_back({used.x + used.width, free.y, free.x + free.width - used.x - used.width, free.height});
+        if (used.y > free.y) out.push_back({free.x, free.y, free.width, used.y - free.y});
+        if (used.y + used.height < free.y + free.height)
+            out.push_back({free.x, used.y + used.height, free.width, free.y + free.height - used.y - used.height});
+    }
+
+    void prune() {
+        for (size_t i = 0; i < free_rects.size(); i++) {
+            for (size_t j = i + 1; j < free_rects.size(); j++) {
+                if (contains(free_rects[j], free_rects[i])) {
+                    free_rects.erase(free_rects.begin() + i);
+                    i--;
+                    break;
+                }
+                if (contains(free_rects[i], free_rects[j])) {
+                    free_rects.erase(free_rects.begin() + j);
+                    j--;
+                }
+            }
+        }
+    }
+};
+
+// Packs all unique frames at the given width, returns the used height (0 = does not fit)
+int pack(std::vector<Frame>& frames, const std::vector<int>& order, int width, int max_height, int padding) {
+    Max_rects packer(width, max_height);
+    int used_height = 0;
+    for (int i : order) {
+        Frame& f = frames[i];
+        Rect placed = {0, 0, 0, 0};
+        if (!packer.insert(f.image.width + padding, f.image.height + padding, placed)) return 0;
+        f.x = placed.x;
+        f.y = placed.y;
+        used_height = std::max(used_height, placed.y + f.image.height);
+    }
+    return std::max(used_height, 1);
+}
+
+bool write_header(const std::string& path, const std::string& name, const std::vector<Frame>& frames,
+                  int width, int height, const std::vector<std::string>& inputs) {
+    std::vector<Pixel> atlas(width * height, Pixel{0x0000, 0});
+    for (const Frame& f : frames) {
+        if (f.same_as >= 0) continue;
+        for (int row = 0; row < f.image.height; row++) {
+            std::memcpy(&atlas[(f.y + row) * width + f.x], &f.image.pixels[row * f.image.width], f.image.width * sizeof(Pixel));
+        }
+    }
+
+    std::ofstream out(path);
+    if (!out) {
+        std::cerr << "Error: Cannot create " << path << std::endl;
+        return false;
+    }
+    std::string guard = "ATLAS_" + identifier(name) + "_H";
+    std::transform(guard.begin(), guard.end(), guard.begin(), ::toupper);
+
+    out << "// Auto-generated by tools/atlas_packer from:\n";
+    for (const auto& input : inputs) out << "//   " << input << "\n";
+    out << "// Atlas: " << width << "x" << height << ", " << frames.size() << " frames\n";
+    out << "// Format: RGB565 plane + Alpha8 plane (" << PLANES_PIXEL_SIZE << " bytes per pixel)\n\n";
+    out << "#ifndef " << guard << "\n#define " << guard << "\n\n";
+    out << "#include <stdint.h>\n";
+    out << "#include \"framebuffer.h\"  // For Sprite_atlas_planes definition\n\n";
+
+    for (size_t i = 0; i < frames.size(); i++) {
+        out << "inline constexpr uint16_t " << name << "_frame_" << frames[i].name << " = " << i << ";\n";
+    }
+    out << "inline constexpr uint16_t " << name << "_frame_count = " << frames.size() << ";\n\n";
+
+    // Same layout as the sprite headers (sprite_to_cpp_alpha.py, assetc --headers)
+    char value[8];
+    out << "inline constexpr uint16_t " << name << "_color[" << atlas.size() << "] = {\n";
+    for (size_t i = 0; i < atlas.size(); i++) {
+        std::snprintf(value, sizeof(value), "0x%04X", atlas[i].color);
+        out << ((i % 16 == 0) ? "    " : ",") << value << ((i % 16 == 15 || i + 1 == atlas.size()) ? ",\n" : "");
+    }
+    out << "};\n\n";
+    out << "inline constexpr uint8_t " << name << "_alpha[" << atlas.size() << "] = {\n";
+    for (size_t i = 0; i < atlas.size(); i++) {
+        std::snprintf(value, sizeof(value), "%3d", atlas[i].alpha);
+        out << ((i % 16 == 0) ? "    " : ",") << value << ((i % 16 == 15 || i + 1 == atlas.size()) ? ",\n" : "");
+    }
+    out << "};\n\n";
+
+    out << "// x, y, width, height, offset_x, offset_y, source_width, source_height\n";
+    out << "inline constexpr Atlas_frame " << name << "_frames[" << frames.size() << "] = {\n";
+    for (const Frame& f : frames) {
+        const Frame& rect = (f.same_as >= 0) ? frames[f.same_as] : f;
+        out << "    {" << rect.x << ", " << rect.y << ", " << f.image.width << ", " << f.image.height << ", "
+            << f.offset_x << ", " << f.offset_y << ", " << f.source_width << ", " << f.source_height << "},  // " << f.name << "\n";
+    }
+    out << "};\n\n";
+
+    out << "inline constexpr Sprite_atlas_planes " << name << "_atlas = {" << width << ", " << height << ", "
+        << name << "_color, " << name << "_alpha, " << name << "_frames, " << name << "_frame_count};\n\n";
+    out << "#endif // " << guard << "\n";
+    return true;
+}
+
+void usage(const char* program) {
+    std::cout << "Sprite Atlas Packer for PocketGateEngine\n";
+    std::cout << "Usage:\n";
+    std::cout << "  " << program << " [options] <input>...\n";
+    std::cout << "\nInputs:\n";
+    std::cout << "  image.png | image.sprite     one frame (.sprite = RGB565+Alpha8 from png_to_sprite_alpha)\n";
+    std::cout << "  sheet.png:WxH                sprite sheet, sliced into WxH frames (row by row)\n";
+    std::cout << "\nOptions:\n";
+    std::cout << "  -o <atlas.h>     output header (default atlas.h)\n";
+    std::cout << "  -n <name>        C name prefix (default: output file name)\n";
+    std::cout << "  -p <pixels>      padding between frames (default 1)\n";
+    std::cout << "  -m <pixels>      maximum atlas width / height (default 1024)\n";
+    std::cout << "  --no-trim        keep transparent borders\n";
+}
+
+int main(int argc, char** argv) {
+    std::string output = "atlas.h";
+    std::string name;
+    int padding = 1;
+    int max_size = 1024;
+    bool trim = true;
+    std::vector<std::string> inputs;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc) output = argv[++i];
+        else if (arg == "-n" && i + 1 < argc) name = argv[++i];
+        else if (arg == "-p" && i + 1 < argc) padding = std::atoi(argv[++i]);
+        else if (arg == "-m" && i + 1 < argc) max_size = std::atoi(argv[++i]);
+        else if (arg == "--no-trim") trim = false;
+        else if (arg[0] == '-') {
+            usage(argv[0]);
+            return 1;
+        }
+        else inputs.push_back(arg);
+    }
+    if (inputs.empty()) {
+        usage(argv[0]);
+        return 1;
+    }
+    name = identifier(name.empty() ? stem(output) : name);
+
+    // Load and slice
+    std::vector<Frame> frames;
+    for (const std::string& input : inputs) {
+        std::string path = input;
+        int cell_w = 0, cell_h = 0;
+        size_t colon = input.find_last_of(':');
+        if (colon != std::string::npos && std::sscanf(input.c_str() + colon + 1, "%dx%d", &cell_w, &cell_h) == 2) {
+            path = input.substr(0, colon);
+        }
+
+        Image image;
+        bool loaded = ends_with(path, ".sprite") ? load_sprite(path, image) : load_png(path, image);
+        if (!loaded) return 1;
+
+        std::string base = identifier(stem(path));
+        if (cell_w <= 0 || cell_h <= 0) {
+            frames.push_back(make_frame(base, image, trim));
+            continue;
+        }
+        int index = 0;
+        for (int y = 0; y + cell_h <= image.height; y += cell_h) {
+            for (int x = 0; x + cell_w <= image.width; x += cell_w) {
+                frames.push_back(make_frame(base + "_" + std::to_string(index++), crop(image, x, y, cell_w, cell_h), trim));
+            }
+        }
+    }
+
+    // Identical frames (held animation frames, mirrored tiles) share one rect
+    std::vector<int> order;
+    size_t pixel_area = 0;
+    for (size_t i = 0; i < frames.size(); i++) {
+        for (size_t j = 0; j < i; j++) {
+            if (frames[j].same_as < 0 && same_pixels(frames[i].image, frames[j].image)) {
+                frames[i].same_as = static_cast<int>(j);
+                break;
+            }
+        }
+        if (frames[i].same_as < 0 && frames[i].image.width > 0) {
+            order.push_back(static_cast<int>(i));
+            pixel_area += (frames[i].image.width + padding) * (frames[i].image.height + padding);
+        }
+    }
+    // Big frames first packs tighter
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        const Image& ia = frames[a].image;
+        const Image& ib = frames[b].image;
+        return std::max(ia.width, ia.height) > std::max(ib.width, ib.height);
+    });
+
+    // Try power of two widths, keep the one with the smallest width x used height
+    int best_width = 0, best_height = 0;
+    for (int width = 8; width <= max_size; width *= 2) {
+        int height = pack(frames, order, width, max_size, padding);
+        if (height == 0) continue;
+        height = (height + 7) & ~7;
+        if (best_width == 0 || width * height < best_width * best_height) {
+            best_width = width;
+            best_height = height;
+        }
+    }
+    if (best_width == 0) {
+        std::cerr << "Error: frames do not fit in " << max_size << "x" << max_size << std::endl;
+        return 1;
+    }
+    pack(frames, order, best_width, max_size, padding);
+
+    if (!write_header(output, name, frames, best_width, best_height, inputs)) return 1;
+
+    size_t source_area = 0;
+    for (const Frame& f : frames) source_area += f.source_width * f.source_height;
+    std::cout << "Packed " << frames.size() << " frames (" << order.size() << " unique) into "
+              << best_width << "x" << best_height << std::endl;
+    std::cout << "  Occupancy: " << (100 * pixel_area / (best_width * best_height)) << "%" << std::endl;
+    std::cout << "  Size: " << best_width * best_height * PLANES_PIXEL_SIZE << " bytes (separate Sprite_planes sprites: "
+              << source_area * 3 << " bytes)" << std::endl;
+    std::cout << "Success: Generated " << output << std::endl;
+    return 0;
+}
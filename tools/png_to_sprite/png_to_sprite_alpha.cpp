@@ -1,22 +1,19 @@
   // tools/png_to_sprite_alpha.cpp - RGB565 + Alpha8 format
   #define STB_IMAGE_IMPLEMENTATION
   #include "../stb_image.h"
+  #include "quantize.h"        // rgb_to_rgb565, dithering
   #include <fstream>
   #include <iostream>
   #include <cstdint>
   #include <cstring>
-
-  // RGB888 to RGB565 conversion
-  uint16_t rgb_to_rgb565(uint8_t r, uint8_t g, uint8_t b) {
-      return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
-  }
+  #include <vector>
 
   // Swap endianness for binary file (little-endian)
   uint16_t to_little_endian(uint16_t value) {
       return ((value & 0xFF) << 8) | ((value >> 8) & 0xFF);
   }
 
-  bool convert_png_to_sprite(const char* input_png, const char* output_sprite) {
+  bool convert_png_to_sprite(const char* input_png, const char* output_sprite, Dither dither) {
       int width, height, channels;
 
       // Load PNG with RGBA
@@ -45,17 +42,18 @@
       out.write(reinterpret_cast<const char*>(&w), sizeof(uint16_t));
       out.write(reinterpret_cast<const char*>(&h), sizeof(uint16_t));
 
+      // Plain shifts band on gradients, dithering trades the bands for fine noise
+      std::vector<uint16_t> colors;
+      dither_to_rgb565({img, width, height}, dither, colors);
+
       // Convert and write pixel data (RGB565 + Alpha8 = 3 bytes per pixel)
       int transparent_count = 0;
       for (int y = 0; y < height; y++) {
           for (int x = 0; x < width; x++) {
               int index = (y * width + x) * 4;  // RGBA = 4 bytes/pixel
-              uint8_t r = img[index + 0];
-              uint8_t g = img[index + 1];
-              uint8_t b = img[index + 2];
               uint8_t a = img[index + 3];
 
-              uint16_t rgb565 = rgb_to_rgb565(r, g, b);
+              uint16_t rgb565 = colors[y * width + x];
 
               if (a < 10) {
                   transparent_count++;
@@ -76,10 +74,23 @@
   }
 
   int main(int argc, char** argv) {
-      if (argc < 2) {
+      // Positional arguments, -d <dither> anywhere
+      std::vector<std::string> args;
+      Dither dither = Dither::none;
+      bool dither_ok = true;
+      for (int i = 1; i < argc; i++) {
+          std::string arg = argv[i];
+          if (arg == "-d" && i + 1 < argc) dither_ok &= parse_dither(argv[++i], dither);
+          else args.push_back(arg);
+      }
+
+      if (args.empty() || !dither_ok) {
           std::cout << "PNG to Binary Sprite Converter (Alpha Blending) for PocketGateEngine\n";
           std::cout << "Usage:\n";
-          std::cout << "  " << argv[0] << " <input.png> [output.sprite]\n";
+          std::cout << "  " << argv[0] << " [-d none|ordered|fs] <input.png> [output.sprite]\n";
+          std::cout << "\nOptions:\n";
+          std::cout << "  -d <dither>  RGB888 -> RGB565 dithering: none (default, plain shifts), ordered (Bayer 4x4)\n";
+          std::cout << "               or fs (Floyd-Steinberg), against banding on gradients\n";
           std::cout << "\nOutput format:\n";
           std::cout << "  - Width: uint16_t (2 bytes)\n";
           std::cout << "  - Height: uint16_t (2 bytes)\n";
@@ -88,11 +99,11 @@
           return 1;
       }
 
-      std::string input = argv[1];
+      std::string input = args[0];
       std::string output;
 
-      if (argc >= 3) {
-          output = argv[2];
+      if (args.size() >= 2) {
+          output = args[1];
       } else {
           // Auto-generate output filename
           size_t dot = input.find_last_of('.');
@@ -103,7 +114,7 @@
           }
       }
 
-      if (!convert_png_to_sprite(input.c_str(), output.c_str())) {
+      if (!convert_png_to_sprite(input.c_str(), output.c_str(), dither)) {
           return 1;
       }
 
@@ -0,0 +1,218 @@
+// tools/png_to_sprite/png_to_sprite_indexed.cpp - 8bpp / 4bpp palette indexed sprites
+// All inputs share one palette (index 0 = transparent). Inputs with more colors than the
+// palette holds are quantized (median cut + k-means) and dithered (quantize.h).
+#define STB_IMAGE_IMPLEMENTATION
+#include "../stb_image.h"
+#include "quantize.h"
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct Sprite {
+    std::string name;
+    std::string path;
+    int width = 0;
+    int height = 0;
+    unsigned char* rgba = nullptr;
+    std::vector<uint8_t> pixels;        // one index per pixel, packed by write_header for 4bpp
+};
+
+// Same transparency threshold as png_to_sprite (indexed sprites are not blended)
+const uint8_t ALPHA_OPAQUE = 128;
+// Shown for transparent pixels if a palette is dumped as is
+const uint16_t TRANSPARENT_COLOR = 0xF81F;
+
+std::string stem(const std::string& path) {
+    size_t slash = path.find_last_of("/\\");
+    std::string file = (slash == std::string::npos) ? path : path.substr(slash + 1);
+    size_t dot = file.find_last_of('.');
+    return (dot == std::string::npos) ? file : file.substr(0, dot);
+}
+
+// C identifier: lower case, everything else becomes '_'
+std::string identifier(const std::string& text) {
+    std::string id;
+    for (char c : text) id += std::isalnum(static_cast<unsigned char>(c)) ? std::tolower(c) : '_';
+    if (id.empty() || std::isdigit(static_cast<unsigned char>(id[0]))) id = "_" + id;
+    return id;
+}
+
+std::string upper(const std::string& text) {
+    std::string out;
+    for (char c : text) out += std::toupper(static_cast<unsigned char>(c));
+    return out;
+}
+
+bool load_sprite(const std::string& path, Sprite& sprite) {
+    int channels;
+    sprite.rgba = stbi_load(path.c_str(), &sprite.width, &sprite.height, &channels, 4);
+    if (!sprite.rgba) {
+        std::cerr << "Error: Failed to load " << path << std::endl;
+        return false;
+    }
+    sprite.path = path;
+    sprite.name = identifier(stem(path));
+    return true;
+}
+
+// 4bpp: two pixels per byte, first in the high nibble, every row starts on a byte
+std::vector<uint8_t> pack_4bpp(const Sprite& sprite) {
+    const int stride = (sprite.width + 1) / 2;
+    std::vector<uint8_t> packed(size_t(stride) * sprite.height, 0);
+    for (int y = 0; y < sprite.height; y++)
+        for (int x = 0; x < sprite.width; x++) {
+            uint8_t value = sprite.pixels[y * sprite.width + x];
+            packed[y * stride + x / 2] |= (x & 1) ? value : value << 4;
+        }
+    return packed;
+}
+
+bool write_header(const std::string& output, const std::string& name, int bits, const std::vector<uint16_t>& palette, const std::vector<Sprite>& sprites) {
+    std::ofstream f(output);
+    if (!f) {
+        std::cerr << "Error: Cannot create " << output << std::endl;
+        return false;
+    }
+
+    std::string guard = "SPRITE_" + upper(name) + "_H";
+    f << "// Auto-generated by tools/png_to_sprite/png_to_sprite_indexed from:\n";
+    for (const Sprite& sprite : sprites) f << "//   " << sprite.path << "\n";
+    if (bits == 4) f << "// Format: 4bpp palette indexed (2 pixels per byte, high nibble first), index 0 = transparent\n\n";
+    else f << "// Format: 8bpp palette indexed (1 byte per pixel), index 0 = transparent\n\n";
+    f << "#ifndef " << guard << "\n";
+    f << "#define " << guard << "\n\n";
+    f << "#include <stdint.h>\n";
+    f << "#include \"framebuffer_indexed.h\"  // For Indexed_sprite definition\n\n";
+
+    f << "inline constexpr uint16_t " << name << "_palette_size = " << palette.size() << ";\n";
+    f << "inline constexpr uint16_t " << name << "_palette[" << palette.size() << "] = {\n";
+    char buffer[16];
+    for (size_t i = 0; i < palette.size(); i += 8) {
+        f << "   ";
+        for (size_t j = i; j < i + 8 && j < palette.size(); j++) {
+            std::snprintf(buffer, sizeof(buffer), " 0x%04X,", palette[j]);
+            f << buffer;
+        }
+        f << "\n";
+    }
+    f << "};\n";
+
+    for (const Sprite& sprite : sprites) {
+        const std::vector<uint8_t> pixels = (bits == 4) ? pack_4bpp(sprite) : sprite.pixels;
+        f << "\ninline constexpr uint8_t " << sprite.name << "_pixels[" << pixels.size() << "] = {\n";
+        for (size_t i = 0; i < pixels.size(); i += 16) {
+            f << "   ";
+            for (size_t j = i; j < i + 16 && j < pixels.size(); j++) {
+                std::snprintf(buffer, sizeof(buffer), (bits == 4) ? " 0x%02X," : " %3d,", pixels[j]);
+                f << buffer;
+            }
+            f << "\n";
+        }
+        f << "};\n";
+        f << "inline constexpr " << (bits == 4 ? "Indexed_sprite_4bpp " : "Indexed_sprite ") << sprite.name << "_indexed = {"
+          << sprite.width << ", " << sprite.height << ", " << sprite.name << "_pixels};\n";
+    }
+
+    f << "\n#endif // " << guard << "\n";
+    return true;
+}
+
+void usage(const char* program) {
+    std::cout << "PNG to Indexed Sprite Converter (8bpp / 4bpp palette) for PocketGateEngine\n";
+    std::cout << "Usage:\n";
+    std::cout << "  " << program << " [-o output.h] [-n name] [-b 8|4] [-c colors] [-d none|ordered|fs] <input.png>...\n";
+    std::cout << "\nOptions:\n";
+    std::cout << "  -b <bits>    8 (default, up to 255 colors) or 4 (up to 15 colors, 2 pixels per byte)\n";
+    std::cout << "  -c <colors>  palette size, inputs with more colors are quantized (median cut + k-means)\n";
+    std::cout << "  -d <dither>  dithering when quantizing: none, ordered (Bayer 4x4) or fs (Floyd-Steinberg, default)\n";
+    std::cout << "\nOutput (C++ header, all sprites share one palette):\n";
+    std::cout << "  - <name>_palette: RGB565 colors, load with Indexed_framebuffer::set_palette\n";
+    std::cout << "  - <sprite>_indexed: Indexed_sprite (1 byte per pixel) or Indexed_sprite_4bpp\n";
+    std::cout << "  - Alpha < 128 becomes index 0 (transparent)\n";
+}
+
+int main(int argc, char** argv) {
+    std::string output = "sprites_indexed.h";
+    std::string name;
+    std::vector<std::string> inputs;
+    long bits = 8;
+    long colors = 0;
+    Dither dither = Dither::floyd_steinberg;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc) output = argv[++i];
+        else if (arg == "-n" && i + 1 < argc) name = argv[++i];
+        else if (arg == "-b" && i + 1 < argc) bits = std::strtol(argv[++i], nullptr, 10);
+        else if (arg == "-c" && i + 1 < argc) colors = std::strtol(argv[++i], nullptr, 10);
+        else if (arg == "-d" && i + 1 < argc) {
+            if (!parse_dither(argv[++i], dither)) {
+                usage(argv[0]);
+                return 1;
+            }
+        }
+        else inputs.push_back(arg);
+    }
+
+    if (inputs.empty()) {
+        usage(argv[0]);
+        return 1;
+    }
+    if (bits != 8 && bits != 4) {
+        std::cerr << "Error: -b must be 8 or 4" << std::endl;
+        return 1;
+    }
+    const long max_colors = (bits == 4) ? 15 : 255;
+    if (colors == 0) colors = max_colors;
+    if (colors < 1 || colors > max_colors) {
+        std::cerr << "Error: " << bits << "bpp palettes hold 1 to " << max_colors << " colors" << std::endl;
+        return 1;
+    }
+    if (name.empty()) name = identifier(stem(output));
+
+    std::cout << "Converting (" << bits << "bpp indexed):" << std::endl;
+    std::vector<Sprite> sprites(inputs.size());
+    std::vector<Rgba_image> images;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        if (!load_sprite(inputs[i], sprites[i])) return 1;
+        images.push_back({sprites[i].rgba, sprites[i].width, sprites[i].height});
+    }
+
+    // One palette for every input: sprites drawn together (an atlas, a level) never need a switch
+    bool exact;
+    std::vector<uint16_t> quantized = build_palette(images, ALPHA_OPAQUE, static_cast<size_t>(colors), KMEANS_PASSES, exact);
+    Palette_lookup lookup(quantized, exact);
+    size_t pixel_count = 0, data_size = 0;
+    for (size_t i = 0; i < sprites.size(); i++) {
+        Sprite& sprite = sprites[i];
+        // An exact palette has nothing to dither
+        double error = remap_image(images[i], ALPHA_OPAQUE, lookup, quantized.size(), exact ? Dither::none : dither, 1, sprite.pixels);
+        int transparent_count = 0;
+        for (uint8_t index : sprite.pixels) transparent_count += index == 0;
+        pixel_count += sprite.pixels.size();
+        data_size += (bits == 4) ? size_t((sprite.width + 1) / 2) * sprite.height : sprite.pixels.size();
+        stbi_image_free(sprite.rgba);
+        sprite.rgba = nullptr;
+
+        std::cout << "  " << sprite.path << ": " << sprite.width << "x" << sprite.height
+                  << ", " << transparent_count << " transparent pixels";
+        if (!exact) std::cout << ", RMS error " << std::sqrt(error);
+        std::cout << std::endl;
+    }
+
+    std::vector<uint16_t> palette = {TRANSPARENT_COLOR};
+    palette.insert(palette.end(), quantized.begin(), quantized.end());
+    if (bits == 4) palette.resize(16, TRANSPARENT_COLOR);
+    if (!write_header(output, name, static_cast<int>(bits), palette, sprites)) return 1;
+
+    if (exact) std::cout << "  Palette: " << quantized.size() << " colors + transparent" << std::endl;
+    else std::cout << "  Palette: " << quantized.size() << " colors + transparent, quantized" << std::endl;
+    std::cout << "  Size: " << data_size + palette.size() * 2 << " bytes (RGB565+Alpha8: " << pixel_count * 3 << " bytes)" << std::endl;
+    std::cout << "Success: Generated " << output << std::endl;
+    return 0;
+}
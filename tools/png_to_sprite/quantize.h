@@ -0,0 +1,301 @@
+// tools/png_to_sprite/quantize.h - palette quantization and dithering shared by the converters
+// Median cut + k-means palettes for indexed sprites, ordered (Bayer 4x4) and Floyd-Steinberg
+// dithering for both palettes and plain RGB565 (banding of the RGB888 -> RGB565 shifts).
+#ifndef QUANTIZE_H
+#define QUANTIZE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+inline uint16_t rgb_to_rgb565(uint8_t r, uint8_t g, uint8_t b) {
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+}
+
+struct Rgb {
+    int r, g, b;
+};
+
+// RGB565 back to 8 bits per channel (top bits repeated, 31 -> 255)
+inline Rgb rgb565_to_rgb(uint16_t color) {
+    int r = (color >> 11) & 31, g = (color >> 5) & 63, b = color & 31;
+    return {(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)};
+}
+
+inline uint16_t clamp_to_rgb565(const Rgb& c) {
+    return rgb_to_rgb565(static_cast<uint8_t>(std::clamp(c.r, 0, 255)), static_cast<uint8_t>(std::clamp(c.g, 0, 255)),
+                         static_cast<uint8_t>(std::clamp(c.b, 0, 255)));
+}
+
+// Nearest RGB565 color as displayed (rgb565_to_rgb), rgb_to_rgb565 truncates
+inline uint16_t nearest_rgb565(const Rgb& c) {
+    int r = (std::clamp(c.r, 0, 255) * 31 + 127) / 255;
+    int g = (std::clamp(c.g, 0, 255) * 63 + 127) / 255;
+    int b = (std::clamp(c.b, 0, 255) * 31 + 127) / 255;
+    return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+inline int distance2(const Rgb& a, const Rgb& b) {
+    int dr = a.r - b.r, dg = a.g - b.g, db = a.b - b.b;
+    return dr * dr + dg * dg + db * db;
+}
+
+// k-means passes after median cut, later passes barely move the palette
+const int KMEANS_PASSES = 4;
+
+enum class Dither { none, ordered, floyd_steinberg };
+
+inline bool parse_dither(const std::string& text, Dither& dither) {
+    if (text == "none") dither = Dither::none;
+    else if (text == "ordered") dither = Dither::ordered;
+    else if (text == "fs" || text == "floyd-steinberg") dither = Dither::floyd_steinberg;
+    else return false;
+    return true;
+}
+
+struct Rgba_image {
+    const uint8_t* rgba;
+    int width;
+    int height;
+};
+
+// Visits the pixels with alpha >= min_alpha in row order. shown = quantize(pixel index, wanted)
+// is the color the pixel ends up with; ordered dithering offsets wanted by a Bayer threshold
+// of +-spread / 2, Floyd-Steinberg pushes wanted - shown onto the unvisited neighbours.
+// Pixels below min_alpha neither receive nor pass on error (no bleeding through holes).
+template<typename Quantize>
+void dither_image(const Rgba_image& image, uint8_t min_alpha, Dither dither, int spread, Quantize&& quantize) {
+    static const int bayer[4][4] = {{0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+    const int width = image.width;
+    std::vector<Rgb> error_row, error_next;
+    if (dither == Dither::floyd_steinberg) {
+        error_row.assign(width + 2, {0, 0, 0});
+        error_next.assign(width + 2, {0, 0, 0});
+    }
+
+    for (int y = 0; y < image.height; y++) {
+        for (int x = 0; x < width; x++) {
+            const int i = y * width + x;
+            const uint8_t* p = &image.rgba[i * 4];
+            if (p[3] < min_alpha) continue;
+            Rgb wanted = {p[0], p[1], p[2]};
+            if (dither == Dither::ordered) {
+                int offset = (bayer[y & 3][x & 3] * 2 - 15) * spread / 32;
+                wanted = {wanted.r + offset, wanted.g + offset, wanted.b + offset};
+            }
+            else if (dither == Dither::floyd_steinberg) {
+                const Rgb& e = error_row[x + 1];
+                wanted = {std::clamp(wanted.r + e.r / 16, 0, 255), std::clamp(wanted.g + e.g / 16, 0, 255),
+                          std::clamp(wanted.b + e.b / 16, 0, 255)};
+            }
+            Rgb shown = quantize(i, wanted);
+            if (dither != Dither::floyd_steinberg) continue;
+
+            // Error in 16ths: 7 right, 3 down left, 5 down, 1 down right
+            Rgb e = {wanted.r - shown.r, wanted.g - shown.g, wanted.b - shown.b};
+            auto spread_error = [&](Rgb& target, int weight) {
+                target.r += e.r * weight;
+                target.g += e.g * weight;
+                target.b += e.b * weight;
+            };
+            if (x + 1 < width && image.rgba[(i + 1) * 4 + 3] >= min_alpha) spread_error(error_row[x + 2], 7);
+            spread_error(error_next[x], 3);
+            spread_error(error_next[x + 1], 5);
+            spread_error(error_next[x + 2], 1);
+        }
+        if (dither == Dither::floyd_steinberg) {
+            error_row.swap(error_next);
+            std::fill(error_next.begin(), error_next.end(), Rgb{0, 0, 0});
+        }
+    }
+}
+
+// Plain RGB565 conversion with dithering: one RGB565 step of spread, so flat areas stay flat
+// and gradients turn into fine noise instead of bands
+inline void dither_to_rgb565(const Rgba_image& image, Dither dither, std::vector<uint16_t>& out) {
+    out.resize(size_t(image.width) * image.height);
+    for (size_t i = 0; i < out.size(); i++) {
+        const uint8_t* p = &image.rgba[i * 4];
+        out[i] = rgb_to_rgb565(p[0], p[1], p[2]);
+    }
+    if (dither == Dither::none) return;
+    // Spread of one red / blue step (two green steps)
+    dither_image(image, 1, dither, 8, [&](int i, const Rgb& wanted) {
+        out[i] = nearest_rgb565(wanted);
+        return rgb565_to_rgb(out[i]);
+    });
+}
+
+// Palette for the pixels with alpha >= min_alpha of all images, at most max_colors RGB565
+// colors. exact is set when the distinct colors fit: the palette is then every color in the
+// order first seen. Otherwise median cut (largest squared error box split at the weighted
+// median of its widest channel) refined by kmeans_passes passes of k-means.
+inline std::vector<uint16_t> build_palette(const std::vector<Rgba_image>& images, uint8_t min_alpha, size_t max_colors,
+                                           int kmeans_passes, bool& exact) {
+    std::vector<uint16_t> order;
+    std::vector<uint32_t> count(65536, 0);
+    for (const Rgba_image& image : images) {
+        for (int i = 0; i < image.width * image.height; i++) {
+            const uint8_t* p = &image.rgba[i * 4];
+            if (p[3] < min_alpha) continue;
+            uint16_t color = rgb_to_rgb565(p[0], p[1], p[2]);
+            if (count[color]++ == 0) order.push_back(color);
+        }
+    }
+    exact = order.size() <= max_colors;
+    if (exact || max_colors == 0) return order;
+
+    struct Entry {
+        Rgb color;
+        uint32_t weight;
+    };
+    std::vector<Entry> entries;
+    entries.reserve(order.size());
+    for (uint16_t color : order) entries.push_back({rgb565_to_rgb(color), count[color]});
+
+    struct Box {
+        size_t begin, end;
+        double error;
+        int channel;
+    };
+    auto channel_of = [](const Rgb& c, int channel) { return channel == 0 ? c.r : channel == 1 ? c.g : c.b; };
+    auto make_box = [&](size_t begin, size_t end) {
+        double sum[3] = {}, sum2[3] = {}, weight = 0;
+        for (size_t i = begin; i < end; i++) {
+            for (int c = 0; c < 3; c++) {
+                double v = channel_of(entries[i].color, c);
+                sum[c] += v * entries[i].weight;
+                sum2[c] += v * v * entries[i].weight;
+            }
+            weight += entries[i].weight;
+        }
+        Box box = {begin, end, 0, 0};
+        double widest = -1;
+        for (int c = 0; c < 3; c++) {
+            double error = sum2[c] - sum[c] * sum[c] / weight;
+            box.error += error;
+            if (error > widest) {
+                widest = error;
+                box.channel = c;
+            }
+        }
+        if (end - begin < 2) box.error = 0;
+        return box;
+    };
+
+    std::vector<Box> boxes = {make_box(0, entries.size())};
+    while (boxes.size() < max_colors) {
+        auto worst = std::max_element(boxes.begin(), boxes.end(), [](const Box& a, const Box& b) { return a.error < b.error; });
+        if (worst->error <= 0) break;
+        Box box = *worst;
+        std::sort(entries.begin() + box.begin, entries.begin() + box.end, [&](const Entry& a, const Entry& b) {
+            return channel_of(a.color, box.channel) < channel_of(b.color, box.channel);
+        });
+        uint64_t total = 0, half = 0;
+        for (size_t i = box.begin; i < box.end; i++) total += entries[i].weight;
+        size_t split = box.begin + 1;
+        for (size_t i = box.begin; i + 1 < box.end; i++) {
+            half += entries[i].weight;
+            split = i + 1;
+            if (half * 2 >= total) break;
+        }
+        *worst = make_box(box.begin, split);
+        boxes.push_back(make_box(split, box.end));
+    }
+
+    // Box averages, then k-means: every color to its nearest entry, entries to their averages
+    std::vector<Rgb> centers;
+    for (const Box& box : boxes) {
+        double sum[3] = {}, weight = 0;
+        for (size_t i = box.begin; i < box.end; i++) {
+            sum[0] += double(entries[i].color.r) * entries[i].weight;
+            sum[1] += double(entries[i].color.g) * entries[i].weight;
+            sum[2] += double(entries[i].color.b) * entries[i].weight;
+            weight += entries[i].weight;
+        }
+        centers.push_back({int(std::lround(sum[0] / weight)), int(std::lround(sum[1] / weight)), int(std::lround(sum[2] / weight))});
+    }
+    for (int pass = 0; pass < kmeans_passes; pass++) {
+        std::vector<double> sums(centers.size() * 4, 0);
+        for (const Entry& entry : entries) {
+            size_t nearest = 0;
+            int best = distance2(entry.color, centers[0]);
+            for (size_t c = 1; c < centers.size(); c++) {
+                int d = distance2(entry.color, centers[c]);
+                if (d < best) {
+                    best = d;
+                    nearest = c;
+                }
+            }
+            double* sum = &sums[nearest * 4];
+            sum[0] += double(entry.color.r) * entry.weight;
+            sum[1] += double(entry.color.g) * entry.weight;
+            sum[2] += double(entry.color.b) * entry.weight;
+            sum[3] += entry.weight;
+        }
+        for (size_t c = 0; c < centers.size(); c++) {
+            const double* sum = &sums[c * 4];
+            if (sum[3] > 0) centers[c] = {int(std::lround(sum[0] / sum[3])), int(std::lround(sum[1] / sum[3])), int(std::lround(sum[2] / sum[3]))};
+        }
+    }
+
+    // Two centers can round to the same RGB565 color, keep one
+    std::vector<uint16_t> palette;
+    for (const Rgb& center : centers) {
+        uint16_t color = nearest_rgb565(center);
+        if (std::find(palette.begin(), palette.end(), color) == palette.end()) palette.push_back(color);
+    }
+    return palette;
+}
+
+// Nearest palette entry, memoized per RGB565 color asked for. An exact palette (build_palette)
+// truncates like rgb_to_rgb565, so every pixel maps to its own color.
+class Palette_lookup {
+public:
+    Palette_lookup(const std::vector<uint16_t>& palette, bool exact) : exact(exact), cache(65536, -1) {
+        for (uint16_t color : palette) colors.push_back(rgb565_to_rgb(color));
+    }
+
+    int nearest(const Rgb& wanted) {
+        uint16_t key = exact ? clamp_to_rgb565(wanted) : nearest_rgb565(wanted);
+        if (cache[key] >= 0) return cache[key];
+        Rgb target = rgb565_to_rgb(key);
+        int best = 0;
+        for (size_t i = 1; i < colors.size(); i++) {
+            if (distance2(target, colors[i]) < distance2(target, colors[best])) best = static_cast<int>(i);
+        }
+        cache[key] = static_cast<int16_t>(best);
+        return best;
+    }
+
+    const Rgb& color(int index) const { return colors[index]; }
+
+private:
+    bool exact;
+    std::vector<Rgb> colors;
+    std::vector<int16_t> cache;
+};
+
+// Pixels with alpha >= min_alpha to first + their palette position, the others to 0.
+// Returns the mean squared error per channel of the opaque pixels against the source.
+inline double remap_image(const Rgba_image& image, uint8_t min_alpha, Palette_lookup& lookup, size_t palette_size,
+                          Dither dither, uint8_t first, std::vector<uint8_t>& indices) {
+    indices.assign(size_t(image.width) * image.height, 0);
+    // Ordered dither amplitude: about the spacing of the palette colors in the RGB cube
+    const int spread = static_cast<int>(128 / std::cbrt(double(std::max<size_t>(palette_size, 1))));
+    double error = 0;
+    size_t opaque = 0;
+    dither_image(image, min_alpha, dither, spread, [&](int i, const Rgb& wanted) {
+        int index = lookup.nearest(wanted);
+        indices[i] = static_cast<uint8_t>(first + index);
+        const uint8_t* p = &image.rgba[i * 4];
+        error += distance2({p[0], p[1], p[2]}, lookup.color(index));
+        opaque++;
+        return lookup.color(index);
+    });
+    return opaque ? error / (opaque * 3.0) : 0;
+}
+
+#endif
@@ -33,36 +33,39 @@ def convert_sprite_to_cpp(input_file, output_file, width, height, sprite_name):
         alpha = data[offset+2]
         pixels.append((rgb565, alpha))
 
-    # Generate C++ header file
+    # Generate C++ header file: color and alpha planes (Sprite_planes), 3 bytes per pixel.
+    # Arrays of integers compile much faster than arrays of structs, inline constexpr keeps
+    # one copy in the program whatever the number of files that include the header.
     with open(output_file, 'w') as f:
         f.write(f"// Auto-generated from {input_file}\n")
         f.write(f"// Sprite dimensions: {width}x{height}\n")
-        f.write(f"// Format: RGB565 + Alpha8 (3 bytes per pixel)\n\n")
+        f.write(f"// Format: RGB565 plane + Alpha8 plane (3 bytes per pixel)\n\n")
         f.write(f"#ifndef SPRITE_{sprite_name.upper()}_H\n")
         f.write(f"#define SPRITE_{sprite_name.upper()}_H\n\n")
         f.write(f"#include <stdint.h>\n")
-        f.write(f'#include "framebuffer.h"  // For SpritePixel definition\n\n')
+        f.write(f'#include "framebuffer.h"  // For Sprite_planes definition\n\n')
 
         # Write sprite dimensions as constants
-        f.write(f"const uint16_t {sprite_name}_width = {width};\n")
-        f.write(f"const uint16_t {sprite_name}_height = {height};\n\n")
-
-        # Write pixel data array
-        f.write(f"const SpritePixel {sprite_name}_data[{num_pixels}] = {{\n")
-
-        # Write 4 pixels per line for readability
-        for i in range(0, len(pixels), 4):
-            line_pixels = pixels[i:i+4]
-            hex_values = ', '.join(f'{{0x{p[0]:04X}, {p[1]:3d}}}' for p in line_pixels)
-            f.write(f"    {hex_values},\n")
+        f.write(f"inline constexpr uint16_t {sprite_name}_width = {width};\n")
+        f.write(f"inline constexpr uint16_t {sprite_name}_height = {height};\n\n")
 
+        # 16 values per line
+        f.write(f"inline constexpr uint16_t {sprite_name}_color[{num_pixels}] = {{\n")
+        for i in range(0, len(pixels), 16):
+            f.write("    " + ",".join(f"0x{p[0]:04X}" for p in pixels[i:i+16]) + ",\n")
         f.write("};\n\n")
+        f.write(f"inline constexpr uint8_t {sprite_name}_alpha[{num_pixels}] = {{\n")
+        for i in range(0, len(pixels), 16):
+            f.write("    " + ",".join(f"{p[1]:3d}" for p in pixels[i:i+16]) + ",\n")
+        f.write("};\n\n")
+
+        f.write(f"inline constexpr Sprite_planes {sprite_name}_sprite = {{{sprite_name}_width, {sprite_name}_height, {sprite_name}_color, {sprite_name}_alpha}};\n\n")
         f.write(f"#endif // SPRITE_{sprite_name.upper()}_H\n")
 
     print(f"✓ Converted {input_file} → {output_file}")
     print(f"  Dimensions: {width}x{height}")
     print(f"  Pixels: {num_pixels}")
-    print(f"  Size: {actual_size} bytes (3 bytes/pixel: RGB565+Alpha8)")
+    print(f"  Size: {num_pixels * 3} bytes (3 bytes/pixel: RGB565 plane + Alpha8 plane)")
 
 if __name__ == "__main__":
     if len(sys.argv) != 6: